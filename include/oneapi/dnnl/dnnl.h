@@ -290,6 +290,63 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_dropout(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_dropout(
         dnnl_primitive_attr_t attr, const_dnnl_memory_desc_t dropout_desc);
 
+/// Returns the page size of the weights paging primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param page_size Output number of rows in a page of the weights. Zero
+///     means that the weights are not paged.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_weights_paging(
+        const_dnnl_primitive_attr_t attr, dnnl_dim_t *page_size);
+
+/// Sets the weights paging primitive attribute.
+///
+/// The outer of the two innermost dimensions of the weights, i.e. the one
+/// with the larger stride, is split into pages of @p page_size rows. The
+/// pages are stored in any order in a pool passed as the #DNNL_ARG_WEIGHTS
+/// execution argument. An `s32` page table of dimensions
+/// {weights batch, number of pages} passed as the
+/// #DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE execution argument maps every page of
+/// every weights batch to a page of the pool. The strides of the two
+/// innermost dimensions of the weights memory descriptor define the layout
+/// of the pool, while the batch strides are ignored.
+///
+/// @param attr Primitive attributes.
+/// @param page_size Number of rows in a page. Must be positive.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_weights_paging(
+        dnnl_primitive_attr_t attr, dnnl_dim_t page_size);
+
+/// Returns the data type of the source dynamic quantization primitive
+/// attribute.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type the source is quantized to.
+///     #dnnl_data_type_undef means that the source is not quantized
+///     dynamically.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets the source dynamic quantization primitive attribute.
+///
+/// A floating-point source is quantized at execution time with symmetric
+/// per-row (per-token) scales: every row of the source along the reduction
+/// dimension is divided by its absolute maximum over 127, rounded to the
+/// nearest integer and saturated. The result of the operation is scaled back
+/// by the same per-row scales, so the user does not provide the source scales.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Data type the source is quantized to. Only #dnnl_s8 is
+///     supported.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_dynamic_quantization(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
 /// Returns the floating-point math mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -3597,6 +3654,73 @@ dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_exec_stats
+/// @{
+
+/// Enables or disables collection of primitive execution statistics.
+///
+/// @note
+///     This setting overrides the ONEDNN_EXEC_STATS environment variable.
+///     The collection is disabled by default.
+///
+/// @param enable Flag value. Set to 0 to disable and set to 1 to enable.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p enable value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_exec_stats(int enable);
+
+/// Returns whether collection of primitive execution statistics is enabled.
+///
+/// @param enable Flag value to query: 1 if the collection is enabled and 0
+///     otherwise.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p enable value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_exec_stats_enabled(int *enable);
+
+/// Creates a snapshot of primitive execution statistics accumulated by all
+/// threads since the collection was enabled or since the last reset.
+///
+/// @param stats Output snapshot.
+/// @param reset If non-zero, the accumulated statistics are cleared. Every
+///     execution is accounted in exactly one of consecutive snapshots taken
+///     with @p reset set.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_exec_stats_create(
+        dnnl_exec_stats_t *stats, int reset);
+
+/// Returns the number of entries in a primitive execution statistics
+/// snapshot.
+///
+/// @param stats Snapshot.
+/// @param num_entries Output number of entries.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_exec_stats_get_num_entries(
+        const_dnnl_exec_stats_t stats, int *num_entries);
+
+/// Returns an entry of a primitive execution statistics snapshot. The
+/// strings referenced by the entry stay valid until the snapshot is
+/// destroyed.
+///
+/// @param stats Snapshot.
+/// @param index Index of the entry.
+/// @param entry Output entry.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_exec_stats_get_entry(const_dnnl_exec_stats_t stats,
+        int index, dnnl_exec_stats_entry_t *entry);
+
+/// Destroys a primitive execution statistics snapshot.
+///
+/// @param stats Snapshot to destroy.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_exec_stats_destroy(dnnl_exec_stats_t stats);
+
+/// @} dnnl_api_exec_stats
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -3965,6 +4089,211 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Returns the size of a buffer required to store matrix A or B of
+/// dnnl_sgemm_compute() in the packed format.
+///
+/// Packing converts a matrix into the internal layout of the GEMM kernels.
+/// A matrix that is used in many multiplications can be packed once with
+/// dnnl_sgemm_pack(), which removes the copy overhead from every call of
+/// dnnl_sgemm_compute(). The packed layout depends on all the parameters of
+/// the multiplication, so the packed buffer can be used only with the same
+/// @p transa, @p transb, @p M, @p N, and @p K values.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for matrix A, and 'B' or
+///     'b' for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A or B of dnnl_sgemm_compute().
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for matrix A, and 'B' or
+///     'b' for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer. The size of the buffer must be
+///     at least the value returned by dnnl_sgemm_pack_get_size(). For better
+///     performance, the buffer should be aligned to a page boundary.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst);
+
+/// Performs single-precision matrix-matrix multiply with packed matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// The semantics are the same as for dnnl_sgemm() with `alpha = 1`, except
+/// that either or both of matrices A and B can be packed by dnnl_sgemm_pack()
+/// with the same @p M, @p N, @p K, and transposition flags. The packed
+/// buffers are only read, so the same buffer can be used by concurrent calls
+/// from different threads.
+///
+/// @param transa Storage flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Storage flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to the packed buffer.
+/// @param lda The leading dimension for the matrix A. Ignored if A is packed.
+/// @param B A pointer to the B matrix data or to the packed buffer.
+/// @param ldb The leading dimension for the matrix B. Ignored if B is packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc);
+
+/// Returns the size of a buffer required to store matrix A or B of
+/// dnnl_gemm_bf16bf16f32_compute() in the packed format.
+///
+/// @sa dnnl_sgemm_pack_get_size() for the description of the parameters.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A or B of dnnl_gemm_bf16bf16f32_compute().
+///
+/// @sa dnnl_sgemm_pack() for the description of the parameters. The @p src
+/// matrix contains bfloat16 values.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs matrix-matrix multiply on bfloat16 matrices A and B, and
+/// single-precision resulting matrix C, where either or both of A and B can
+/// be packed by dnnl_gemm_bf16bf16f32_pack().
+///
+/// @sa dnnl_sgemm_compute() for the description of the parameters. The @p A
+/// and @p B matrices contain bfloat16 values unless they are packed.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc);
+
+/// Returns the size of a buffer required to store matrix A or B of
+/// dnnl_gemm_u8s8s32_compute() in the packed format.
+///
+/// @sa dnnl_sgemm_pack_get_size() for the description of the parameters.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A (8-bit unsigned) or B (8-bit signed) of
+/// dnnl_gemm_u8s8s32_compute().
+///
+/// @sa dnnl_sgemm_pack() for the description of the parameters.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
+/// signed matrix B, and 32-bit signed resulting matrix C, where either or
+/// both of A and B can be packed by dnnl_gemm_u8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// The semantics are the same as for dnnl_gemm_u8s8s32() with `alpha = 1`
+/// and zero offsets for matrices A and B.
+///
+/// @sa dnnl_sgemm_compute() and dnnl_gemm_u8s8s32() for the description of
+///     the parameters.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co);
+
+/// Returns the size of a buffer required to store matrix A or B of
+/// dnnl_gemm_s8s8s32_compute() in the packed format.
+///
+/// @sa dnnl_sgemm_pack_get_size() for the description of the parameters.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs matrix A or B of dnnl_gemm_s8s8s32_compute().
+///
+/// @sa dnnl_sgemm_pack() for the description of the parameters.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit signed matrix A, 8-bit
+/// signed matrix B, and 32-bit signed resulting matrix C, where either or
+/// both of A and B can be packed by dnnl_gemm_s8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// The semantics are the same as for dnnl_gemm_s8s8s32() with `alpha = 1`
+/// and zero offsets for matrices A and B.
+///
+/// @sa dnnl_sgemm_compute() and dnnl_gemm_s8s8s32() for the description of
+///     the parameters.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
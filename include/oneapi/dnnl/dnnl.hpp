@@ -551,6 +551,11 @@ enum class normalization_flags : unsigned {
     /// On training, normalization will require the workspace to implement
     /// backward propagation. On inference, the workspace is not required.
     fuse_norm_add_relu = dnnl_fuse_norm_add_relu,
+
+    /// Use Root Mean Square (RMS) normalization. The mean is not subtracted
+    /// from the source and is neither computed nor used. Supported by the
+    /// layer normalization primitive only.
+    rms_norm = dnnl_rms_norm,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -571,6 +576,9 @@ enum class rnn_flags : unsigned {
     undef = dnnl_rnn_flags_undef,
     /// Do not add weights gradient to existing diff_weights memory
     diff_weights_overwrite = dnnl_rnn_flags_diff_weights_overwrite,
+    /// Sequences in the minibatch have individual lengths passed at execution
+    /// time as #DNNL_ARG_SRC_LAYER_LENGTHS
+    variable_length = dnnl_rnn_flags_variable_length,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -3871,6 +3879,62 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set dropout primitive attribute");
     }
 
+    /// Returns the page size of the weights paging attribute.
+    ///
+    /// @returns Number of rows in a page of the weights or zero if the
+    ///     weights are not paged.
+    memory::dim get_weights_paging() const {
+        dnnl_dim_t page_size;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_weights_paging(get(), &page_size),
+                "could not get weights paging primitive attribute");
+        return page_size;
+    }
+
+    /// Sets the weights paging attribute.
+    ///
+    /// The weights are split into pages of @p page_size rows along their
+    /// outer dimension. The pages are passed as a pool with the
+    /// #DNNL_ARG_WEIGHTS execution argument and are located with an `s32`
+    /// page table passed with the #DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE execution
+    /// argument.
+    ///
+    /// @param page_size Number of rows in a page. Must be positive.
+    void set_weights_paging(memory::dim page_size) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_weights_paging(get(), page_size),
+                "could not set weights paging primitive attribute");
+    }
+
+    /// Returns the data type of the source dynamic quantization attribute.
+    ///
+    /// @returns Data type the source is quantized to or
+    ///     #dnnl::memory::data_type::undef if the source is not quantized
+    ///     dynamically.
+    memory::data_type get_src_dynamic_quantization() const {
+        dnnl_data_type_t data_type;
+        error::wrap_c_api(dnnl_primitive_attr_get_src_dynamic_quantization(
+                                  get(), &data_type),
+                "could not get source dynamic quantization primitive "
+                "attribute");
+        return static_cast<memory::data_type>(data_type);
+    }
+
+    /// Sets the source dynamic quantization attribute.
+    ///
+    /// A floating-point source is quantized at execution time with symmetric
+    /// per-row (per-token) scales computed from the absolute maximum of every
+    /// row. The result is scaled back by the same scales.
+    ///
+    /// @param data_type Data type the source is quantized to. Only
+    ///     #dnnl::memory::data_type::s8 is supported.
+    void set_src_dynamic_quantization(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_dynamic_quantization(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set source dynamic quantization primitive "
+                "attribute");
+    }
+
     /// Returns the fpmath mode
     fpmath_mode get_fpmath_mode() const {
         dnnl_fpmath_mode_t result;
@@ -13839,6 +13903,87 @@ inline void set_primitive_cache_capacity(int capacity) {
 
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_exec_stats Execution Statistics
+///
+/// A set of functions that provide low-overhead statistics of primitive
+/// executions.
+///
+/// @{
+
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_exec_stats_t> {
+    static dnnl_status_t destructor(dnnl_exec_stats_t p) {
+        return dnnl_exec_stats_destroy(p);
+    }
+};
+/// @endcond
+
+/// Execution statistics of primitives with the same implementation and
+/// problem description.
+struct exec_stats_entry {
+    /// Primitive kind.
+    primitive::kind kind;
+    /// Implementation name.
+    std::string impl_name;
+    /// Primitive information in the format of the verbose output.
+    std::string info;
+    /// Number of executions.
+    uint64_t count;
+    /// Total execution time in milliseconds.
+    double total_ms;
+    /// Minimal execution time in milliseconds.
+    double min_ms;
+    /// Maximal execution time in milliseconds.
+    double max_ms;
+    /// Total size of the memory arguments in bytes over all executions.
+    uint64_t bytes;
+};
+
+/// @copydoc dnnl_set_exec_stats(int enable)
+inline void set_exec_stats(bool enable) {
+    error::wrap_c_api(
+            dnnl_set_exec_stats(enable), "could not set execution statistics");
+}
+
+/// Returns whether collection of primitive execution statistics is enabled.
+inline bool get_exec_stats_enabled() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_exec_stats_enabled(&result),
+            "could not get execution statistics");
+    return result != 0;
+}
+
+/// Returns primitive execution statistics accumulated by all threads since
+/// the collection was enabled or since the last reset.
+///
+/// @param reset If true, the accumulated statistics are cleared.
+/// @returns Statistics entries sorted by the primitive information.
+inline std::vector<exec_stats_entry> get_exec_stats(bool reset = false) {
+    dnnl_exec_stats_t c_stats;
+    error::wrap_c_api(dnnl_exec_stats_create(&c_stats, reset),
+            "could not create an execution statistics snapshot");
+    handle<dnnl_exec_stats_t> stats(c_stats);
+
+    int num_entries = 0;
+    error::wrap_c_api(
+            dnnl_exec_stats_get_num_entries(stats.get(), &num_entries),
+            "could not get the number of execution statistics entries");
+
+    std::vector<exec_stats_entry> entries;
+    entries.reserve(num_entries);
+    for (int i = 0; i < num_entries; i++) {
+        dnnl_exec_stats_entry_t e;
+        error::wrap_c_api(dnnl_exec_stats_get_entry(stats.get(), i, &e),
+                "could not get an execution statistics entry");
+        entries.push_back({static_cast<primitive::kind>(e.kind), e.impl_name,
+                e.info, e.count, e.total_ms, e.min_ms, e.max_ms, e.bytes});
+    }
+    return entries;
+}
+
+/// @} dnnl_api_exec_stats
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -13872,6 +14017,104 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack_get_size()
+inline status gemm_bf16bf16f32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack()
+inline status gemm_bf16bf16f32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_compute()
+inline status gemm_bf16bf16f32_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack_get_size()
+inline status gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack()
+inline status gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_compute()
+inline status gemm_u8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack_get_size()
+inline status gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack()
+inline status gemm_s8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_compute()
+inline status gemm_s8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
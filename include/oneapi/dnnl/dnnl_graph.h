@@ -58,6 +58,30 @@ dnnl_status_t DNNL_API dnnl_graph_allocator_create(
 dnnl_status_t DNNL_API dnnl_graph_allocator_destroy(
         dnnl_graph_allocator_t allocator);
 
+/// Sets a user-provided arena for the host temporary buffers allocated by
+/// compiled partitions during execution.
+///
+/// Temporary buffers are placed into the arena by offset while they are
+/// alive, and the space is reused once they are released. Compiled partitions
+/// executed one after another on engines created with this allocator
+/// therefore share the same memory for their temporaries. Temporary buffers
+/// that do not fit into the arena are allocated with the allocation
+/// call-back function of the allocator. Tensors created with
+/// #DNNL_MEMORY_ALLOCATE are never placed into the arena.
+///
+/// The arena is shared by all the engines created with the allocator,
+/// including the engines created before the call. The arena must stay valid
+/// until these engines stop executing compiled partitions. An arena can only
+/// be replaced when none of its space is in use.
+///
+/// @param allocator Allocator.
+/// @param arena The arena base pointer. Passing NULL removes the arena.
+/// @param size The arena size in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_allocator_set_temporary_arena(
+        dnnl_graph_allocator_t allocator, void *arena, size_t size);
+
 /// @} dnnl_graph_api_allocator
 
 /// @addtogroup dnnl_graph_api_engine
@@ -189,6 +189,19 @@ public:
                 "could not create allocator");
         reset(a);
     }
+
+    /// Sets a user-provided arena for the host temporary buffers allocated
+    /// by compiled partitions during execution. Temporaries of compiled
+    /// partitions executed one after another reuse the arena by offset.
+    ///
+    /// @param arena The arena base pointer. Passing nullptr removes the
+    ///     arena.
+    /// @param size The arena size in bytes.
+    void set_temporary_arena(void *arena, size_t size) {
+        error::wrap_c_api(
+                dnnl_graph_allocator_set_temporary_arena(get(), arena, size),
+                "could not set temporary arena");
+    }
 };
 
 /// @} dnnl_graph_api_allocator
@@ -839,6 +852,10 @@ public:
         Wildcard = dnnl_graph_op_wildcard,
         GenIndex = dnnl_graph_op_gen_index,
         GreaterEqual = dnnl_graph_op_greater_equal,
+        RMSNorm = dnnl_graph_op_rms_norm,
+        RotaryEmbedding = dnnl_graph_op_rotary_embedding,
+        EmbeddingBag = dnnl_graph_op_embedding_bag,
+        TopK = dnnl_graph_op_top_k,
         // Sentinel
         LastSymbol = dnnl_graph_op_last_symbol,
     };
@@ -883,6 +900,8 @@ public:
         begin_norm_axis = dnnl_graph_op_attr_begin_norm_axis,
         /// Specifies a groups attribute to an op.
         groups = dnnl_graph_op_attr_groups,
+        /// Specifies a k attribute to an op.
+        k = dnnl_graph_op_attr_k,
 
         // int64_t vector attributes. The value of these attributes can be a
         // vector of int64 numbers.
@@ -258,6 +258,10 @@ typedef enum {
     dnnl_graph_op_group_norm,
     dnnl_graph_op_gen_index,
     dnnl_graph_op_greater_equal,
+    dnnl_graph_op_rms_norm,
+    dnnl_graph_op_rotary_embedding,
+    dnnl_graph_op_embedding_bag,
+    dnnl_graph_op_top_k,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -297,6 +301,8 @@ typedef enum {
     dnnl_graph_op_attr_begin_norm_axis,
     /// Specifies a groups attribute to an op.
     dnnl_graph_op_attr_groups,
+    /// Specifies a k attribute to an op.
+    dnnl_graph_op_attr_k,
 
     // int64_t vector attributes. The value of these attributes can be a vector
     // of int64 numbers.
@@ -2266,6 +2266,17 @@ typedef enum {
     ///    tensor and then perform backward normalization.
     dnnl_fuse_norm_add_relu = 0x10U,
 
+    /// Use Root Mean Square (RMS) normalization
+    ///
+    /// If specified:
+    ///  - the mean is not subtracted from the source and the variance is
+    ///    computed as the mean of squared source values
+    ///  - the mean is neither computed nor used, so the #DNNL_ARG_MEAN
+    ///    argument is not required
+    ///
+    /// The flag is supported by the layer normalization primitive only.
+    dnnl_rms_norm = 0x20U,
+
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -2337,6 +2348,10 @@ typedef enum {
     dnnl_rnn_flags_undef = 0x0,
     /// Do not add weights gradient to existing diff_weights memory
     dnnl_rnn_flags_diff_weights_overwrite = 0x1,
+    /// Sequences in the minibatch have individual lengths passed at execution
+    /// time as #DNNL_ARG_SRC_LAYER_LENGTHS. Supported for forward propagation
+    /// only.
+    dnnl_rnn_flags_variable_length = 0x2,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2499,6 +2514,12 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
 
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN per-sample sequence lengths used with
+/// #dnnl_rnn_flags_variable_length. An alias for #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SRC_LAYER_LENGTHS DNNL_ARG_SRC_4
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -2670,6 +2691,10 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Dropout RNG seed value passed via a buffer.
 #define DNNL_ARG_ATTR_DROPOUT_SEED 511
 
+/// Page table of paged weights.
+/// See dnnl_primitive_attr_set_weights_paging().
+#define DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE 512
+
 /// Output scaling factors provided at execution time.
 /// Deprecated value.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
@@ -2931,6 +2956,43 @@ typedef enum {
 
 /// @} dnnl_api_service
 
+/// @addtogroup dnnl_api_exec_stats
+/// @{
+
+/// @struct dnnl_exec_stats
+/// An opaque structure to describe a snapshot of primitive execution
+/// statistics.
+struct dnnl_exec_stats;
+
+/// A primitive execution statistics snapshot handle.
+typedef struct dnnl_exec_stats *dnnl_exec_stats_t;
+
+/// A constant primitive execution statistics snapshot handle.
+typedef const struct dnnl_exec_stats *const_dnnl_exec_stats_t;
+
+/// Execution statistics of primitives with the same implementation and
+/// problem description.
+typedef struct {
+    /// Primitive kind.
+    dnnl_primitive_kind_t kind;
+    /// Implementation name.
+    const char *impl_name;
+    /// Primitive information in the format of the verbose output.
+    const char *info;
+    /// Number of executions.
+    uint64_t count;
+    /// Total execution time in milliseconds.
+    double total_ms;
+    /// Minimal execution time in milliseconds.
+    double min_ms;
+    /// Maximal execution time in milliseconds.
+    double max_ms;
+    /// Total size of the memory arguments in bytes over all executions.
+    uint64_t bytes;
+} dnnl_exec_stats_entry_t;
+
+/// @} dnnl_api_exec_stats
+
 /// @} dnnl_api
 
 #ifdef __cplusplus
@@ -1904,6 +1904,7 @@ const normalization_flags_t use_scale = dnnl_use_scale;
 const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
+const normalization_flags_t rms_norm = dnnl_rms_norm;
 } // namespace normalization_flags
 
 using rnn_flags_t = dnnl_rnn_flags_t;
@@ -1911,6 +1912,7 @@ namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
 const rnn_flags_t diff_weights_overwrite
         = dnnl_rnn_flags_diff_weights_overwrite;
+const rnn_flags_t variable_length = dnnl_rnn_flags_variable_length;
 } // namespace rnn_flags
 
 using engine_kind_t = dnnl_engine_kind_t;
@@ -1969,6 +1971,12 @@ const primitive_kind_t group_normalization = dnnl_group_normalization;
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
 const primitive_kind_t sdpa = (primitive_kind_t)(internal_only_start + 1);
+const primitive_kind_t grouped_matmul
+        = (primitive_kind_t)(internal_only_start + 2);
+const primitive_kind_t rope = (primitive_kind_t)(internal_only_start + 3);
+const primitive_kind_t embedding_bag
+        = (primitive_kind_t)(internal_only_start + 4);
+const primitive_kind_t top_k = (primitive_kind_t)(internal_only_start + 5);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -77,8 +77,18 @@ status_t conv_desc_init(convolution_desc_t *conv_desc, prop_kind_t prop_kind,
     if (with_bias)
         runtime_dims_or_strides = runtime_dims_or_strides
                 || memory_desc_wrapper(bias_desc).has_runtime_dims_or_strides();
-    VCONDCHECK(primitive, create, check, conv, !runtime_dims_or_strides,
-            status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // Forward propagation allows the minibatch to be defined at execution
+    // time; weights and all other dimensions must be known in advance.
+    const bool runtime_mb_only = is_fwd
+            && memory_desc_wrapper(src_desc).has_runtime_mb_only()
+            && memory_desc_wrapper(dst_desc).has_runtime_mb_only()
+            && !memory_desc_wrapper(weights_desc).has_runtime_dims_or_strides()
+            && IMPLICATION(with_bias,
+                    !memory_desc_wrapper(bias_desc)
+                             .has_runtime_dims_or_strides());
+    VCONDCHECK(primitive, create, check, conv,
+            !runtime_dims_or_strides || runtime_mb_only, status::unimplemented,
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     (prop_kind == backward_data ? cd.diff_src_desc : cd.src_desc) = *src_desc;
     (is_fwd ? cd.dst_desc : cd.diff_dst_desc) = *dst_desc;
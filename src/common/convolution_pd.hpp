@@ -58,6 +58,7 @@ struct convolution_fwd_pd_t;
 
 struct convolution_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::convolution;
+    static constexpr bool supports_runtime_dims = false;
 
     const convolution_desc_t *desc() const { return &desc_; }
     const op_desc_t *op_desc() const override {
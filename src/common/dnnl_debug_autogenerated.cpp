@@ -1775,6 +1775,12 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_group_normalization) return "group_normalization";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
+    if (v == dnnl::impl::primitive_kind::grouped_matmul)
+        return "grouped_matmul";
+    if (v == dnnl::impl::primitive_kind::rope) return "rope";
+    if (v == dnnl::impl::primitive_kind::embedding_bag)
+        return "embedding_bag";
+    if (v == dnnl::impl::primitive_kind::top_k) return "top_k";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -1858,6 +1864,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
     if (v == dnnl_rnn_flags_diff_weights_overwrite) return "rnn_flags_diff_weights_overwrite";
+    if (v == dnnl_rnn_flags_variable_length) return "rnn_flags_variable_length";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
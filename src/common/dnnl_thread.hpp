@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <functional>
 #include <mutex>
+#include <vector>
 
 #include "utils.hpp"
 #include "z_magic.hpp"
@@ -263,6 +264,11 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - parallel_dynamic(nthr, work, grain, f)
+ *                                       - creates a parallel section and
+ *                                         distributes [0, work) in chunks of
+ *                                         at most grain items with work
+ *                                         stealing between threads
  */
 
 /* general parallelization */
@@ -593,6 +599,79 @@ static inline void parallel_nd_ext(int nthr, dim_t D0, dim_t D1, dim_t D2,
         });
 }
 
+/* parallel_dynamic section */
+// Intended for loops with irregular cost per item (e.g. causal attention),
+// where a static split leaves threads idle at the end of the section.
+// The range [0, work_amount) is initially split between threads the same way
+// as in balance211. Each thread processes its own range front to back in
+// chunks of at most `grain` items and, once the range is exhausted, steals
+// the upper half of the remaining range of another thread. Stealing is
+// attempted in round-robin order starting from the next thread which keeps
+// stolen work close to the victim's data.
+//
+// `f(ithr, nthr, start, end)` may be called several times per thread; `ithr`
+// is unique among concurrently running calls, so it can be used to index
+// per-thread buffers of size `nthr`.
+static inline void parallel_dynamic(int nthr, dim_t work_amount, dim_t grain,
+        const std::function<void(int, int, dim_t, dim_t)> &f) {
+    if (work_amount <= 0) return;
+    grain = std::max(grain, (dim_t)1);
+    nthr = adjust_num_threads(nthr, utils::div_up(work_amount, grain));
+    if (nthr <= 1) {
+        for (dim_t start = 0; start < work_amount; start += grain)
+            f(0, 1, start, std::min(work_amount, start + grain));
+        return;
+    }
+
+    struct range_t {
+        std::mutex mutex;
+        dim_t begin = 0, end = 0;
+        // Keep ranges of different threads in different cache lines.
+        char pad[64];
+    };
+    std::vector<range_t> ranges(nthr);
+    for (int ithr = 0; ithr < nthr; ++ithr)
+        balance211(work_amount, nthr, ithr, ranges[ithr].begin,
+                ranges[ithr].end);
+
+    // `nthr` from the parallel section is ignored: if the runtime provides
+    // fewer threads, the remaining ranges are simply stolen.
+    parallel(nthr, [&](int ithr, int) {
+        range_t &own = ranges[ithr];
+        while (true) {
+            dim_t start = 0, end = 0;
+            {
+                std::lock_guard<std::mutex> guard(own.mutex);
+                start = own.begin;
+                end = std::min(own.end, start + grain);
+                own.begin = end;
+            }
+            if (start < end) {
+                f(ithr, nthr, start, end);
+                continue;
+            }
+
+            bool stolen = false;
+            for (int i = 1; i < nthr && !stolen; ++i) {
+                range_t &victim = ranges[(ithr + i) % nthr];
+                std::lock_guard<std::mutex> guard(victim.mutex);
+                const dim_t left = victim.end - victim.begin;
+                if (left <= 0) continue;
+                const dim_t steal = std::max(left / 2, std::min(left, grain));
+                start = victim.end - steal;
+                end = victim.end;
+                victim.end = start;
+                stolen = true;
+            }
+            if (!stolen) break;
+
+            std::lock_guard<std::mutex> guard(own.mutex);
+            own.begin = start;
+            own.end = end;
+        }
+    });
+}
+
 /* parallel_nd section */
 static inline void parallel_nd(dim_t D0, const std::function<void(dim_t)> &f) {
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), D0);
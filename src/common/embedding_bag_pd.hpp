@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_PD_HPP
+#define COMMON_EMBEDDING_BAG_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/embedding_bag_utils.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, embedding_bag, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_EMBEDDING_BAG_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, embedding_bag, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+// NOLINTBEGIN(google-default-arguments)
+struct embedding_bag_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding_bag;
+
+    using base_class = embedding_bag_pd_t;
+    using hint_class = embedding_bag_pd_t;
+
+    const embedding_bag_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(
+                    arg, DNNL_ARG_SRC, DNNL_ARG_EMB_OFFSETS, DNNL_ARG_WEIGHTS))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_EMB_SAMPLE_WEIGHTS)
+            return with_sample_weights() ? arg_usage_t::input
+                                         : arg_usage_t::unused;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_EMB_OFFSETS: return src_md(1);
+            case DNNL_ARG_EMB_SAMPLE_WEIGHTS: return src_md(2);
+            case DNNL_ARG_WEIGHTS: return weights_md(0);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.indices_desc;
+            case 1: return &desc_.offsets_desc;
+            case 2:
+                return with_sample_weights() ? &desc_.sample_weights_desc
+                                             : &glob_zero_md;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.table_desc : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 3 + with_sample_weights(); }
+    int n_outputs() const override { return 1; }
+
+    alg_kind_t alg_kind() const { return desc_.alg_kind; }
+    dim_t batch() const { return desc_.batch(); }
+    dim_t emb_dim() const { return desc_.emb_dim(); }
+    dim_t num_rows() const { return desc_.num_rows(); }
+    dim_t nnz() const { return desc_.nnz(); }
+    bool with_sample_weights() const { return desc_.with_sample_weights(); }
+
+    // Per-row dequantization parameters of an integer table.
+    bool with_scales() const {
+        return !attr()->scales_.has_default_values(DNNL_ARG_WEIGHTS);
+    }
+    bool with_zero_points() const {
+        return !attr()->zero_points_.has_default_values(DNNL_ARG_WEIGHTS);
+    }
+
+protected:
+    embedding_bag_desc_t desc_;
+
+    embedding_bag_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<embedding_bag_desc_t>(adesc)) {}
+
+    bool set_default_formats() {
+        for (auto md : {&desc_.table_desc, &desc_.dst_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any()
+                    && memory_desc_init_by_tag(*md, format_tag::ab)
+                            != status::success)
+                return false;
+        }
+        for (auto md : {&desc_.indices_desc, &desc_.offsets_desc,
+                     &desc_.sample_weights_desc}) {
+            if (md->ndims == 0) continue;
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any()
+                    && memory_desc_init_by_tag(*md, format_tag::a)
+                            != status::success)
+                return false;
+        }
+        return true;
+    }
+
+    // Scales and zero points of an integer table are either common or set
+    // per row (mask 1).
+    bool attr_quant_ok() const {
+        using namespace data_type;
+        const auto &sc = attr()->scales_;
+        const auto &zp = attr()->zero_points_;
+        if (!with_scales() && !with_zero_points()) return true;
+        if (!utils::one_of(desc_.table_desc.data_type, s8, u8, s4, u4))
+            return false;
+        if (with_scales()
+                && (!utils::one_of(sc.get_mask(DNNL_ARG_WEIGHTS), 0, 1)
+                        || sc.get_data_type(DNNL_ARG_WEIGHTS) != f32
+                        || !sc.get(DNNL_ARG_WEIGHTS).has_default_groups()))
+            return false;
+        if (with_zero_points()
+                && (!utils::one_of(zp.get_mask(DNNL_ARG_WEIGHTS), 0, 1)
+                        || zp.get_data_type(DNNL_ARG_WEIGHTS) != s32
+                        || !zp.get(DNNL_ARG_WEIGHTS).has_default_groups()))
+            return false;
+        return true;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
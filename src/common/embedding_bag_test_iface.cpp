@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/embedding_bag_pd.hpp"
+#include "common/embedding_bag_types.hpp"
+#include "common/embedding_bag_utils.hpp"
+#include "common/primitive_desc_iface.hpp"
+
+using dnnl::impl::status_t;
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t table_desc,
+        const_dnnl_memory_desc_t sample_weights_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr) {
+    CHECK(embedding_bag_desc_check(alg_kind, indices_desc, offsets_desc,
+            table_desc, sample_weights_desc, dst_desc));
+
+    auto desc = create_embedding_bag_desc(alg_kind, indices_desc, offsets_desc,
+            table_desc, sample_weights_desc, dst_desc);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&desc, nullptr, attr);
+}
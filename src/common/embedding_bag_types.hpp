@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_TYPES_HPP
+#define COMMON_EMBEDDING_BAG_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Bag offsets in the indices: an s32 array of `batch + 1` values, bag `b`
+// pools the rows referenced by indices [offsets[b], offsets[b + 1]).
+#define DNNL_ARG_EMB_OFFSETS DNNL_ARG_SRC_1
+// Per-sample weights: an f32 array with a weight for every index. The rows
+// are multiplied by the weights before the pooling. Sum pooling only.
+#define DNNL_ARG_EMB_SAMPLE_WEIGHTS DNNL_ARG_SRC_2
+
+// A descriptor for an embedding bag operation.
+//
+// The indices of all the bags are stacked in a single array (the CSR format)
+// and every bag pools the rows of the embedding table it references:
+//   dst[b, :] = pool_{i in [offsets[b], offsets[b + 1])}(
+//           w[i] * table[indices[i], :]),
+// where the pooling is sum, mean or max, defined by the algorithm kind
+// (reduction_sum, reduction_mean or reduction_max). Empty bags produce
+// zeros. Integer tables are dequantized with per-row scales and zero points
+// set with the attributes on DNNL_ARG_WEIGHTS:
+//   table[r, :] = (table_q[r, :] - zero_point[r]) * scale[r].
+struct embedding_bag_desc_t : public op_desc_t {
+    embedding_bag_desc_t() : op_desc_t(primitive_kind::embedding_bag) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<embedding_bag_desc_t>(*this);
+    }
+
+    alg_kind_t alg_kind {};
+    memory_desc_t indices_desc; /* {nnz} */
+    memory_desc_t offsets_desc; /* {batch + 1} */
+    memory_desc_t table_desc; /* {num_rows, emb_dim} */
+    memory_desc_t sample_weights_desc; /* {nnz}, optional */
+    memory_desc_t dst_desc; /* {batch, emb_dim} */
+
+    dim_t batch() const { return dst_desc.dims[0]; }
+    dim_t emb_dim() const { return dst_desc.dims[1]; }
+    dim_t num_rows() const { return table_desc.dims[0]; }
+    dim_t nnz() const { return indices_desc.dims[0]; }
+    bool with_sample_weights() const { return sample_weights_desc.ndims != 0; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_EMBEDDING_BAG_TYPES_HPP
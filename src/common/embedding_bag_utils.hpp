@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_UTILS_HPP
+#define COMMON_EMBEDDING_BAG_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/embedding_bag_types.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_EMBEDDING_BAG(f, msg, ...) \
+    VCHECK(primitive, create, check, embedding_bag, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_EMBEDDING_BAG_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+static inline status_t embedding_bag_desc_check(alg_kind_t alg_kind,
+        const memory_desc_t *indices_md, const memory_desc_t *offsets_md,
+        const memory_desc_t *table_md, const memory_desc_t *sample_weights_md,
+        const memory_desc_t *dst_md) {
+    using namespace data_type;
+    const bool with_sample_weights
+            = sample_weights_md && sample_weights_md->ndims != 0;
+
+    VCHECK_EMBEDDING_BAG_COND(utils::one_of(alg_kind, alg_kind::reduction_sum,
+                                      alg_kind::reduction_mean,
+                                      alg_kind::reduction_max),
+            VERBOSE_BAD_ALGORITHM);
+    VCHECK_EMBEDDING_BAG_COND(
+            utils::everyone_is(1, indices_md->ndims, offsets_md->ndims),
+            VERBOSE_BAD_NDIMS, "indices", indices_md->ndims);
+    VCHECK_EMBEDDING_BAG_COND(
+            utils::everyone_is(2, table_md->ndims, dst_md->ndims),
+            VERBOSE_BAD_NDIMS, "table", table_md->ndims);
+    VCHECK_EMBEDDING_BAG_COND(offsets_md->dims[0] == dst_md->dims[0] + 1,
+            "number of offsets (%ld) must be equal to the number of bags "
+            "plus one (%ld)",
+            (long)offsets_md->dims[0], (long)(dst_md->dims[0] + 1));
+    VCHECK_EMBEDDING_BAG_COND(table_md->dims[1] == dst_md->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "table", 1, "dst", 1);
+    VCHECK_EMBEDDING_BAG_COND(
+            utils::everyone_is(s32, indices_md->data_type,
+                    offsets_md->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_EMBEDDING_BAG_COND(utils::one_of(table_md->data_type, f32, bf16,
+                                      f16, s8, u8, s4, u4),
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_EMBEDDING_BAG_COND(utils::one_of(dst_md->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    if (with_sample_weights) {
+        VCHECK_EMBEDDING_BAG_COND(alg_kind == alg_kind::reduction_sum,
+                "sample weights are supported only for sum pooling");
+        VCHECK_EMBEDDING_BAG_COND(sample_weights_md->ndims == 1,
+                VERBOSE_BAD_NDIMS, "sample_weights", sample_weights_md->ndims);
+        VCHECK_EMBEDDING_BAG_COND(
+                sample_weights_md->dims[0] == indices_md->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "sample_weights", 0, "indices", 0);
+        VCHECK_EMBEDDING_BAG_COND(sample_weights_md->data_type == f32,
+                VERBOSE_UNSUPPORTED_DT);
+    }
+
+    return status::success;
+}
+
+// Offsets and indices are passed at execution time, so implementations
+// validate them right before the computations: offsets must be non-decreasing
+// and stay within the indices, indices must reference rows of the table.
+static inline status_t embedding_bag_inputs_check(const int32_t *indices,
+        const int32_t *offsets, dim_t batch, dim_t nnz, dim_t num_rows) {
+    if (indices == nullptr || offsets == nullptr)
+        return status::invalid_arguments;
+    for (dim_t b = 0; b <= batch; b++) {
+        const dim_t lo = b == 0 ? 0 : offsets[b - 1];
+        if (offsets[b] < lo || offsets[b] > nnz)
+            return status::invalid_arguments;
+    }
+    for (dim_t i = offsets[0]; i < offsets[batch]; i++) {
+        if (indices[i] < 0 || indices[i] >= num_rows)
+            return status::invalid_arguments;
+    }
+    return status::success;
+}
+
+static inline embedding_bag_desc_t create_embedding_bag_desc(
+        alg_kind_t alg_kind, const memory_desc_t *indices_md,
+        const memory_desc_t *offsets_md, const memory_desc_t *table_md,
+        const memory_desc_t *sample_weights_md, const memory_desc_t *dst_md) {
+    auto desc = embedding_bag_desc_t();
+    desc.primitive_kind = primitive_kind::embedding_bag;
+    desc.alg_kind = alg_kind;
+    desc.indices_desc = *indices_md;
+    desc.offsets_desc = *offsets_md;
+    desc.table_desc = *table_md;
+    desc.sample_weights_desc
+            = sample_weights_md ? *sample_weights_md : types::zero_md();
+    desc.dst_desc = *dst_md;
+    return desc;
+}
+
+static inline status_t create_embedding_bag_pd(
+        std::shared_ptr<primitive_desc_t> &embedding_bag_pd, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *indices_md,
+        const memory_desc_t *offsets_md, const memory_desc_t *table_md,
+        const memory_desc_t *sample_weights_md, const memory_desc_t *dst_md,
+        const primitive_attr_t *attr) {
+    CHECK(embedding_bag_desc_check(alg_kind, indices_md, offsets_md, table_md,
+            sample_weights_md, dst_md));
+
+    auto desc = create_embedding_bag_desc(alg_kind, indices_md, offsets_md,
+            table_md, sample_weights_md, dst_md);
+    primitive_attr_t pd_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&desc, &pd_attr, nullptr);
+
+    embedding_bag_pd = *(++it);
+    VCHECK_EMBEDDING_BAG_COND(
+            embedding_bag_pd, "failed to create the embedding bag primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/exec_stats.hpp"
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/primitive_exec_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace exec_stats {
+
+void counters_t::add(double ms, uint64_t nbytes) {
+    min_ms = count == 0 ? ms : nstl::min(min_ms, ms);
+    max_ms = count == 0 ? ms : nstl::max(max_ms, ms);
+    total_ms += ms;
+    bytes += nbytes;
+    count++;
+}
+
+void counters_t::merge(const counters_t &other) {
+    if (other.count == 0) return;
+    min_ms = count == 0 ? other.min_ms : nstl::min(min_ms, other.min_ms);
+    max_ms = count == 0 ? other.max_ms : nstl::max(max_ms, other.max_ms);
+    total_ms += other.total_ms;
+    bytes += other.bytes;
+    count += other.count;
+}
+
+namespace {
+
+using records_t = std::unordered_map<std::string, record_t>;
+
+void merge_record(records_t &records, const record_t &r) {
+    auto it = records.find(r.info);
+    if (it == records.end())
+        records.emplace(r.info, r);
+    else
+        it->second.counters.merge(r.counters);
+}
+
+// Counters of a single thread. The records are looked up by the address of
+// the primitive descriptor, which avoids hashing the information string on
+// every execution. The records of a descriptor are moved to `retired` when a
+// primitive using it is destroyed, so `live` only holds the descriptors of
+// existing primitives. The string is still compared on every hit in case the
+// address is reused by a descriptor that was never retired.
+struct thread_buffer_t {
+    std::mutex mutex;
+    std::unordered_map<const primitive_desc_t *, record_t> live;
+    records_t retired;
+
+    void add(const primitive_desc_t *pd, const char *info, double ms,
+            uint64_t nbytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = live.find(pd);
+        if (it != live.end() && it->second.info.compare(info) != 0) {
+            merge_record(retired, it->second);
+            live.erase(it);
+            it = live.end();
+        }
+        if (it == live.end()) {
+            record_t r;
+            r.kind = pd->kind();
+            r.impl_name = pd->name();
+            r.info = info;
+            it = live.emplace(pd, std::move(r)).first;
+        }
+        it->second.counters.add(ms, nbytes);
+    }
+
+    void retire(const primitive_desc_t *pd) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = live.find(pd);
+        if (it == live.end()) return;
+        merge_record(retired, it->second);
+        live.erase(it);
+    }
+
+    void collect(records_t &records, bool reset) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto &e : live)
+            merge_record(records, e.second);
+        for (const auto &e : retired)
+            merge_record(records, e.second);
+        if (reset) {
+            live.clear();
+            retired.clear();
+        }
+    }
+};
+
+// All live thread buffers and the counters of exited threads. The registry is
+// intentionally leaked: thread buffers may be destroyed after static objects
+// when the process exits.
+struct registry_t {
+    std::mutex mutex;
+    std::unordered_set<thread_buffer_t *> buffers;
+    records_t retired;
+};
+
+registry_t &registry() {
+    static auto *r = new registry_t();
+    return *r;
+}
+
+struct thread_buffer_holder_t {
+    thread_buffer_holder_t() : buffer(new thread_buffer_t()) {
+        auto &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.buffers.insert(buffer.get());
+    }
+
+    ~thread_buffer_holder_t() {
+        auto &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        buffer->collect(r.retired, /* reset = */ true);
+        r.buffers.erase(buffer.get());
+    }
+
+    std::unique_ptr<thread_buffer_t> buffer;
+};
+
+thread_buffer_t &thread_buffer() {
+    static thread_local thread_buffer_holder_t holder;
+    return *holder.buffer;
+}
+
+uint64_t get_args_bytes(const exec_ctx_t &ctx) {
+    uint64_t nbytes = 0;
+    for (const auto &arg : ctx.args()) {
+        if (arg.first == DNNL_ARG_SCRATCHPAD || arg.second.mem == nullptr)
+            continue;
+        nbytes += memory_desc_wrapper(arg.second.mem->md()).size();
+    }
+    return nbytes;
+}
+
+} // namespace
+
+std::atomic<bool> &enabled() {
+    static std::atomic<bool> is_enabled(getenv_int_user("EXEC_STATS", 0) != 0);
+    return is_enabled;
+}
+
+void record(const primitive_desc_t *pd, const char *info,
+        const exec_ctx_t &ctx, double duration_ms) {
+    thread_buffer().add(pd, info, duration_ms, get_args_bytes(ctx));
+}
+
+void retire(const primitive_desc_t *pd) {
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (auto *b : r.buffers)
+        b->retire(pd);
+}
+
+std::vector<record_t> snapshot(bool reset) {
+    records_t records;
+    auto &r = registry();
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (auto *b : r.buffers)
+            b->collect(records, reset);
+        for (const auto &e : r.retired)
+            merge_record(records, e.second);
+        if (reset) r.retired.clear();
+    }
+
+    // Sort the entries to make the snapshots easy to compare.
+    std::map<std::string, record_t> sorted;
+    for (auto &e : records)
+        sorted.emplace(e.first, std::move(e.second));
+
+    std::vector<record_t> result;
+    result.reserve(sorted.size());
+    for (auto &e : sorted)
+        result.push_back(std::move(e.second));
+    return result;
+}
+
+} // namespace exec_stats
+} // namespace impl
+} // namespace dnnl
+
+// API
+using namespace dnnl::impl;
+
+status_t dnnl_set_exec_stats(int enable) {
+    if (enable != 0 && enable != 1) return status::invalid_arguments;
+    exec_stats::enabled().store(enable != 0, std::memory_order_relaxed);
+    return status::success;
+}
+
+status_t dnnl_get_exec_stats_enabled(int *enable) {
+    if (enable == nullptr) return status::invalid_arguments;
+    *enable = exec_stats::is_enabled() ? 1 : 0;
+    return status::success;
+}
+
+status_t dnnl_exec_stats_create(dnnl_exec_stats_t *stats, int reset) {
+    if (stats == nullptr) return status::invalid_arguments;
+    return safe_ptr_assign(
+            *stats, new dnnl_exec_stats(exec_stats::snapshot(reset != 0)));
+}
+
+status_t dnnl_exec_stats_get_num_entries(
+        const_dnnl_exec_stats_t stats, int *num_entries) {
+    if (utils::any_null(stats, num_entries)) return status::invalid_arguments;
+    *num_entries = stats->num_entries();
+    return status::success;
+}
+
+status_t dnnl_exec_stats_get_entry(const_dnnl_exec_stats_t stats, int index,
+        dnnl_exec_stats_entry_t *entry) {
+    if (utils::any_null(stats, entry) || index < 0
+            || index >= stats->num_entries())
+        return status::invalid_arguments;
+
+    const auto &r = stats->entry(index);
+    entry->kind = r.kind;
+    entry->impl_name = r.impl_name.c_str();
+    entry->info = r.info.c_str();
+    entry->count = r.counters.count;
+    entry->total_ms = r.counters.total_ms;
+    entry->min_ms = r.counters.min_ms;
+    entry->max_ms = r.counters.max_ms;
+    entry->bytes = r.counters.bytes;
+    return status::success;
+}
+
+status_t dnnl_exec_stats_destroy(dnnl_exec_stats_t stats) {
+    delete stats;
+    return status::success;
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EXEC_STATS_HPP
+#define COMMON_EXEC_STATS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct exec_ctx_t;
+struct primitive_desc_t;
+
+namespace exec_stats {
+
+// Low-overhead statistics of primitive executions. The collection is opt-in:
+// it is enabled by ONEDNN_EXEC_STATS=1 or by dnnl_set_exec_stats().
+//
+// Every thread accumulates the counters in its own buffer, so recording an
+// execution takes only an uncontended lock. The buffers of all threads are
+// merged when a snapshot is taken. Entries are identified by the primitive
+// information string, so executions of different primitive objects with the
+// same implementation and problem description are accumulated together.
+
+struct counters_t {
+    uint64_t count = 0;
+    double total_ms = 0;
+    double min_ms = 0;
+    double max_ms = 0;
+    uint64_t bytes = 0;
+
+    void add(double ms, uint64_t nbytes);
+    void merge(const counters_t &other);
+};
+
+struct record_t {
+    primitive_kind_t kind = primitive_kind::undefined;
+    std::string impl_name;
+    std::string info;
+    counters_t counters;
+};
+
+std::atomic<bool> &enabled();
+
+inline bool is_enabled() {
+    return enabled().load(std::memory_order_relaxed);
+}
+
+// Accounts a single execution of a primitive described by `pd` that took
+// `duration_ms` milliseconds on the host. `info` is the information string of
+// the primitive descriptor.
+void record(const primitive_desc_t *pd, const char *info,
+        const exec_ctx_t &ctx, double duration_ms);
+
+// Moves the counters of `pd` out of the per-descriptor records of the thread
+// buffers. Called when a primitive is destroyed, so the buffers don't grow
+// with the number of created primitives.
+void retire(const primitive_desc_t *pd);
+
+// Merges the buffers of all threads. When `reset` is set, the counters are
+// cleared in the same critical section, so no execution is lost or counted
+// twice by consecutive snapshots.
+std::vector<record_t> snapshot(bool reset);
+
+} // namespace exec_stats
+} // namespace impl
+} // namespace dnnl
+
+struct dnnl_exec_stats : public dnnl::impl::c_compatible {
+    dnnl_exec_stats(std::vector<dnnl::impl::exec_stats::record_t> &&records)
+        : records_(std::move(records)) {}
+
+    int num_entries() const { return (int)records_.size(); }
+    const dnnl::impl::exec_stats::record_t &entry(int index) const {
+        return records_[index];
+    }
+
+private:
+    std::vector<dnnl::impl::exec_stats::record_t> records_;
+};
+
+#endif
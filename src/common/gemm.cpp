@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2024 Intel Corporation
+* Copyright 2021-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -46,6 +47,12 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
+char c2f_identifier(char identifier) {
+    if (identifier == 'A' || identifier == 'a') return 'B';
+    if (identifier == 'B' || identifier == 'b') return 'A';
+    return identifier;
+}
+
 std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     std::string s_ = std::to_string(M);
     s_ += "x";
@@ -157,6 +164,161 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+// The packed GEMM API follows the row-major layout of the functions above,
+// while the internal routines use the Fortran notation. Hence the matrices
+// are swapped: packing matrix A of the public API packs matrix B of the
+// internal one.
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::sgemm_pack_get_size(&f_identifier, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::sgemm_pack(&f_identifier, &transb, &transa, &N, &M, &K, &ldb,
+            &lda, src, static_cast<float *>(dst));
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const void *A, dim_t lda, const void *B, dim_t ldb, float beta,
+        float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::sgemm_compute(&transb, &transa, &N, &M, &K,
+            static_cast<const float *>(B), &ldb, static_cast<const float *>(A),
+            &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dim_t M, dim_t N, dim_t K, dim_t lda,
+        dim_t ldb, size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_bf16bf16f32_pack_get_size(&f_identifier, &transb, &transa,
+            &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_bf16bf16f32_pack(&f_identifier, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, static_cast<const bfloat16_t *>(src),
+            static_cast<bfloat16_t *>(dst));
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_compute(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, const void *A, dim_t lda, const void *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_bf16bf16f32_compute(&transb, &transa, &N, &M, &K,
+            static_cast<const bfloat16_t *>(B), &ldb,
+            static_cast<const bfloat16_t *>(A), &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_s8u8s32_pack_get_size(&f_identifier, &transb, &transa,
+            &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_s8u8s32_pack(&f_identifier, &transb, &transa, &N, &M, &K,
+            &ldb, &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8u8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+            &N, &M, &K, static_cast<const int8_t *>(B), &ldb,
+            static_cast<const uint8_t *>(A), &lda, &beta, C, &ldc, co);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_s8s8s32_pack_get_size(&f_identifier, &transb, &transa,
+            &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_s8s8s32_pack(&f_identifier, &transb, &transa, &N, &M, &K,
+            &ldb, &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8s8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+            &N, &M, &K, static_cast<const int8_t *>(B), &ldb,
+            static_cast<const int8_t *>(A), &lda, &beta, C, &ldc, co);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
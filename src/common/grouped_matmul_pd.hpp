@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GROUPED_MATMUL_PD_HPP
+#define COMMON_GROUPED_MATMUL_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/grouped_matmul_utils.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_GROUPED_MATMUL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, grouped_matmul, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_GROUPED_MATMUL_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, grouped_matmul, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+// NOLINTBEGIN(google-default-arguments)
+struct grouped_matmul_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::grouped_matmul;
+
+    using base_class = grouped_matmul_pd_t;
+    using hint_class = grouped_matmul_pd_t;
+
+    const grouped_matmul_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_GROUP_OFFSETS)
+                || is_group_weights_arg(arg))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        if (is_group_weights_arg(arg)) return weights_md(0);
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_GROUP_OFFSETS: return src_md(1);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &offsets_md_;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.weights_desc : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2 + (int)ngroups(); }
+    int n_outputs() const override { return 1; }
+
+    dim_t ngroups() const { return desc_.ngroups; }
+    dim_t M() const { return desc_.M(); }
+    dim_t K() const { return desc_.K(); }
+    dim_t N() const { return desc_.N(); }
+
+protected:
+    grouped_matmul_desc_t desc_;
+    memory_desc_t offsets_md_;
+
+    grouped_matmul_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<grouped_matmul_desc_t>(adesc))
+        , offsets_md_(types::zero_md()) {
+        const dims_t offsets_dims = {ngroups() + 1};
+        memory_desc_init_by_tag(
+                offsets_md_, 1, offsets_dims, data_type::s32, format_tag::a);
+    }
+
+    bool set_default_formats() {
+        for (auto md :
+                {&desc_.src_desc, &desc_.weights_desc, &desc_.dst_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any()
+                    && memory_desc_init_by_tag(*md, format_tag::ab)
+                            != status::success)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    bool is_group_weights_arg(int arg) const {
+        return arg >= DNNL_ARG_GROUP_WEIGHTS(0)
+                && arg < DNNL_ARG_GROUP_WEIGHTS(ngroups());
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,37 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/grouped_matmul_pd.hpp"
+#include "common/grouped_matmul_types.hpp"
+#include "common/grouped_matmul_utils.hpp"
+#include "common/primitive_desc_iface.hpp"
+
+using dnnl::impl::status_t;
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API grouped_matmul_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t wei_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_dim_t ngroups,
+        const_dnnl_primitive_attr_t attr) {
+    CHECK(grouped_matmul_desc_check(src_desc, wei_desc, dst_desc, ngroups));
+
+    auto desc = create_grouped_matmul_desc(
+            src_desc, wei_desc, dst_desc, ngroups);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&desc, nullptr, attr);
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GROUPED_MATMUL_TYPES_HPP
+#define COMMON_GROUPED_MATMUL_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Row offsets of the groups in the source and the destination: an s32 array
+// of `ngroups + 1` values, group `g` owns rows [offsets[g], offsets[g + 1]).
+#define DNNL_ARG_GROUP_OFFSETS DNNL_ARG_SRC_1
+// Weights of group `g`. Each group has its own weights memory object.
+#define DNNL_ARG_GROUP_WEIGHTS(g) (DNNL_ARG_MULTIPLE_SRC + (g))
+
+// A descriptor for a grouped matrix multiplication operation.
+//
+// The source and the destination are ragged batches: all groups are stacked
+// along the rows and the number of rows of every group is defined at
+// execution time by the group offsets. Every group is multiplied by its own
+// weights, all of them are described by a single weights memory descriptor:
+//   dst[offsets[g]:offsets[g + 1], :]
+//           = src[offsets[g]:offsets[g + 1], :] * weights[g].
+struct grouped_matmul_desc_t : public op_desc_t {
+    grouped_matmul_desc_t() : op_desc_t(primitive_kind::grouped_matmul) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<grouped_matmul_desc_t>(*this);
+    }
+
+    memory_desc_t src_desc; /* {M, K}, all groups stacked */
+    memory_desc_t weights_desc; /* {K, N}, weights of a single group */
+    memory_desc_t dst_desc; /* {M, N}, all groups stacked */
+    dim_t ngroups {};
+
+    // Total number of rows of all groups.
+    dim_t M() const { return src_desc.dims[0]; }
+    dim_t K() const { return src_desc.dims[1]; }
+    dim_t N() const { return dst_desc.dims[1]; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_GROUPED_MATMUL_TYPES_HPP
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GROUPED_MATMUL_UTILS_HPP
+#define COMMON_GROUPED_MATMUL_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/grouped_matmul_types.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_GROUPED_MATMUL(f, msg, ...) \
+    VCHECK(primitive, create, check, grouped_matmul, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_GROUPED_MATMUL_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, grouped_matmul, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+// Maximal number of groups, limited by the range of DNNL_ARG_MULTIPLE_SRC
+// arguments used for the weights of the groups.
+constexpr dim_t grouped_matmul_max_groups
+        = DNNL_ARG_MULTIPLE_DST - DNNL_ARG_MULTIPLE_SRC;
+
+static inline status_t grouped_matmul_desc_check(const memory_desc_t *src_md,
+        const memory_desc_t *wei_md, const memory_desc_t *dst_md,
+        dim_t ngroups) {
+    VCHECK_GROUPED_MATMUL_COND(
+            utils::everyone_is(2, src_md->ndims, wei_md->ndims, dst_md->ndims),
+            VERBOSE_BAD_NDIMS, "src", src_md->ndims);
+    VCHECK_GROUPED_MATMUL_COND(src_md->dims[1] == wei_md->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "weights", 0);
+    VCHECK_GROUPED_MATMUL_COND(dst_md->dims[0] == src_md->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+    VCHECK_GROUPED_MATMUL_COND(dst_md->dims[1] == wei_md->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "weights", 1);
+    VCHECK_GROUPED_MATMUL_COND(
+            ngroups > 0 && ngroups <= grouped_matmul_max_groups,
+            "number of groups (%ld) must be in [1, %ld]", (long)ngroups,
+            (long)grouped_matmul_max_groups);
+
+    return status::success;
+}
+
+// Group offsets are passed at execution time, so implementations validate
+// them right before the computations: offsets must be non-decreasing and stay
+// within the rows of the source.
+static inline status_t grouped_matmul_offsets_check(
+        const int32_t *offsets, dim_t ngroups, dim_t M) {
+    if (offsets == nullptr) return status::invalid_arguments;
+    for (dim_t g = 0; g <= ngroups; g++) {
+        const dim_t lo = g == 0 ? 0 : offsets[g - 1];
+        if (offsets[g] < lo || offsets[g] > M)
+            return status::invalid_arguments;
+    }
+    return status::success;
+}
+
+static inline grouped_matmul_desc_t create_grouped_matmul_desc(
+        const memory_desc_t *src_md, const memory_desc_t *wei_md,
+        const memory_desc_t *dst_md, dim_t ngroups) {
+    auto desc = grouped_matmul_desc_t();
+    desc.primitive_kind = primitive_kind::grouped_matmul;
+    desc.src_desc = *src_md;
+    desc.weights_desc = *wei_md;
+    desc.dst_desc = *dst_md;
+    desc.ngroups = ngroups;
+    return desc;
+}
+
+static inline status_t create_grouped_matmul_pd(
+        std::shared_ptr<primitive_desc_t> &grouped_matmul_pd, engine_t *engine,
+        const memory_desc_t *src_md, const memory_desc_t *wei_md,
+        const memory_desc_t *dst_md, dim_t ngroups,
+        const primitive_attr_t *attr) {
+    CHECK(grouped_matmul_desc_check(src_md, wei_md, dst_md, ngroups));
+
+    auto desc = create_grouped_matmul_desc(src_md, wei_md, dst_md, ngroups);
+    primitive_attr_t pd_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&desc, &pd_attr, nullptr);
+
+    grouped_matmul_pd = *(++it);
+    VCHECK_GROUPED_MATMUL_COND(
+            grouped_matmul_pd, "failed to create the grouped matmul primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -80,6 +80,10 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(layer_normalization),
             CASE(group_normalization),
             CASE(sdpa),
+            CASE(grouped_matmul),
+            CASE(rope),
+            CASE(embedding_bag),
+            CASE(top_k),
     };
 #undef CASE
     int kind_idx = (int)kind;
@@ -51,7 +51,8 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
     VCHECK_LNORM((flags
                          & ~(normalization_flags::use_global_stats
                                  | normalization_flags::use_scale
-                                 | normalization_flags::use_shift))
+                                 | normalization_flags::use_shift
+                                 | normalization_flags::rms_norm))
                     == 0,
             VERBOSE_BAD_FLAGS);
 
@@ -80,22 +81,42 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
                            .has_runtime_dims_or_strides()
                 || memory_desc_wrapper(diff_dst_desc)
                            .has_runtime_dims_or_strides();
-    VCONDCHECK(primitive, create, check, lnorm, !runtime_dims_or_strides,
-            status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // Forward propagation allows the outermost dimension to be defined at
+    // execution time.
+    const bool runtime_mb_only = is_fwd
+            && memory_desc_wrapper(src_desc).has_runtime_mb_only()
+            && memory_desc_wrapper(dst_desc).has_runtime_mb_only()
+            && IMPLICATION(stat_desc,
+                    memory_desc_wrapper(stat_desc).has_runtime_mb_only());
+    VCONDCHECK(primitive, create, check, lnorm,
+            !runtime_dims_or_strides || runtime_mb_only, status::unimplemented,
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     ld.src_desc = *src_desc;
     if (is_fwd) ld.dst_desc = *dst_desc;
     if (!is_fwd) ld.diff_src_desc = *diff_src_desc;
     if (!is_fwd) ld.diff_dst_desc = *diff_dst_desc;
 
-    if (stat_desc)
+    if (stat_desc) {
         ld.stat_desc = *stat_desc;
-    else
+    } else if (runtime_dims_or_strides) {
+        // Format `any` is not allowed with runtime dimensions, so the
+        // statistics follow the layout of plain src right away.
+        const auto &src_blk = src_desc->format_desc.blocking;
+        VCHECK_LNORM_UNIMPL(src_desc->format_kind == format_kind::blocked
+                        && src_blk.inner_nblks == 0,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        ld.stat_desc = *src_desc;
+        ld.stat_desc.ndims = src_desc->ndims - 1;
+        ld.stat_desc.data_type = data_type::f32;
+        CHECK(memory_desc_init_by_blocking_desc(ld.stat_desc, src_blk));
+    } else {
         VCHECK_LNORM(
                 memory_desc_init_by_tag(ld.stat_desc, ld.src_desc.ndims - 1,
                         ld.src_desc.dims, data_type::f32, format_tag::any)
                         == success,
                 VERBOSE_UNSUPPORTED_TAG_S, "stats");
+    }
 
     int ndims = src_desc->ndims;
     ld.data_scaleshift_desc = zero_md();
@@ -39,6 +39,7 @@ struct layer_normalization_fwd_pd_t;
 
 struct layer_normalization_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::layer_normalization;
+    static constexpr bool supports_runtime_dims = false;
 
     const layer_normalization_desc_t *desc() const { return &desc_; }
     const op_desc_t *op_desc() const override {
@@ -84,6 +85,10 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & normalization_flags::use_global_stats;
     }
+    // RMS normalization: the mean is neither computed nor used.
+    bool skip_mean() const {
+        return desc_.flags & normalization_flags::rms_norm;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -99,6 +104,9 @@ struct layer_normalization_pd_t : public primitive_desc_t {
 
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
+    // Number of statistics tensors: the mean (unless skipped) and variance.
+    int n_stats() const { return skip_mean() ? 1 : 2; }
+
 protected:
     layer_normalization_desc_t desc_;
     const layer_normalization_fwd_pd_t *hint_fwd_pd_;
@@ -165,6 +173,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_are_src()) return arg_usage_t::input;
             if (!stats_are_src() && is_training()) return arg_usage_t::output;
@@ -214,14 +223,14 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scale() + use_shift()
+        return 1 + n_stats() * stats_are_src() + use_scale() + use_shift()
                 + n_binary_po_inputs();
     }
     int n_outputs() const override {
-        // Originally as '1 + 2 * (!stats_are_src()) * is_training()',
+        // Originally as '1 + n_stats() * (!stats_are_src()) * is_training()',
         // had to be worked around MSVC bug not copying inlined bodies
         // of stats_are_src() and is_training().
-        return (!stats_are_src() && is_training()) ? 3 : 1;
+        return (!stats_are_src() && is_training()) ? 1 + n_stats() : 1;
     }
 
 protected:
@@ -276,6 +285,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     using hint_class = layer_normalization_fwd_pd_t;
 
     arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
         if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE,
                     DNNL_ARG_DIFF_DST))
             return arg_usage_t::input;
@@ -337,7 +347,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_scaleshift_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 4 + use_scale(); }
+    int n_inputs() const override { return 2 + n_stats() + use_scale(); }
     int n_outputs() const override {
         return 1
                 + (desc_.prop_kind == prop_kind::backward)
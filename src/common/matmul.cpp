@@ -50,7 +50,8 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     const data_type_t dst_dt = desc.dst_desc.data_type;
 
     auto attr_mask = smask_t::post_ops | smask_t::sum_dt | smask_t::dropout
-            | smask_t::rounding_mode;
+            | smask_t::rounding_mode | smask_t::weights_paging
+            | smask_t::src_dyn_quant;
     // Matmul supports scales for floating point data types
     attr_mask |= smask_t::scales_data_type;
 
@@ -273,6 +274,46 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
                 VERBOSE_UNSUPPORTED_ZP_CFG);
     }
 
+    // Check weights paging
+    if (!attr->weights_paging_.has_default_values()) {
+        const memory_desc_wrapper wei_d(desc.weights_desc);
+        // The page layout is defined by the weights strides, so they must be
+        // known at creation time.
+        VCHECK_MATMUL(
+                wei_d.is_plain() && !wei_d.has_runtime_dims_or_strides(),
+                VERBOSE_UNSUPPORTED_TAG);
+        VCHECK_MATMUL_UNIMPL(wei_d.sub_byte_data_type_multiplier() == 1,
+                VERBOSE_UNSUPPORTED_DT);
+    }
+
+    // Check source dynamic quantization
+    if (!attr->src_dyn_quant_.has_default_values()) {
+        using namespace data_type;
+        // A floating-point source is quantized into int8 and multiplied by
+        // int8 weights, the result is returned in floating point.
+        VCHECK_MATMUL_UNIMPL(utils::one_of(src_dt, f32, bf16, f16)
+                        && wei_dt == s8
+                        && utils::one_of(dst_dt, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        // Source scales are computed by the implementation, and the
+        // quantization is symmetric.
+        VCHECK_MATMUL_UNIMPL(attr->scales_.has_default_values(DNNL_ARG_SRC)
+                        && attr->zero_points_.has_default_values(DNNL_ARG_SRC)
+                        && attr->zero_points_.has_default_values(
+                                DNNL_ARG_WEIGHTS),
+                VERBOSE_UNSUPPORTED_ATTR);
+        // Weights scales are applied to the int32 result, so they may only
+        // vary along N.
+        VCHECK_MATMUL_UNIMPL(
+                IMPLICATION(!attr->scales_.has_default_values(DNNL_ARG_WEIGHTS),
+                        (attr->scales_.get_mask(DNNL_ARG_WEIGHTS)
+                                & ~wei_qmask_N)
+                                == 0),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_MATMUL_UNIMPL(!attr->fpmath_.apply_to_int_,
+                VERBOSE_UNSUPPORTED_FPMATH_MODE);
+    }
+
     // Check post-ops
     if (!attr->post_ops_.has_default_values()) {
         const auto &po = attr->post_ops_;
@@ -45,6 +45,18 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
         const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
         const memory_desc_t *bias_desc, const memory_desc_t *dst_desc);
 
+// Paged weights are split along the outer of the K and N dimensions, which is
+// defined by the strides or, when the strides are equal, by the non-unit
+// dimension.
+inline bool matmul_weights_paged_by_K(const memory_desc_t &wei_md) {
+    const int ndims = wei_md.ndims;
+    const auto &strides = wei_md.format_desc.blocking.strides;
+    const dim_t K_stride = strides[ndims - 2];
+    const dim_t N_stride = strides[ndims - 1];
+    return K_stride != N_stride ? K_stride > N_stride
+                                : wei_md.dims[ndims - 2] > 1;
+}
+
 // NOLINTBEGIN(google-default-arguments)
 struct matmul_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::matmul;
@@ -79,6 +91,8 @@ struct matmul_pd_t : public primitive_desc_t {
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             case DNNL_ARG_REDUCE: return reduce_md(0);
+            case DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE:
+                return &weights_page_table_md_;
             default: return primitive_desc_t::arg_md(arg);
         }
     }
@@ -142,6 +156,30 @@ struct matmul_pd_t : public primitive_desc_t {
     dim_t N() const { return dst_md_.dims[ndims() - 1]; }
     dim_t K() const { return src_md_.dims[ndims() - 1]; }
 
+    bool with_src_dyn_quant() const {
+        return !attr()->src_dyn_quant_.has_default_values();
+    }
+
+    bool with_paged_weights() const {
+        return !attr()->weights_paging_.has_default_values();
+    }
+    dim_t weights_page_size() const {
+        return attr()->weights_paging_.page_size_;
+    }
+    bool weights_paged_by_K() const {
+        return matmul_weights_paged_by_K(desc_.weights_desc);
+    }
+    // Distance between the pages of the weights in elements.
+    dim_t weights_page_stride() const {
+        const auto &strides = desc_.weights_desc.format_desc.blocking.strides;
+        return weights_page_size()
+                * strides[ndims() - 2 + !weights_paged_by_K()];
+    }
+    dim_t weights_n_pages() const {
+        return utils::div_up(
+                weights_paged_by_K() ? K() : N(), weights_page_size());
+    }
+
     bool is_bias_1xN() const {
         if (!with_bias()) return false;
 
@@ -251,6 +289,7 @@ protected:
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
     memory_desc_t reduce_md_;
+    memory_desc_t weights_page_table_md_;
 
     matmul_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const matmul_pd_t *hint_fwd_pd)
@@ -260,7 +299,16 @@ protected:
         , weights_md_(desc_.weights_desc)
         , bias_md_(desc_.bias_desc)
         , dst_md_(desc_.dst_desc)
-        , reduce_md_(desc_.reduce_desc) {}
+        , reduce_md_(desc_.reduce_desc)
+        , weights_page_table_md_(types::zero_md()) {
+        if (with_paged_weights()) {
+            const dims_t page_table_dims = {
+                    utils::array_product(weights_md_.dims, ndims() - 2),
+                    weights_n_pages()};
+            memory_desc_init_by_tag(weights_page_table_md_, 2, page_table_dims,
+                    data_type::s32, format_tag::ab);
+        }
+    }
 
     // temporary solution to deal with format `any`
     bool set_default_formats() {
@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <condition_variable>
+#include <mutex>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -32,6 +34,10 @@
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/packed_weights_cache.hpp"
+#endif
+
 using namespace dnnl::impl;
 using namespace dnnl::impl::utils;
 using namespace dnnl::impl::status;
@@ -62,12 +68,30 @@ size_t memory_desc_map_size(const memory_desc_t *md, int index = 0) {
 
     return mdw.size(index, true, true);
 }
+
+// Pending uses of all memory objects are signaled through a single condition
+// variable: waits are rare and only happen when the host touches memory still
+// used by an asynchronous stream.
+std::mutex &pending_uses_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::condition_variable &pending_uses_cv() {
+    static std::condition_variable cv;
+    return cv;
+}
 } // namespace
 
 dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
         const dnnl::impl::memory_desc_t *md, const std::vector<unsigned> &flags,
         const std::vector<void *> &handles)
-    : engine_(engine), md_(*md), counter_(1) {
+    : engine_(engine)
+    , md_(*md)
+    , counter_(1)
+    , id_(next_id())
+    , generation_(0)
+    , pending_uses_(0) {
 
     const size_t nhandles = handles.size();
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> mem_storages(
@@ -87,7 +111,12 @@ dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
 dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
         const dnnl::impl::memory_desc_t *md,
         std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage)
-    : engine_(engine), md_(*md), counter_(1) {
+    : engine_(engine)
+    , md_(*md)
+    , counter_(1)
+    , id_(next_id())
+    , generation_(0)
+    , pending_uses_(0) {
     this->reset_memory_storage(std::move(memory_storage));
 }
 
@@ -98,10 +127,14 @@ dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
     : engine_(engine)
     , md_(*md)
     , memory_storages_(std::move(memory_storages))
-    , counter_(1) {}
+    , counter_(1)
+    , id_(next_id())
+    , generation_(0)
+    , pending_uses_(0) {}
 
 status_t dnnl_memory::set_data_handle(void *handle, int index) const {
     using namespace dnnl::impl;
+    wait_pending_uses();
     void *old_handle;
     auto *ms = memory_storage(index);
     if (!ms) return status::invalid_arguments;
@@ -109,9 +142,42 @@ status_t dnnl_memory::set_data_handle(void *handle, int index) const {
     if (handle != old_handle) {
         CHECK(memory_storage(index)->set_data_handle(handle));
     }
+    notify_data_written();
     return status::success;
 }
 
+dnnl_memory::~dnnl_memory() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    cpu::packed_weights_cache().drop(id_);
+#endif
+}
+
+uint64_t dnnl_memory::next_id() {
+    static std::atomic<uint64_t> id {0};
+    return ++id;
+}
+
+void dnnl_memory::release_pending_use() const {
+    // Taking the lock orders the update with a concurrent waiter checking the
+    // counter, otherwise the notification may be lost.
+    std::lock_guard<std::mutex> lock(pending_uses_mutex());
+    if (--pending_uses_ == 0) pending_uses_cv().notify_all();
+}
+
+void dnnl_memory::wait_pending_uses() const {
+    if (pending_uses_ == 0) return;
+    std::unique_lock<std::mutex> lock(pending_uses_mutex());
+    pending_uses_cv().wait(lock, [this] { return pending_uses_ == 0; });
+}
+
+void dnnl_memory::notify_data_written() const {
+    generation_++;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (engine_->kind() == engine_kind::cpu)
+        cpu::packed_weights_cache().drop(id_);
+#endif
+}
+
 status_t dnnl_memory::reset_memory_storage(
         std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage) {
     if (memory_storage) {
@@ -131,6 +197,7 @@ status_t dnnl_memory::reset_memory_storage(
             memory_storages_[0].reset(memory_storage_ptr);
     }
 
+    notify_data_written();
     return status::success;
 }
 
@@ -230,6 +297,8 @@ status_t dnnl_memory_get_data_handle(const memory_t *memory, void **handle) {
         *handle = nullptr;
         return success;
     }
+    // The data may be written through the returned pointer.
+    memory->notify_data_written();
     return memory->get_data_handle(handle);
 }
 
@@ -246,6 +315,8 @@ status_t dnnl_memory_get_data_handle_v2(
         *handle = nullptr;
         return success;
     }
+    // The data may be written through the returned pointer.
+    memory->notify_data_written();
     return memory->get_data_handle(handle, index);
 }
 
@@ -274,6 +345,7 @@ status_t dnnl_memory_map_data_v2(
         return invalid_arguments;
     }
 
+    memory->wait_pending_uses();
     return memory->memory_storage(index)->map_data(
             mapped_ptr, nullptr, map_size);
 }
@@ -284,6 +356,8 @@ status_t dnnl_memory_unmap_data_v2(
     VCHECK_MEMORY((index >= 0 && index < (int)memory->get_num_handles()),
             invalid_arguments, VERBOSE_INVALID_MEM_IDX);
 
+    // The data may have been modified through the mapped pointer.
+    memory->notify_data_written();
     return memory->memory_storage(index)->unmap_data(mapped_ptr, nullptr);
 }
 
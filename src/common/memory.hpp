@@ -18,6 +18,7 @@
 #define COMMON_MEMORY_HPP
 
 #include <assert.h>
+#include <atomic>
 #include <memory>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -96,6 +97,26 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
 
     size_t get_num_handles() const { return memory_storages_.size(); }
 
+    /** returns a value unique across memory objects. */
+    uint64_t id() const { return id_; }
+
+    /** returns the generation of the data behind the memory object. It
+     * changes whenever the data may have been written: when the data handle
+     * is set or queried, when the memory is unmapped and when it is passed as
+     * an output to a primitive. */
+    uint64_t generation() const { return generation_; }
+
+    /** starts a new generation of the data, which invalidates the data
+     * derived from it, e.g. weights packed by CPU primitives. */
+    void notify_data_written() const;
+
+    /** tracks executions enqueued to asynchronous streams that use the
+     * memory. Accessing the data from the host through the API (mapping the
+     * memory, changing the data handle) waits for these executions. */
+    void add_pending_use() const { pending_uses_++; }
+    void release_pending_use() const;
+    void wait_pending_uses() const;
+
     void retain() { counter_++; }
 
     void release() {
@@ -103,7 +124,7 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
     }
 
 protected:
-    virtual ~dnnl_memory() = default;
+    virtual ~dnnl_memory();
 
     dnnl::impl::engine_t *engine_;
     const dnnl::impl::memory_desc_t md_;
@@ -115,6 +136,11 @@ private:
     // Number of storages is larger than 1 only for sparse memory.
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> memory_storages_;
     std::atomic<int> counter_;
+    const uint64_t id_;
+    mutable std::atomic<uint64_t> generation_;
+    mutable std::atomic<int> pending_uses_;
+
+    static uint64_t next_id();
 };
 
 namespace dnnl {
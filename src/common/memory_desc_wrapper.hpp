@@ -386,6 +386,15 @@ struct memory_desc_wrapper : public c_compatible {
         return has_runtime_dims() || has_runtime_strides();
     }
 
+    /** returns true if the outermost (minibatch) dim is the only unknown dim
+     * and the strides are known */
+    bool has_runtime_mb_only() const {
+        if (ndims() == 0 || dims()[0] != DNNL_RUNTIME_DIM_VAL) return false;
+        for (int d = 1; d < ndims(); ++d)
+            if (dims()[d] == DNNL_RUNTIME_DIM_VAL) return false;
+        return !has_runtime_strides() && offset0() != DNNL_RUNTIME_DIM_VAL;
+    }
+
     /** returns true if the only (potentially) padded dim is \param dim */
     bool only_padded_dim(int dim) const {
         if (has_runtime_dims()) return false;
@@ -167,6 +167,7 @@ enum {
     key_brgemm_primitive_zp_comp_a,
     key_brgemm_primitive_zp_comp_b,
     key_brgemm_primitive_buffer_reduce,
+    key_brgemm_primitive_src_dyn_quant_scales,
     key_concat_iptrs,
     key_concat_istrides,
     key_concat_nelems,
@@ -251,6 +252,10 @@ enum {
     key_gnorm_reduction,
     key_gnorm_tmp_mean,
     key_gnorm_tmp_var,
+    key_grouped_matmul_a_buffer,
+    key_grouped_matmul_b_buffer,
+    key_grouped_matmul_c_buffer,
+    key_grouped_matmul_tasks,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -317,10 +322,17 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_k_buffer,
+    key_sdpa_q_buffer,
+    key_sdpa_score,
+    key_sdpa_stats,
+    key_sdpa_v_buffer,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_top_k_heap,
     key_wino_U,
     key_wino_V,
     key_wino_M,
@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "common/persistent_cache.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+namespace {
+
+// File layout: magic, ID size, ID, blob size, blob. Sizes are uint64_t.
+constexpr char magic[] = "DNNLPC01";
+constexpr size_t magic_size = sizeof(magic) - 1;
+
+std::string entry_path(const std::vector<uint8_t> &id) {
+    size_t seed = id.size();
+    for (const auto b : id)
+        seed = hash_combine(seed, b);
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.blob", (unsigned long long)seed);
+    return get_dir() + "/" + name;
+}
+
+bool read_size(FILE *f, uint64_t &size) {
+    return fread(&size, sizeof(size), 1, f) == 1;
+}
+
+bool write_entry(const std::string &path, const std::vector<uint8_t> &id,
+        const std::vector<uint8_t> &blob) {
+#ifdef _WIN32
+    const int pid = _getpid();
+#else
+    const int pid = getpid();
+#endif
+    // Write to a temporary file first and rename it afterwards so that
+    // concurrent readers (possibly from other processes) never observe a
+    // partially written entry.
+    const std::string tmp_path = path + ".tmp." + std::to_string(pid);
+    FILE *f = fopen(tmp_path.c_str(), "wb");
+    if (!f) return false;
+
+    const uint64_t id_size = id.size();
+    const uint64_t blob_size = blob.size();
+    bool ok = fwrite(magic, 1, magic_size, f) == magic_size
+            && fwrite(&id_size, sizeof(id_size), 1, f) == 1
+            && fwrite(id.data(), 1, id.size(), f) == id.size()
+            && fwrite(&blob_size, sizeof(blob_size), 1, f) == 1
+            && fwrite(blob.data(), 1, blob.size(), f) == blob.size();
+    ok = (fclose(f) == 0) && ok;
+
+    if (ok) ok = std::rename(tmp_path.c_str(), path.c_str()) == 0;
+    if (!ok) std::remove(tmp_path.c_str());
+    return ok;
+}
+
+// Serves write requests in order on a single background thread. The thread
+// is started lazily and the pending requests are flushed on destruction.
+struct writer_t {
+    writer_t() = default;
+    ~writer_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) thread_.join();
+    }
+
+    void push(std::string &&path, std::vector<uint8_t> &&id,
+            std::vector<uint8_t> &&blob) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back({std::move(path), std::move(id), std::move(blob)});
+            if (!thread_.joinable()) thread_ = std::thread([this] { run(); });
+        }
+        cv_.notify_one();
+    }
+
+private:
+    struct request_t {
+        std::string path;
+        std::vector<uint8_t> id, blob;
+    };
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) return;
+            request_t req = std::move(queue_.front());
+            queue_.pop_front();
+            lock.unlock();
+            if (!write_entry(req.path, req.id, req.blob))
+                VWARN(common, common,
+                        "persistent cache: failed to write entry %s",
+                        req.path.c_str());
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<request_t> queue_;
+    std::thread thread_;
+    bool stop_ = false;
+
+    writer_t(const writer_t &) = delete;
+    writer_t &operator=(const writer_t &) = delete;
+};
+
+} // namespace
+
+const std::string &get_dir() {
+    static const std::string dir
+            = getenv_string_user("PERSISTENT_CACHE_DIR", /* to_lower = */ false);
+    return dir;
+}
+
+bool load(const std::vector<uint8_t> &id, std::vector<uint8_t> &blob) {
+    if (!is_enabled() || id.empty()) return false;
+
+    const std::string path = entry_path(id);
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    // The entry size is validated up front to not trust sizes read from a
+    // truncated or foreign file.
+    bool ok = fseek(f, 0, SEEK_END) == 0;
+    const long file_size = ok ? ftell(f) : -1L;
+    ok = ok && file_size > 0 && fseek(f, 0, SEEK_SET) == 0;
+
+    char file_magic[magic_size];
+    uint64_t id_size = 0, blob_size = 0;
+    std::vector<uint8_t> file_id;
+    ok = ok && fread(file_magic, 1, magic_size, f) == magic_size
+            && std::memcmp(file_magic, magic, magic_size) == 0
+            && read_size(f, id_size) && id_size == id.size();
+    if (ok) {
+        file_id.resize(id_size);
+        ok = fread(file_id.data(), 1, file_id.size(), f) == file_id.size()
+                && file_id == id && read_size(f, blob_size) && blob_size > 0
+                && blob_size
+                        == (uint64_t)file_size - magic_size
+                                - 2 * sizeof(uint64_t) - id_size;
+    }
+    if (ok) {
+        blob.resize(blob_size);
+        ok = fread(blob.data(), 1, blob.size(), f) == blob.size();
+    }
+    fclose(f);
+
+    if (!ok) blob.clear();
+    return ok;
+}
+
+void store(const std::vector<uint8_t> &id, std::vector<uint8_t> &&blob) {
+    if (!is_enabled() || id.empty() || blob.empty()) return;
+
+    std::string path = entry_path(id);
+#ifdef _WIN32
+    // Joining a thread from a static destructor may deadlock on DLL unload,
+    // so entries are written synchronously on Windows.
+    if (!write_entry(path, id, blob))
+        VWARN(common, common, "persistent cache: failed to write entry %s",
+                path.c_str());
+#else
+    static writer_t writer;
+    writer.push(std::move(path), std::vector<uint8_t>(id), std::move(blob));
+#endif
+}
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_CACHE_HPP
+#define COMMON_PERSISTENT_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+// On-disk storage of cache blobs keyed by cache blob IDs. The storage is
+// opt-in and is enabled by setting ONEDNN_PERSISTENT_CACHE_DIR to an existing
+// directory. Each entry is kept in a separate file named after a hash of the
+// ID; the full ID is stored in the file as well to resolve hash collisions.
+//
+// Only GPU primitives provide cache blobs, so the storage is not used for
+// CPU primitives.
+
+// Returns the cache directory or an empty string if the cache is disabled.
+DNNL_API const std::string &get_dir();
+
+inline bool is_enabled() {
+    return !get_dir().empty();
+}
+
+// Reads the blob stored for `id`. Returns false if there is no valid entry.
+DNNL_API bool load(
+        const std::vector<uint8_t> &id, std::vector<uint8_t> &blob);
+
+// Schedules writing of `blob` for `id`. The write happens on a background
+// thread, so the call does not block primitive creation on file IO.
+DNNL_API void store(
+        const std::vector<uint8_t> &id, std::vector<uint8_t> &&blob);
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -122,6 +122,10 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             (bool)(~mask & smask_t::dropout), dropout_.has_default_values()));
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::rounding_mode),
             rounding_mode_.has_default_values()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::weights_paging),
+            weights_paging_.has_default_values()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::src_dyn_quant),
+            src_dyn_quant_.has_default_values()));
     CHECK_ARG(this->defined(smask_t::none));
     bool fpmath_mode_ok = IMPLICATION(
             (bool)(~mask & smask_t::fpmath_mode) && fpmath_.apply_to_int_,
@@ -355,6 +359,20 @@ status_t primitive_attr_t::set_dropout(const memory_desc_t *user_dropout_desc) {
     return success;
 }
 
+status_t primitive_attr_t::set_weights_paging(dim_t page_size) {
+    VCONDCHECK(primitive, create, check, attr, page_size > 0,
+            invalid_arguments, VERBOSE_BAD_PARAM, "page_size");
+    weights_paging_.page_size_ = page_size;
+    return success;
+}
+
+status_t primitive_attr_t::set_src_dyn_quant(data_type_t data_type) {
+    VCONDCHECK(primitive, create, check, attr, data_type == data_type::s8,
+            invalid_arguments, VERBOSE_BAD_PARAM, "data_type");
+    src_dyn_quant_.data_type_ = data_type;
+    return success;
+}
+
 status_t primitive_attr_t::set_fpmath_mode(
         fpmath_mode_t fpmath_mode, bool apply_to_int) {
     auto st = check_fpmath_mode(fpmath_mode);
@@ -441,6 +459,32 @@ status_t dnnl_primitive_attr_set_dropout(
     return attr->set_dropout(user_dropout_desc);
 }
 
+status_t dnnl_primitive_attr_get_weights_paging(
+        const primitive_attr_t *attr, dim_t *page_size) {
+    if (any_null(attr, page_size)) return invalid_arguments;
+    *page_size = attr->weights_paging_.page_size_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_weights_paging(
+        primitive_attr_t *attr, dim_t page_size) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_weights_paging(page_size);
+}
+
+status_t dnnl_primitive_attr_get_src_dynamic_quantization(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->src_dyn_quant_.data_type_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_dynamic_quantization(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_src_dyn_quant(data_type);
+}
+
 status_t dnnl_primitive_attr_get_fpmath_mode(
         const primitive_attr_t *attr, fpmath_mode_t *mode) {
     if (any_null(attr, mode)) return invalid_arguments;
@@ -198,6 +198,35 @@ struct dropout_t : public c_compatible {
     dnnl::impl::memory_desc_t user_dropout_desc_;
 };
 
+// Weights split into pages of `page_size_` rows along the outer of the two
+// innermost dimensions. The pages live in a pool and are located at execution
+// time with a page table.
+struct weights_paging_t : public c_compatible {
+    weights_paging_t() = default;
+
+    bool has_default_values() const { return page_size_ == 0; }
+    bool operator==(const weights_paging_t &rhs) const {
+        return page_size_ == rhs.page_size_;
+    }
+
+    dnnl::impl::dim_t page_size_ = 0;
+};
+
+// Floating-point source quantized at execution time into `data_type_` with
+// symmetric scales computed per row of the source.
+struct src_dyn_quant_t : public c_compatible {
+    src_dyn_quant_t() = default;
+
+    bool has_default_values() const {
+        return data_type_ == dnnl::impl::data_type::undef;
+    }
+    bool operator==(const src_dyn_quant_t &rhs) const {
+        return data_type_ == rhs.data_type_;
+    }
+
+    dnnl::impl::data_type_t data_type_ = dnnl::impl::data_type::undef;
+};
+
 struct rnd_mode_t : public c_compatible {
     rnd_mode_t() = default;
 
@@ -557,6 +586,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         CHECK(rnn_tparams_.copy_from(other.rnn_tparams_));
         if (other.gpu_attr_) gpu_attr_ = other.gpu_attr_->clone();
         dropout_ = other.dropout_;
+        weights_paging_ = other.weights_paging_;
+        src_dyn_quant_ = other.src_dyn_quant_;
 
         return status::success;
     }
@@ -582,6 +613,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_mode = 1u << 15,
         dropout = 1u << 16,
         rounding_mode = 1u << 17,
+        weights_paging = 1u << 18,
+        src_dyn_quant = 1u << 19,
     };
 
     /** Returns true if the attributes have default values.
@@ -608,7 +641,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                             && gpu_attr_->is_equal(*rhs.gpu_attr_))
                         || (!gpu_attr_ && !rhs.gpu_attr_))
                 && dropout_ == rhs.dropout_
-                && rounding_mode_ == rhs.rounding_mode_;
+                && rounding_mode_ == rhs.rounding_mode_
+                && weights_paging_ == rhs.weights_paging_
+                && src_dyn_quant_ == rhs.src_dyn_quant_;
         return ret;
     }
 
@@ -618,6 +653,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
             dnnl::impl::accumulation_mode_t am);
     dnnl::impl::status_t set_dropout(
             const dnnl::impl::memory_desc_t *dropout_desc);
+    dnnl::impl::status_t set_weights_paging(dnnl::impl::dim_t page_size);
+    dnnl::impl::status_t set_src_dyn_quant(dnnl::impl::data_type_t data_type);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
@@ -684,6 +721,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::rnn_tparams_t rnn_tparams_;
     dnnl::impl::dropout_t dropout_;
     dnnl::impl::rnd_mode_t rounding_mode_;
+    dnnl::impl::weights_paging_t weights_paging_;
+    dnnl::impl::src_dyn_quant_t src_dyn_quant_;
 
     std::unique_ptr<dnnl::impl::primitive_attr_item_t> gpu_attr_;
 
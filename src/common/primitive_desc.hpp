@@ -59,6 +59,11 @@ struct primitive_desc_t : public c_compatible {
 
     bool is_initialized() const { return is_initialized_; }
 
+    // Primitive kinds that have been historically limited to static shapes
+    // reset this flag in their base descriptor, so only the implementations
+    // that set it back explicitly get descriptors with runtime dimensions.
+    static constexpr bool supports_runtime_dims = true;
+
     virtual ~primitive_desc_t() = default;
     virtual primitive_desc_t *clone() const = 0;
 
@@ -175,6 +180,10 @@ struct primitive_desc_t : public c_compatible {
         if (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
             return !attr()->dropout_.has_default_values() ? arg_usage_t::input
                                                           : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE)
+            return !attr()->weights_paging_.has_default_values()
+                    ? arg_usage_t::input
+                    : arg_usage_t::unused;
         if (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
             return !attr()->rounding_mode_.has_default_values()
                     ? arg_usage_t::input
@@ -477,6 +486,8 @@ protected:
         auto _pd = make_unique_pd<pd_t>(adesc, attr, hint);
         if (_pd == nullptr) return out_of_memory;
         if (!_pd->is_initialized()) return out_of_memory;
+        if (!pd_t::supports_runtime_dims && _pd->has_runtime_dims_or_strides())
+            return unimplemented;
         CHECK(_pd->init(engine));
         CHECK(_pd->init_scratchpad_md());
         return safe_ptr_assign(*pd, _pd.release());
@@ -64,10 +64,14 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                                         | DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
                         || (arg == DNNL_ARG_ATTR_DROPOUT_PROBABILITY)
                         || (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
-                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED);
+                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
+                        || (arg == DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE);
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 args[arg] = {mem, false};
+                // Invalidates data derived from the previous memory content,
+                // e.g. packed weights cached by CPU primitives.
+                mem->notify_data_written();
                 n_outputs++;
                 extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
                         || (arg == DNNL_ARG_ATTR_DROPOUT_MASK);
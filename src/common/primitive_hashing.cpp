@@ -83,8 +83,10 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
+            CASE(grouped_matmul)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
@@ -95,10 +97,12 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(rope)
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(top_k)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -307,6 +311,13 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = hash_combine(
                 seed, get_md_hash(attr.dropout_.user_dropout_desc_));
     }
+    if (!attr.weights_paging_.has_default_values()) {
+        seed = hash_combine(seed, attr.weights_paging_.page_size_);
+    }
+    if (!attr.src_dyn_quant_.has_default_values()) {
+        seed = hash_combine(
+                seed, static_cast<size_t>(attr.src_dyn_quant_.data_type_));
+    }
     // Combined hash for attributes
     return seed;
 }
@@ -749,6 +760,66 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const grouped_matmul_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, desc.ngroups);
+    // Combined hash for grouped matmul desc
+    return seed;
+}
+
+size_t get_desc_hash(const rope_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.cos_desc));
+    seed = hash_combine(seed, get_md_hash(desc.sin_desc));
+    seed = hash_combine(seed, get_md_hash(desc.positions_desc));
+    // Layout of the rotated pairs
+    seed = hash_combine(seed, static_cast<size_t>(desc.layout));
+    // Combined hash for rope desc
+    return seed;
+}
+
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.table_desc));
+    seed = hash_combine(seed, get_md_hash(desc.sample_weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding bag desc
+    return seed;
+}
+
+size_t get_desc_hash(const top_k_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Axis and the number of selected values
+    seed = hash_combine(seed, desc.axis);
+    seed = hash_combine(seed, desc.k);
+    // Combined hash for top-k desc
+    return seed;
+}
+
 } // namespace primitive_hashing
 } // namespace impl
 } // namespace dnnl
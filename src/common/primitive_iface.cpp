@@ -24,7 +24,10 @@
 #endif
 
 #include "cache_hit_types.hpp"
+#include "exec_stats.hpp"
+#include "persistent_cache.hpp"
 #include "primitive.hpp"
+#include "primitive_cache.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
 #include "primitive_iface.hpp"
@@ -54,6 +57,47 @@ void unpoison_outputs(const exec_args_t &args) {
         msan_unpoison(p, s);
     }
 }
+
+// Creates a primitive consulting the persistent cache directory (if enabled)
+// when no cache blob is provided by the user. On a miss the primitive is
+// created as usual and its cache blob is written back.
+status_t create_primitive_iface(
+        std::pair<primitive_iface_t *, cache_state_t> &p_iface,
+        const primitive_desc_iface_t *pd_iface,
+        const cache_blob_t &cache_blob) {
+    // CPU primitives are generated at creation and provide no cache blobs.
+    if (cache_blob || !persistent_cache::is_enabled()
+            || pd_iface->engine()->kind() != engine_kind::gpu
+            || is_pd_in_cache(pd_iface))
+        return pd_iface->create_primitive_iface(p_iface, cache_blob);
+
+    // The ID is empty for GPU runtimes that don't support cache blobs.
+    const auto &id = pd_iface->impl()->get_cache_blob_id(pd_iface->engine());
+    if (id.empty())
+        return pd_iface->create_primitive_iface(p_iface, cache_blob);
+
+    std::vector<uint8_t> blob;
+    if (persistent_cache::load(id, blob)) {
+        cache_blob_t cb(blob.data(), blob.size());
+        if (pd_iface->create_primitive_iface(p_iface, cb) == success) {
+            p_iface.second = cache_state_t::persistent_hit;
+            return success;
+        }
+        // A stale entry is overwritten below.
+    }
+
+    CHECK(pd_iface->create_primitive_iface(p_iface, cache_blob));
+    if (p_iface.second != cache_state_t::miss) return success;
+
+    size_t size = 0;
+    if (p_iface.first->get_cache_blob_size(&size) == success && size > 0) {
+        blob.resize(size);
+        if (p_iface.first->get_cache_blob(cache_blob_t(blob.data(), size))
+                == success)
+            persistent_cache::store(id, std::move(blob));
+    }
+    return success;
+}
 } // namespace
 
 namespace dnnl {
@@ -68,8 +112,8 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
     if (get_verbose(verbose_t::create_profile,
                 prim_kind2_comp_kind(primitive_desc_iface->impl()->kind()))) {
         double start_ms = get_msec();
-        CHECK(primitive_desc_iface->create_primitive_iface(
-                p_iface, cache_blob));
+        CHECK(create_primitive_iface(
+                p_iface, primitive_desc_iface, cache_blob));
         double duration_ms = get_msec() - start_ms;
 
         if (cache_blob) p_iface.second = cache_state_t::persistent_hit;
@@ -78,8 +122,8 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
         VPROF(start_ms, primitive, create, str, p_iface.first->pd()->info(),
                 duration_ms);
     } else {
-        CHECK(primitive_desc_iface->create_primitive_iface(
-                p_iface, cache_blob));
+        CHECK(create_primitive_iface(
+                p_iface, primitive_desc_iface, cache_blob));
     }
     return safe_ptr_assign((*primitive_iface), p_iface.first);
 }
@@ -127,6 +171,18 @@ status_t primitive_execute(
             VPROF(start_ms, primitive, exec, VERBOSE_profile,
                     primitive_iface->pd()->info(), duration_ms);
         }
+        if (status == success && exec_stats::is_enabled())
+            exec_stats::record(primitive_iface->pd()->impl().get(),
+                    primitive_iface->pd()->info(), ctx, duration_ms);
+    } else if (exec_stats::is_enabled()) {
+        // Unlike the profiling mode, the stream is not synchronized, so the
+        // time of asynchronous executions covers their submission only.
+        double start_ms = get_msec();
+        status = stream->enqueue_primitive(primitive_iface, ctx);
+        double duration_ms = get_msec() - start_ms;
+        if (status == success)
+            exec_stats::record(primitive_iface->pd()->impl().get(),
+                    primitive_iface->pd()->info(), ctx, duration_ms);
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
@@ -278,6 +334,7 @@ dnnl_primitive::~dnnl_primitive() {
         scratchpad_debug::unprotect_scratchpad_buffer(
                 scratchpad_->get_memory_storage(), registry);
     }
+    exec_stats::retire(pd_->impl().get());
 }
 
 status_t dnnl_primitive::init() {
@@ -66,6 +66,13 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
+    // Returns true if the primitive uses the scratchpad shared by all the
+    // primitives created by the same thread. Such primitives must not run
+    // concurrently with other primitives created by the same thread.
+    bool use_global_scratchpad() const {
+        return scratchpad_ && scratchpad_->is_global();
+    }
+
     void retain() { counter_++; }
 
     void release() {
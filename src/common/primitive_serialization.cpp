@@ -35,8 +35,10 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gemm)
         CASE(group_normalization)
+        CASE(grouped_matmul)
         CASE(inner_product)
         CASE(layer_normalization)
         CASE(lrn)
@@ -47,10 +49,12 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(rope)
         CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(top_k)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -212,6 +216,16 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
         serialize(sstream, attr.dropout_.user_dropout_desc_);
     }
 
+    if (!attr.weights_paging_.has_default_values()) {
+        sstream.append('p');
+        sstream.append(attr.weights_paging_.page_size_);
+    }
+
+    if (!attr.src_dyn_quant_.has_default_values()) {
+        sstream.append('q');
+        sstream.append(attr.src_dyn_quant_.data_type_);
+    }
+
     serialize(sstream, attr.post_ops_);
 
     // rnn_data_qparams: scale, shift
@@ -591,5 +605,49 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     sstream.append(desc.mask_type);
 }
 
+void serialize(
+        serialization_stream_t &sstream, const grouped_matmul_desc_t &desc) {
+    // Kind
+    sstream.append(desc.primitive_kind);
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.weights_desc);
+    serialize(sstream, desc.dst_desc);
+    sstream.append(desc.ngroups);
+}
+
+void serialize(serialization_stream_t &sstream, const rope_desc_t &desc) {
+    // Kind
+    sstream.append(desc.primitive_kind);
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.cos_desc);
+    serialize(sstream, desc.sin_desc);
+    serialize(sstream, desc.positions_desc);
+    sstream.append(desc.layout);
+}
+
+void serialize(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.table_desc);
+    serialize(sstream, desc.sample_weights_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
+void serialize(serialization_stream_t &sstream, const top_k_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.indices_desc);
+    sstream.append(desc.axis);
+    sstream.append(desc.k);
+}
+
 } // namespace impl
 } // namespace dnnl
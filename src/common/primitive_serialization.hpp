@@ -34,6 +34,8 @@ void serialize(serialization_stream_t &sstream,
 void serialize(serialization_stream_t &sstream, const binary_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const convolution_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const eltwise_desc_t &desc);
+void serialize(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const gemm_desc_t &desc);
 void serialize(serialization_stream_t &sstream,
         const group_normalization_desc_t &desc);
@@ -43,15 +45,19 @@ void serialize(serialization_stream_t &sstream,
         const layer_normalization_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const lrn_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const matmul_desc_t &desc);
+void serialize(
+        serialization_stream_t &sstream, const grouped_matmul_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const pooling_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const prelu_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const reduction_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const rope_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const reorder_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const resampling_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const rnn_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const shuffle_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const top_k_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sum_desc_t &desc);
 
 status_t serialize_desc(
@@ -410,6 +410,9 @@ status_t rnn_common_bwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                            diff_weights_iter_desc, diff_dst_layer_desc),
             VERBOSE_NULL_ARG);
 
+    // variable-length sequences are supported for forward propagation only
+    VCONDCHECK_RNN(!(flags & rnn_flags::variable_length), VERBOSE_BAD_FLAGS);
+
     if (cell_kind == dnnl_vanilla_rnn) {
         VCONDCHECK_RNN(one_of(activation, eltwise_relu, eltwise_tanh,
                                eltwise_logistic),
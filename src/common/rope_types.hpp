@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_TYPES_HPP
+#define COMMON_ROPE_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Cosine and sine of the rotation angles: f32 tables of `{max_positions,
+// rotary_dim / 2}` values, row `p` holds the angles of position `p`.
+#define DNNL_ARG_ROPE_COS DNNL_ARG_SRC_1
+#define DNNL_ARG_ROPE_SIN DNNL_ARG_SRC_2
+// Position of the first token of every sequence in the batch: an s32 array of
+// `batch` values. Token `s` of sequence `b` is rotated by the angles of
+// position `positions[b] + s`. Used for the decode phase with a KV cache.
+#define DNNL_ARG_ROPE_POSITIONS DNNL_ARG_SRC_3
+
+// Defines which elements of the head are rotated together.
+enum class rope_layout_t : int {
+    // Pairs are adjacent elements: (x[2i], x[2i + 1]), as in GPT-J.
+    interleaved = 0,
+    // Pairs are elements from the two halves of the rotary dimension:
+    // (x[i], x[i + rotary_dim / 2]), as in GPT-NeoX and LLaMA.
+    half_split = 1,
+};
+
+// A descriptor for a rotary positional embedding (RoPE) operation.
+//
+// The first `rotary_dim` elements of every head are rotated pairwise by the
+// angles of the token position, the rest of the head is passed through:
+//   dst[x0] = src[x0] * cos[p][i] - src[x1] * sin[p][i]
+//   dst[x1] = src[x1] * cos[p][i] + src[x0] * sin[p][i],
+// where (x0, x1) is the i-th pair defined by the layout.
+struct rope_desc_t : public op_desc_t {
+    rope_desc_t() : op_desc_t(primitive_kind::rope) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<rope_desc_t>(*this);
+    }
+
+    memory_desc_t src_desc; /* {batch, heads, seq_len, head_size} */
+    memory_desc_t dst_desc; /* {batch, heads, seq_len, head_size} */
+    memory_desc_t cos_desc; /* {max_positions, rotary_dim / 2} */
+    memory_desc_t sin_desc; /* {max_positions, rotary_dim / 2} */
+    memory_desc_t positions_desc; /* {batch}, optional */
+    rope_layout_t layout {rope_layout_t::half_split};
+
+    dim_t batch() const { return src_desc.dims[0]; }
+    dim_t heads() const { return src_desc.dims[1]; }
+    dim_t seq_len() const { return src_desc.dims[2]; }
+    dim_t head_size() const { return src_desc.dims[3]; }
+    dim_t rotary_dim() const { return 2 * cos_desc.dims[1]; }
+    dim_t max_positions() const { return cos_desc.dims[0]; }
+    bool with_positions() const { return positions_desc.ndims != 0; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_ROPE_TYPES_HPP
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_UTILS_HPP
+#define COMMON_ROPE_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/rope_types.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_ROPE(f, msg, ...) \
+    VCHECK(primitive, create, check, rope, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_ROPE_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, rope, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+static inline status_t rope_desc_check(const memory_desc_t *src_md,
+        const memory_desc_t *cos_md, const memory_desc_t *sin_md,
+        const memory_desc_t *positions_md, const memory_desc_t *dst_md) {
+    const bool with_positions = positions_md && positions_md->ndims != 0;
+
+    VCHECK_ROPE_COND(utils::everyone_is(4, src_md->ndims, dst_md->ndims),
+            VERBOSE_BAD_NDIMS, "src", src_md->ndims);
+    VCHECK_ROPE_COND(utils::everyone_is(2, cos_md->ndims, sin_md->ndims),
+            VERBOSE_BAD_NDIMS, "cos", cos_md->ndims);
+    for (int d = 0; d < 4; d++)
+        VCHECK_ROPE_COND(src_md->dims[d] == dst_md->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "src", d, "dst", d);
+    for (int d = 0; d < 2; d++)
+        VCHECK_ROPE_COND(cos_md->dims[d] == sin_md->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "cos", d, "sin", d);
+    VCHECK_ROPE_COND(
+            cos_md->dims[1] > 0 && 2 * cos_md->dims[1] <= src_md->dims[3],
+            "rotary dimension (%ld) must be in [2, %ld]",
+            (long)(2 * cos_md->dims[1]), (long)src_md->dims[3]);
+    VCHECK_ROPE_COND(
+            utils::everyone_is(data_type::f32, cos_md->data_type,
+                    sin_md->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    if (with_positions) {
+        VCHECK_ROPE_COND(positions_md->ndims == 1, VERBOSE_BAD_NDIMS,
+                "positions", positions_md->ndims);
+        VCHECK_ROPE_COND(positions_md->dims[0] == src_md->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "positions", 0, "src", 0);
+        VCHECK_ROPE_COND(positions_md->data_type == data_type::s32,
+                VERBOSE_UNSUPPORTED_DT);
+    } else {
+        VCHECK_ROPE_COND(src_md->dims[2] <= cos_md->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "src", 2, "cos", 0);
+    }
+
+    return status::success;
+}
+
+// Positions are passed at execution time, so implementations validate them
+// right before the computations: all the tokens must stay within the tables.
+static inline status_t rope_positions_check(const int32_t *positions,
+        dim_t batch, dim_t seq_len, dim_t max_positions) {
+    if (positions == nullptr) return status::success;
+    for (dim_t b = 0; b < batch; b++) {
+        if (positions[b] < 0 || positions[b] + seq_len > max_positions)
+            return status::invalid_arguments;
+    }
+    return status::success;
+}
+
+static inline rope_desc_t create_rope_desc(const memory_desc_t *src_md,
+        const memory_desc_t *cos_md, const memory_desc_t *sin_md,
+        const memory_desc_t *positions_md, const memory_desc_t *dst_md,
+        rope_layout_t layout) {
+    auto desc = rope_desc_t();
+    desc.primitive_kind = primitive_kind::rope;
+    desc.src_desc = *src_md;
+    desc.dst_desc = *dst_md;
+    desc.cos_desc = *cos_md;
+    desc.sin_desc = *sin_md;
+    desc.positions_desc = positions_md ? *positions_md : types::zero_md();
+    desc.layout = layout;
+    return desc;
+}
+
+static inline status_t create_rope_pd(
+        std::shared_ptr<primitive_desc_t> &rope_pd, engine_t *engine,
+        const memory_desc_t *src_md, const memory_desc_t *cos_md,
+        const memory_desc_t *sin_md, const memory_desc_t *positions_md,
+        const memory_desc_t *dst_md, rope_layout_t layout,
+        const primitive_attr_t *attr) {
+    CHECK(rope_desc_check(src_md, cos_md, sin_md, positions_md, dst_md));
+
+    auto desc = create_rope_desc(
+            src_md, cos_md, sin_md, positions_md, dst_md, layout);
+    primitive_attr_t pd_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&desc, &pd_attr, nullptr);
+
+    rope_pd = *(++it);
+    VCHECK_ROPE_COND(rope_pd, "failed to create the rope primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
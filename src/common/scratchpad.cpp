@@ -122,6 +122,8 @@ struct global_scratchpad_t : public scratchpad_t {
 
     size_t size() const override { return size_; }
 
+    bool is_global() const override { return true; }
+
 private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(global_scratchpad_t);
     thread_local static memory_storage_t *mem_storage_;
@@ -28,6 +28,9 @@ struct scratchpad_t {
     virtual ~scratchpad_t() = default;
     virtual const memory_storage_t *get_memory_storage() const = 0;
     virtual size_t size() const = 0;
+    // A global scratchpad is shared by all the primitives created by the
+    // same thread.
+    virtual bool is_global() const { return false; }
 };
 
 scratchpad_t *create_scratchpad(
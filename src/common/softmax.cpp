@@ -72,8 +72,14 @@ status_t softmax_desc_init(softmax_desc_t *softmax_desc, prop_kind_t prop_kind,
                 || memory_desc_wrapper(diff_dst_desc)
                            .has_runtime_dims_or_strides();
     }
-    VCONDCHECK(primitive, create, check, softmax, !runtime_dims_or_strides,
-            status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // Forward propagation allows the outermost dimension to be defined at
+    // execution time unless it is the softmax axis.
+    const bool runtime_mb_only = is_fwd && softmax_axis != 0
+            && memory_desc_wrapper(src_desc).has_runtime_mb_only()
+            && memory_desc_wrapper(dst_desc).has_runtime_mb_only();
+    VCONDCHECK(primitive, create, check, softmax,
+            !runtime_dims_or_strides || runtime_mb_only, status::unimplemented,
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     auto sd = softmax_desc_t();
     sd.primitive_kind = primitive_kind::softmax;
@@ -38,6 +38,7 @@ struct softmax_fwd_pd_t;
 
 struct softmax_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::softmax;
+    static constexpr bool supports_runtime_dims = false;
 
     const softmax_desc_t *desc() const { return &desc_; }
     const op_desc_t *op_desc() const override {
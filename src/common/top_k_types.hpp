@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOP_K_TYPES_HPP
+#define COMMON_TOP_K_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Positions of the selected values along the axis: an s32 tensor of the same
+// shape as the values.
+#define DNNL_ARG_TOP_K_INDICES DNNL_ARG_DST_1
+
+// A descriptor for a top-k operation.
+//
+// Selects `k` largest (reduction_max) or smallest (reduction_min) values of
+// the source along the axis and returns them together with their positions:
+//   dst[..., j, ...] = src[..., indices[..., j, ...], ...], j in [0, k).
+// The selected values are sorted: the best value goes first. Equal values are
+// ordered by their positions, the lower position wins. Argmax and argmin are
+// the top-k operation with `k` equal to one.
+struct top_k_desc_t : public op_desc_t {
+    top_k_desc_t() : op_desc_t(primitive_kind::top_k) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<top_k_desc_t>(*this);
+    }
+
+    alg_kind_t alg_kind {};
+    memory_desc_t src_desc;
+    memory_desc_t dst_desc; /* src dims with k at the axis */
+    memory_desc_t indices_desc; /* dst dims */
+    int axis {};
+    dim_t k {};
+
+    dim_t axis_size() const { return src_desc.dims[axis]; }
+    // Number of independent rows the selection is done for.
+    dim_t nrows() const {
+        dim_t n = 1;
+        for (int d = 0; d < src_desc.ndims; d++)
+            if (d != axis) n *= src_desc.dims[d];
+        return n;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_TOP_K_TYPES_HPP
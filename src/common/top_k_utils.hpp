@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOP_K_UTILS_HPP
+#define COMMON_TOP_K_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/top_k_types.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_TOP_K(f, msg, ...) \
+    VCHECK(primitive, create, check, top_k, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_TOP_K_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, top_k, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+static inline status_t top_k_desc_check(alg_kind_t alg_kind,
+        const memory_desc_t *src_md, const memory_desc_t *dst_md,
+        const memory_desc_t *indices_md, int axis, dim_t k) {
+    using namespace data_type;
+    const int ndims = src_md->ndims;
+
+    VCHECK_TOP_K_COND(utils::one_of(alg_kind, alg_kind::reduction_max,
+                              alg_kind::reduction_min),
+            VERBOSE_BAD_ALGORITHM);
+    VCHECK_TOP_K_COND(ndims > 0, VERBOSE_BAD_NDIMS, "src", ndims);
+    VCHECK_TOP_K_COND(
+            utils::everyone_is(ndims, dst_md->ndims, indices_md->ndims),
+            VERBOSE_INCONSISTENT_NDIMS, "src", "dst");
+    VCHECK_TOP_K_COND(0 <= axis && axis < ndims, VERBOSE_BAD_AXIS);
+    VCHECK_TOP_K_COND(0 < k && k <= src_md->dims[axis],
+            "k (%ld) must be in [1, %ld]", (long)k, (long)src_md->dims[axis]);
+    for (int d = 0; d < ndims; d++) {
+        const dim_t expected = d == axis ? k : src_md->dims[d];
+        VCHECK_TOP_K_COND(dst_md->dims[d] == expected,
+                VERBOSE_INCONSISTENT_DIM, "dst", d, "src", d);
+        VCHECK_TOP_K_COND(indices_md->dims[d] == dst_md->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "indices", d, "dst", d);
+    }
+    VCHECK_TOP_K_COND(utils::one_of(src_md->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_TOP_K_COND(utils::one_of(dst_md->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_TOP_K_COND(indices_md->data_type == s32, VERBOSE_UNSUPPORTED_DT);
+
+    return status::success;
+}
+
+static inline top_k_desc_t create_top_k_desc(alg_kind_t alg_kind,
+        const memory_desc_t *src_md, const memory_desc_t *dst_md,
+        const memory_desc_t *indices_md, int axis, dim_t k) {
+    auto desc = top_k_desc_t();
+    desc.primitive_kind = primitive_kind::top_k;
+    desc.alg_kind = alg_kind;
+    desc.src_desc = *src_md;
+    desc.dst_desc = *dst_md;
+    desc.indices_desc = *indices_md;
+    desc.axis = axis;
+    desc.k = k;
+    return desc;
+}
+
+static inline status_t create_top_k_pd(
+        std::shared_ptr<primitive_desc_t> &top_k_pd, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_md,
+        const memory_desc_t *dst_md, const memory_desc_t *indices_md,
+        int axis, dim_t k, const primitive_attr_t *attr) {
+    CHECK(top_k_desc_check(alg_kind, src_md, dst_md, indices_md, axis, k));
+
+    auto desc = create_top_k_desc(
+            alg_kind, src_md, dst_md, indices_md, axis, k);
+    primitive_attr_t pd_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&desc, &pd_attr, nullptr);
+
+    top_k_pd = *(++it);
+    VCHECK_TOP_K_COND(top_k_pd, "failed to create the top-k primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
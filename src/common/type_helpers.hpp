@@ -27,9 +27,13 @@
 #include "c_types_map.hpp"
 #include "dnnl_traits.hpp"
 #include "gemm_types.hpp"
+#include "embedding_bag_types.hpp"
+#include "grouped_matmul_types.hpp"
 #include "memory_desc.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
+#include "rope_types.hpp"
+#include "top_k_types.hpp"
 #include "sdpa_types.hpp"
 #include "utils.hpp"
 
@@ -988,6 +992,50 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(
+        const grouped_matmul_desc_t &lhs, const grouped_matmul_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(weights_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(ngroups);
+    return ret;
+}
+
+inline bool operator==(const rope_desc_t &lhs, const rope_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(cos_desc)
+            && COMPARE_DESC_MEMBERS(sin_desc)
+            && COMPARE_DESC_MEMBERS(positions_desc)
+            && COMPARE_DESC_MEMBERS(layout);
+    return ret;
+}
+
+inline bool operator==(
+        const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(table_desc)
+            && COMPARE_DESC_MEMBERS(sample_weights_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
+inline bool operator==(const top_k_desc_t &lhs, const top_k_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(axis)
+            && COMPARE_DESC_MEMBERS(k);
+    return ret;
+}
+
 // clang-format on
 
 #undef COMPARE_DESC_MEMBERS
@@ -1269,6 +1317,24 @@ inline bool is_runtime_value(dim_t val) {
     return val == DNNL_RUNTIME_DIM_VAL;
 }
 
+/** returns a copy of \param md with the runtime minibatch (outermost)
+ * dimension set to \param mb; used to check the layout of descriptors
+ * with runtime minibatch */
+inline memory_desc_t memory_desc_with_mb(const memory_desc_t &md, dim_t mb) {
+    memory_desc_t md_mb = md;
+    if (md.ndims == 0 || !is_runtime_value(md.dims[0])) return md_mb;
+
+    dim_t mb_blk = 1;
+    if (md.format_kind == format_kind::blocked) {
+        const auto &bd = md.format_desc.blocking;
+        for (int iblk = 0; iblk < bd.inner_nblks; ++iblk)
+            if (bd.inner_idxs[iblk] == 0) mb_blk *= bd.inner_blks[iblk];
+    }
+    md_mb.dims[0] = mb;
+    md_mb.padded_dims[0] = utils::rnd_up(mb, mb_blk);
+    return md_mb;
+}
+
 inline bool memory_desc_sanity_check(int ndims, const dims_t dims,
         data_type_t data_type, format_kind_t format_kind) {
     using namespace data_type;
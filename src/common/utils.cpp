@@ -36,6 +36,7 @@
 #include <cstring>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -109,19 +110,21 @@ int getenv_int_user(const char *name, int default_value) {
     return value;
 }
 
-std::string getenv_string_user(const char *name) {
-    // Random number to fit possible string input.
+std::string getenv_string_user(const char *name, bool to_lower) {
     std::string value;
-    const int len = 128;
-    char value_str[len];
     for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
         std::string name_str = std::string(prefix) + std::string(name);
-        if (getenv(name_str.c_str(), value_str, len) > 0) {
-            value = value_str;
+        // A negative value is the length of the value string.
+        const int len = -getenv(name_str.c_str(), nullptr, 0);
+        if (len <= 0) continue;
+        std::vector<char> value_str(len + 1);
+        if (getenv(name_str.c_str(), value_str.data(), len + 1) > 0) {
+            value = value_str.data();
             break;
         }
     }
-    std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+    if (to_lower)
+        std::transform(value.begin(), value.end(), value.begin(), ::tolower);
     return value;
 }
 
@@ -684,8 +684,9 @@ int getenv_int(const char *name, int default_value = 0);
 int getenv_int_user(const char *name, int default_value = 0);
 // Reads a string literal from user environment. Takes a var name without
 // prefix and checks both supported variants - with "ONEDNN_" (primary) and
-// "DNNL_" (secondary) prefixes.
-std::string getenv_string_user(const char *name);
+// "DNNL_" (secondary) prefixes. The value is converted to lower case unless
+// 'to_lower' is false, e.g. for file paths.
+std::string getenv_string_user(const char *name, bool to_lower = true);
 
 // Various getter for profiling info
 bool get_jit_dump();
@@ -41,8 +41,10 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
+#include "grouped_matmul_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
@@ -53,9 +55,11 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "rope_pd.hpp"
 #include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
+#include "top_k_pd.hpp"
 #include "sum_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -359,12 +363,14 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::use_shift) s += "H";
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
+    if (flags & normalization_flags::rms_norm) s += "M";
     return s;
 }
 
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
+    if (flags & rnn_flags::variable_length) s += "V";
     return s;
 }
 
@@ -816,6 +822,16 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             default: assert(!"unsupported format_kind");
         }
     }
+
+    if (!attr->weights_paging_.has_default_values()) {
+        ss << field_delim()
+           << "attr-weights-paging:" << attr->weights_paging_.page_size_;
+    }
+
+    if (!attr->src_dyn_quant_.has_default_values()) {
+        ss << field_delim() << "attr-src-dyn-quant:"
+           << attr->src_dyn_quant_.data_type_;
+    }
     return ss;
 }
 
@@ -959,7 +975,7 @@ std::string init_info_convolution(const engine_t *e, const pd_t *pd) {
     ss << "alg:" << pd->desc()->alg_kind << ",";
 
     if (pd->with_groups()) ss << "g" << pd->G();
-    ss << "mb" << pd->MB() << "_"
+    ss << "mb" << get_val_str(pd->MB()) << "_"
        << "ic" << pd->IC() << "oc" << pd->OC() << "_";
     if (pd->ndims() >= 5)
         ss << "id" << pd->ID() << "od" << (has_fused_dw ? pd->ID() : pd->OD())
@@ -1592,6 +1608,79 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_grouped_matmul(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->src_md(), format_kind::undef) << " ";
+    ss << md2fmt_str("wei", pd->weights_md(), format_kind::undef) << " ";
+    ss << md2fmt_str("dst", pd->dst_md(), format_kind::undef);
+    ss << "," << pd->attr() << ",";
+    ss << "groups:" << pd->ngroups() << ",";
+    ss << "m" << pd->M() << "k" << pd->K() << "n" << pd->N();
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_rope(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->src_md(), format_kind::undef) << " ";
+    ss << md2fmt_str("cos", pd->src_md(1), format_kind::undef) << " ";
+    ss << md2fmt_str("sin", pd->src_md(2), format_kind::undef) << " ";
+    if (pd->with_positions())
+        ss << md2fmt_str("pos", pd->src_md(3), format_kind::undef) << " ";
+    ss << md2fmt_str("dst", pd->dst_md(), format_kind::undef);
+    ss << "," << pd->attr() << ",";
+    ss << "layout:" << (pd->is_interleaved() ? "interleaved" : "half_split")
+       << ",";
+    ss << md2dim_str(pd->src_md()) << ":r" << pd->rotary_dim();
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("indices", pd->src_md(0), format_kind::undef) << " ";
+    ss << md2fmt_str("offsets", pd->src_md(1), format_kind::undef) << " ";
+    if (pd->with_sample_weights())
+        ss << md2fmt_str("sw", pd->src_md(2), format_kind::undef) << " ";
+    ss << md2fmt_str("table", pd->weights_md(), format_kind::undef) << " ";
+    ss << md2fmt_str("dst", pd->dst_md(), format_kind::undef);
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->alg_kind() << ",";
+    ss << "mb" << pd->batch() << "nnz" << pd->nnz() << ":"
+       << md2dim_str(pd->weights_md());
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_top_k(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->src_md(), format_kind::undef) << " ";
+    ss << md2fmt_str("dst", pd->dst_md(0), format_kind::undef) << " ";
+    ss << md2fmt_str("indices", pd->dst_md(1), format_kind::undef);
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->alg_kind() << " axis:" << pd->axis()
+       << " k:" << pd->k() << ",";
+    ss << md2dim_str(pd->src_md());
+
+    return ss.str();
+}
+
 } // namespace
 
 std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
@@ -1724,8 +1813,10 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gemm);
             CASE(group_normalization);
+            CASE(grouped_matmul);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
@@ -1736,9 +1827,11 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
+            CASE(top_k);
             CASE(sdpa);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
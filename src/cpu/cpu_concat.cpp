@@ -20,6 +20,11 @@
 #include "cpu/ref_concat.hpp"
 #include "cpu/simple_concat.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_uni_concat.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -29,6 +34,7 @@ using namespace dnnl::impl::data_type;
 #define INSTANCE(...) \
     impl_list_item_t(impl_list_item_t::concat_type_deduction_helper_t< \
             __VA_ARGS__::pd_t>()),
+#define CONCAT_INSTANCE_AVX2(...) REG_AVX2_ISA(INSTANCE(__VA_ARGS__))
 // clang-format off
 constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
         INSTANCE(simple_concat_t<f32>)
@@ -37,10 +43,12 @@ constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
         INSTANCE(simple_concat_t<s32>)
         INSTANCE(simple_concat_t<bf16>)
         INSTANCE(simple_concat_t<f16>)
+        CONCAT_INSTANCE_AVX2(jit_uni_concat_t)
         INSTANCE(ref_concat_t)
         nullptr,
 });
 // clang-format on
+#undef CONCAT_INSTANCE_AVX2
 #undef INSTANCE
 } // namespace
 
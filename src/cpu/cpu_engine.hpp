@@ -25,7 +25,12 @@
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
+#include "common/embedding_bag_types.hpp"
+#include "common/grouped_matmul_types.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/rope_types.hpp"
+#include "common/top_k_types.hpp"
+#include "common/sdpa_types.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -58,7 +63,9 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
 DECLARE_IMPL_LIST(group_normalization);
+DECLARE_IMPL_LIST(grouped_matmul);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
 DECLARE_IMPL_LIST(lrn);
@@ -68,8 +75,11 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(rope);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(top_k);
 
 #undef DECLARE_IMPL_LIST
 
@@ -94,7 +104,9 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(group_normalization);
+            CASE(grouped_matmul);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
@@ -104,9 +116,11 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
-            case primitive_kind::sdpa: return empty_list;
+            CASE(top_k);
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
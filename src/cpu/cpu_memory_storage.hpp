@@ -89,6 +89,8 @@ protected:
     status_t init_allocate(size_t size) override {
         void *ptr = malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
+        if (platform::is_numa_first_touch_enabled())
+            platform::numa_first_touch(ptr, size);
         data_ = decltype(data_)(ptr, destroy);
         return status::success;
     }
@@ -18,13 +18,18 @@
 #define CPU_CPU_PRIMITIVE_HPP
 
 #include <assert.h>
+#include <initializer_list>
+#include <utility>
 
 #include "oneapi/dnnl/dnnl_types.h"
 
 #include "common/c_types_map.hpp"
 #include "common/primitive_attr.hpp"
+#include "common/memory_desc_wrapper.hpp"
 #include "common/primitive_exec_types.hpp"
+#include "common/type_helpers.hpp"
 #include "common/utils.hpp"
+#include "common/verbose.hpp"
 #include "common/z_magic.hpp"
 
 #include "cpu/ref_io_helper.hpp"
@@ -138,4 +143,34 @@
 
 //NOLINTEND(bugprone-macro-parentheses)
 
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Returns the minibatch of the memories passed at execution time to a
+// primitive created with a runtime minibatch. `args` pairs the argument
+// indices with the descriptors from the primitive descriptor. All memories
+// must have the same minibatch, and the rest of their layout must match the
+// primitive descriptor.
+inline status_t get_runtime_mb(const exec_ctx_t &ctx,
+        std::initializer_list<std::pair<int, const memory_desc_t *>> args,
+        dim_t &mb) {
+    mb = DNNL_RUNTIME_DIM_VAL;
+    for (const auto &arg : args) {
+        const memory_desc_t &pd_md = *arg.second;
+        const memory_desc_wrapper mdw = ctx.memory_mdw(arg.first, &pd_md);
+        if (mdw.ndims() == 0) continue;
+        if (is_runtime_value(mb)) mb = mdw.dims()[0];
+        VCONDCHECK(primitive, exec, check, primitive,
+                *mdw.md_ == memory_desc_with_mb(pd_md, mb),
+                status::invalid_arguments, VERBOSE_RUNTIMEDIM_INCONSISTENT,
+                0);
+    }
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
 #endif // CPU_CPU_PRIMITIVE_HPP
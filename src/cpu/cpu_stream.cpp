@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2023-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <unordered_set>
+
+#include "common/memory.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/cpu_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+cpu_stream_t::cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
+    : stream_t(engine, stream_impl) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    is_async_ = flags() & stream_flags::out_of_order;
+    nthr_ = dnnl_get_max_threads();
+#endif
+}
+
+cpu_stream_t::~cpu_stream_t() {
+    if (!worker_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    task_cv_.notify_one();
+    worker_.join();
+}
+
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    // The pending executions were completed when the synchronous scope began.
+    if (!is_async_ || sync_depth_ > 0)
+        return stream_t::enqueue_primitive(primitive_iface, ctx);
+
+    // Primitives sharing the global scratchpad of the calling thread cannot
+    // run on the worker concurrently with the caller, so they are executed
+    // synchronously once the preceding executions complete.
+    if (primitive_iface->use_global_scratchpad()) {
+        VINFO(primitive, exec, check, primitive,
+                "primitive with a global scratchpad is executed "
+                "synchronously on an out-of-order stream");
+        CHECK(wait());
+        return stream_t::enqueue_primitive(primitive_iface, ctx);
+    }
+
+    task_t task;
+    task.primitive_iface = const_cast<primitive_iface_t *>(primitive_iface);
+    task.ctx = utils::make_unique<exec_ctx_t>(ctx, exec_args_t(ctx.args()));
+    if (!task.ctx) return status::out_of_memory;
+
+    // The primitive and the memory objects are kept alive until the execution
+    // completes, even if the user releases them right after the submission.
+    std::unordered_set<memory_t *> memories;
+    for (const auto &arg : ctx.args())
+        if (arg.second.mem) memories.insert(arg.second.mem);
+    task.memories.assign(memories.begin(), memories.end());
+
+    task.primitive_iface->retain();
+    for (auto *mem : task.memories) {
+        mem->retain();
+        mem->add_pending_use();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!worker_.joinable())
+            worker_ = std::thread(&cpu_stream_t::worker_loop, this);
+        queue_.push_back(std::move(task));
+        n_pending_++;
+    }
+    task_cv_.notify_one();
+
+    return status::success;
+}
+
+status_t cpu_stream_t::begin_sync_scope() {
+    sync_depth_++;
+    return wait();
+}
+
+void cpu_stream_t::end_sync_scope() {
+    assert(sync_depth_ > 0);
+    sync_depth_--;
+}
+
+status_t cpu_stream_t::wait() {
+    // Synchronous execution returns only once the primitive completes.
+    if (!is_async_) return status::success;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return n_pending_ == 0; });
+    const status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+void cpu_stream_t::worker_loop() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // OpenMP settings of the thread creating the stream are not inherited by
+    // the worker thread.
+    omp_set_num_threads(nthr_);
+#endif
+
+    for (;;) {
+        task_t task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            // The destructor waits for the completion of all the executions
+            // before stopping the worker.
+            if (queue_.empty()) return;
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        const status_t status = task.primitive_iface->execute(*task.ctx);
+
+        for (auto *mem : task.memories) {
+            mem->release_pending_use();
+            mem->release();
+        }
+        task.primitive_iface->release();
+        task.ctx.reset();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (status != status::success && status_ == status::success)
+                status_ = status;
+            n_pending_--;
+        }
+        done_cv_.notify_all();
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -17,6 +17,13 @@
 #ifndef CPU_CPU_STREAM_HPP
 #define CPU_CPU_STREAM_HPP
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_config.h"
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -25,21 +32,41 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/primitive_exec_types.hpp"
 #include "common/stream.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
+// CPU stream.
+//
+// By default the execution is synchronous: a primitive is executed by the
+// calling thread. A stream created with the `out_of_order` flag is
+// asynchronous: executions are enqueued to a worker thread owned by the stream
+// and the calling thread returns right away. The worker executes primitives
+// one by one in the submission order, which keeps every dependency between
+// them satisfied. Memory objects used by pending executions are tracked, so
+// mapping such a memory or changing its data handle waits for the executions
+// to complete. Errors of asynchronous executions are reported by `wait()`.
 struct cpu_stream_t : public stream_t {
-    cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
-        : stream_t(engine, stream_impl) {}
-    ~cpu_stream_t() override = default;
+    cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl);
+    ~cpu_stream_t() override;
 
-    dnnl::impl::status_t wait() override {
-        // CPU execution is synchronous so return immediately
-        return dnnl::impl::status::success;
-    }
+    status_t enqueue_primitive(const primitive_iface_t *primitive_iface,
+            exec_ctx_t &ctx) override;
+
+    dnnl::impl::status_t wait() override;
+
+    bool is_async() const { return is_async_; }
+
+    // Executions submitted between `begin_sync_scope()` and
+    // `end_sync_scope()` are synchronous even if the stream is asynchronous.
+    // It is used by callers that release temporary buffers or read the
+    // results right after the submission without waiting for the stream, e.g.
+    // graph kernels. Beginning a scope waits for the pending executions.
+    status_t begin_sync_scope();
+    void end_sync_scope();
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
@@ -56,6 +83,35 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    struct task_t {
+        primitive_iface_t *primitive_iface;
+        std::unique_ptr<exec_ctx_t> ctx;
+        std::vector<memory_t *> memories;
+    };
+
+    void worker_loop();
+
+    // The threadpool runtime executes primitives on the user threadpool bound
+    // to the calling thread, so streams are always synchronous there.
+    bool is_async_ = false;
+    // The number of threads of the thread creating the stream, the worker
+    // uses it for its own parallel regions.
+    int nthr_ = 0;
+
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable done_cv_;
+    std::deque<task_t> queue_;
+    // Number of enqueued executions that have not completed yet.
+    size_t n_pending_ = 0;
+    bool stop_ = false;
+    // Nesting depth of the synchronous scopes.
+    int sync_depth_ = 0;
+    // The first error of asynchronous executions since the last `wait()`.
+    status_t status_ = status::success;
 };
 
 } // namespace cpu
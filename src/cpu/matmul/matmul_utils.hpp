@@ -18,6 +18,9 @@
 #ifndef CPU_MATMUL_MATMUL_UTILS_HPP
 #define CPU_MATMUL_MATMUL_UTILS_HPP
 
+#include <cmath>
+
+#include "common/matmul_pd.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/tag_traits.hpp"
 #include "common/utils.hpp"
@@ -245,6 +248,39 @@ private:
     }
 };
 
+// The page table of paged weights is passed at execution time, so
+// implementations validate it right before the computations: every page of
+// the weights must be located within the pool passed as the weights memory.
+inline status_t check_weights_page_table(const int32_t *page_table,
+        const matmul_pd_t *pd, const memory_desc_wrapper &pool_d) {
+    VCONDCHECK(primitive, exec, check, matmul, page_table != nullptr,
+            status::invalid_arguments, VERBOSE_NULL_ARG);
+
+    const dim_t page_bytes = pd->weights_page_stride()
+            * static_cast<dim_t>(pool_d.data_type_size());
+    const dim_t n_pool_pages = static_cast<dim_t>(pool_d.size()) / page_bytes;
+    const memory_desc_wrapper page_table_d(
+            pd->arg_md(DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE));
+    for (dim_t i = 0; i < page_table_d.nelems(); i++) {
+        VCONDCHECK(primitive, exec, check, matmul,
+                page_table[i] >= 0 && page_table[i] < n_pool_pages,
+                status::invalid_arguments,
+                "page table entry %ld points outside of the pool of %ld pages",
+                (long)i, (long)n_pool_pages);
+    }
+    return status::success;
+}
+
+// Scales of a row of the source quantized dynamically into s8: the absolute
+// maximum of the row maps to 127. Rows which are all zeros, or so small that
+// the inverse scale overflows, are quantized into zeros.
+inline void get_src_dyn_quant_scales(
+        float abs_max, float &scale, float &inv_scale) {
+    scale = abs_max / 127.f;
+    inv_scale = 127.f / abs_max;
+    if (!(abs_max > 0.f) || std::isinf(inv_scale)) scale = inv_scale = 1.f;
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
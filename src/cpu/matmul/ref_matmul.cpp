@@ -126,6 +126,38 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto dst_rnd_mode = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST);
 
+    // Source dynamic quantization: every row of the source is quantized into
+    // s8 with its own scale, the int32 result is scaled back by the same
+    // scale.
+    const bool with_src_dyn_quant = pd()->with_src_dyn_quant();
+
+    // Paged weights: the batch strides are ignored and the rows of the paged
+    // dimension are located with the page table of the weights batch.
+    const bool with_paged_weights = pd()->with_paged_weights();
+    const auto wei_page_table
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE);
+    if (with_paged_weights)
+        CHECK(check_weights_page_table(wei_page_table, pd(),
+                ctx.memory_mdw(DNNL_ARG_WEIGHTS)));
+    const bool wei_paged_by_K
+            = with_paged_weights && pd()->weights_paged_by_K();
+    const dim_t wei_page_size = pd()->weights_page_size();
+    const dim_t wei_n_pages = with_paged_weights ? pd()->weights_n_pages() : 0;
+    auto get_paged_weights_off = [&](const dims_t &wei_dims_idx) -> dim_t {
+        dim_t wei_b = 0;
+        for (int d = 0; d < batch_ndims; d++)
+            wei_b = wei_b * weights_d.dims()[d] + wei_dims_idx[d];
+        dim_t k = wei_dims_idx[ndims - 2];
+        dim_t n = wei_dims_idx[ndims - 1];
+        dim_t &row = wei_paged_by_K ? k : n;
+        const dim_t page
+                = wei_page_table[wei_b * wei_n_pages + row / wei_page_size];
+        row = page * wei_page_size + row % wei_page_size;
+        const auto &strides = weights_d.blocking_desc().strides;
+        return weights_d.offset0() + k * strides[ndims - 2]
+                + n * strides[ndims - 1];
+    };
+
     // mm kernel
     auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
         float acc = 0;
@@ -137,11 +169,40 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         weights_dims_idx[ndims - 1] = n;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
+        if (with_src_dyn_quant) {
+            float abs_max = 0.f;
+            for (dim_t k = 0; k < K; ++k) {
+                src_k_dim = k;
+                const float s = io::load_float_value(
+                        src_d.data_type(), src, src_d.off_v(src_dims_idx));
+                abs_max = nstl::max(abs_max, std::fabs(s));
+            }
+            float src_scale, src_inv_scale;
+            get_src_dyn_quant_scales(abs_max, src_scale, src_inv_scale);
+
+            int32_t acc_s32 = 0;
+            for (dim_t k = 0; k < K; ++k) {
+                src_k_dim = k;
+                wei_k_dim = k;
+                const float s = io::load_float_value(
+                        src_d.data_type(), src, src_d.off_v(src_dims_idx));
+                const auto weights_off = with_paged_weights
+                        ? get_paged_weights_off(weights_dims_idx)
+                        : weights_d.off_v(weights_dims_idx);
+                const int32_t w = io::load_int_value(
+                        weights_d.data_type(), weights, weights_off);
+                acc_s32 += q10n::saturate_and_round<int8_t>(s * src_inv_scale)
+                        * w;
+            }
+            return static_cast<float>(acc_s32) * src_scale;
+        }
         for (dim_t k = 0; k < K; ++k) {
             src_k_dim = k;
             wei_k_dim = k;
             const auto src_off = src_d.off_v(src_dims_idx);
-            const auto weights_off = weights_d.off_v(weights_dims_idx);
+            const auto weights_off = with_paged_weights
+                    ? get_paged_weights_off(weights_dims_idx)
+                    : weights_d.off_v(weights_dims_idx);
             const float s
                     = io::load_float_value(src_d.data_type(), src, src_off);
             float w = io::load_float_value(
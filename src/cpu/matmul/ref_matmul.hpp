@@ -64,9 +64,10 @@ struct ref_matmul_t : public primitive_t {
                                      || utils::one_of(wei_type, bf16, f16, u8,
                                              s8, u4, s4, f4_e3m0)),
                     VERBOSE_UNSUPPORTED_DT);
-            /* int8 weights decompression support */
+            /* int8 weights decompression or dynamic quantization support */
             VDISPATCH_MATMUL(IMPLICATION(utils::one_of(wei_type, u8, s8),
-                                     attr_.mayiconvert(wei_type, src_type)),
+                                     attr_.mayiconvert(wei_type, src_type)
+                                             || with_src_dyn_quant()),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_MATMUL(IMPLICATION(src_type == f32, dst_type == f32),
                     VERBOSE_UNSUPPORTED_DT);
@@ -93,6 +94,9 @@ struct ref_matmul_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_BIAS_CFG);
             VDISPATCH_MATMUL(platform::has_data_type_support(src_type),
                     VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_MATMUL(IMPLICATION(with_src_dyn_quant(),
+                                     platform::has_src_dyn_quant_support()),
+                    VERBOSE_UNSUPPORTED_ISA);
             VDISPATCH_MATMUL(
                     attr()->has_default_values(smask_t::scales_data_type
                                     | smask_t::scales_groups
@@ -100,7 +104,9 @@ struct ref_matmul_t : public primitive_t {
                                     | smask_t::zero_points_groups
                                     | smask_t::post_ops | smask_t::sum_dt
                                     | smask_t::fpmath_mode | smask_t::dropout
-                                    | smask_t::rounding_mode,
+                                    | smask_t::rounding_mode
+                                    | smask_t::weights_paging
+                                    | smask_t::src_dyn_quant,
                             dst_type),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_type,
@@ -40,12 +40,14 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     const dim_t N = dst_d.dims()[1];
     const dim_t K = src_d.dims()[1];
 
-    const data_type_t mm_dt = src_d.data_type();
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t wei_dt = weights_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
     auto scratchpad = ctx.get_scratchpad_grantor();
 
     parallel_nd(M, N, [&](dim_t i, dim_t j) {
         const dim_t dst_idx = i * N + j;
-        io::store_float_value(dst_d.data_type(), 0.0f, dst, dst_idx);
+        io::store_float_value(dst_dt, 0.0f, dst, dst_idx);
     });
 
     if (weights_d.is_sparse_desc()) {
@@ -90,7 +92,7 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         }
 
         run_csr_kernel(src, wei_values, wei_indices, wei_pointers, dst, M, N, K,
-                mm_dt, src_d.is_sparse_desc());
+                src_dt, wei_dt, dst_dt, src_d.is_sparse_desc());
 
     } else if (src_d.is_sparse_desc()) {
         const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
@@ -132,7 +134,7 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         }
 
         run_csr_kernel(weights, src_values, src_indices, src_pointers, dst, M,
-                N, K, mm_dt, src_d.is_sparse_desc());
+                N, K, wei_dt, src_dt, dst_dt, src_d.is_sparse_desc());
     }
     return status::success;
 }
@@ -149,7 +151,8 @@ void ref_sparse_matmul_t::cvt_coo_indices_to_csr_pointers(
 
 void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
         const int32_t *indices, const int32_t *pointers, void *res,
-        const dim_t M, const dim_t N, const dim_t K, const data_type_t mm_dt,
+        const dim_t M, const dim_t N, const dim_t K, const data_type_t dmat_dt,
+        const data_type_t values_dt, const data_type_t res_dt,
         bool is_src_sparse) const {
 
     if (is_src_sparse) {
@@ -162,16 +165,17 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
 
             for (dim_t n = 0; n < N; n++) {
                 const dim_t c_idx = m * N + n;
-                float c_val = io::load_float_value(mm_dt, res, c_idx);
+                float c_val = io::load_float_value(res_dt, res, c_idx);
 
                 for (dim_t k = row_start; k < row_end; k++) {
                     const dim_t b_idx = indices[k] * N + n;
-                    const float a_val = io::load_float_value(mm_dt, values, k);
+                    const float a_val
+                            = io::load_float_value(values_dt, values, k);
                     const float b_val
-                            = io::load_float_value(mm_dt, dmat, b_idx);
+                            = io::load_float_value(dmat_dt, dmat, b_idx);
                     c_val += a_val * b_val;
                 }
-                io::store_float_value(mm_dt, c_val, res, c_idx);
+                io::store_float_value(res_dt, c_val, res, c_idx);
             }
         });
     } else {
@@ -186,11 +190,12 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
                     const dim_t a_idx = m * K + k;
                     const dim_t c_idx = m * N + indices[n];
                     const float a_val
-                            = io::load_float_value(mm_dt, dmat, a_idx);
-                    const float b_val = io::load_float_value(mm_dt, values, n);
-                    float c_val = io::load_float_value(mm_dt, res, c_idx);
+                            = io::load_float_value(dmat_dt, dmat, a_idx);
+                    const float b_val
+                            = io::load_float_value(values_dt, values, n);
+                    float c_val = io::load_float_value(res_dt, res, c_idx);
                     c_val += a_val * b_val;
-                    io::store_float_value(mm_dt, c_val, res, c_idx);
+                    io::store_float_value(res_dt, c_val, res, c_idx);
                 }
             }
         });
@@ -60,11 +60,12 @@ struct ref_sparse_matmul_t : public primitive_t {
                                              sparse_encoding::coo)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
-            VDISPATCH_MATMUL(
-                    utils::everyone_is(f16, src_type, wei_type, dst_type)
-                            || utils::everyone_is(
-                                    f32, src_type, wei_type, dst_type),
-                    VERBOSE_UNSUPPORTED_DT_CFG);
+            const bool is_fp = utils::one_of(src_type, f32, bf16, f16)
+                    && src_type == wei_type
+                    && utils::one_of(dst_type, f32, src_type);
+            const bool is_int8 = utils::one_of(src_type, s8, u8)
+                    && wei_type == s8 && utils::one_of(dst_type, s32, f32);
+            VDISPATCH_MATMUL(is_fp || is_int8, VERBOSE_UNSUPPORTED_DT_CFG);
 
             if (src_d.is_sparse_desc()) {
                 sparse_mem_encoding = src_d.encoding();
@@ -146,7 +147,8 @@ struct ref_sparse_matmul_t : public primitive_t {
     void run_csr_kernel(const void *dmat, const void *values,
             const int32_t *indices, const int32_t *pointers, void *res,
             const dim_t M, const dim_t N, const dim_t K,
-            const data_type_t mm_dt, bool is_src_sparse) const;
+            const data_type_t dmat_dt, const data_type_t values_dt,
+            const data_type_t res_dt, bool is_src_sparse) const;
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <iterator>
+
+#include "common/utils.hpp"
+
+#include "cpu/packed_weights_cache.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+packed_weights_cache_t::entry_t::entry_t(size_t size)
+    : data_(static_cast<char *>(impl::malloc(size, PAGE_4K)))
+    , size_(data_ ? size : 0)
+    , ready_(false) {}
+
+packed_weights_cache_t::entry_t::~entry_t() {
+    impl::free(data_);
+}
+
+size_t packed_weights_cache_t::key_hash_t::operator()(const key_t &key) const {
+    size_t seed = 0;
+    seed = hash_combine(seed, key.memory_id);
+    seed = hash_combine(seed, key.generation);
+    for (const auto v : key.layout)
+        seed = hash_combine(seed, v);
+    return seed;
+}
+
+std::shared_ptr<packed_weights_cache_t::entry_t>
+packed_weights_cache_t::get_or_create(
+        const key_t &key, size_t size, bool &is_new) {
+    is_new = false;
+    if (!is_enabled() || size == 0 || size > capacity_) return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+        lru_list_.splice(lru_list_.begin(), lru_list_, it->second);
+        const auto &entry = it->second->second;
+        return entry->is_ready() ? entry : nullptr;
+    }
+
+    evict(size);
+
+    auto entry = std::make_shared<entry_t>(size);
+    if (entry->data() == nullptr) return nullptr;
+
+    lru_list_.emplace_front(key, entry);
+    map_.emplace(key, lru_list_.begin());
+    n_entries_[key.memory_id]++;
+    size_ += size;
+    is_new = true;
+    return entry;
+}
+
+void packed_weights_cache_t::drop(uint64_t memory_id) {
+    if (!is_enabled()) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (n_entries_.find(memory_id) == n_entries_.end()) return;
+
+    for (auto it = lru_list_.begin(); it != lru_list_.end();) {
+        if (it->first.memory_id == memory_id)
+            it = remove(it);
+        else
+            ++it;
+    }
+}
+
+size_t packed_weights_cache_t::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+void packed_weights_cache_t::evict(size_t size) {
+    while (!lru_list_.empty() && size_ + size > capacity_)
+        remove(std::prev(lru_list_.end()));
+}
+
+packed_weights_cache_t::lru_list_t::iterator packed_weights_cache_t::remove(
+        lru_list_t::iterator it) {
+    const key_t &key = it->first;
+    auto n = n_entries_.find(key.memory_id);
+    if (n != n_entries_.end() && --n->second == 0) n_entries_.erase(n);
+    size_ -= it->second->size();
+    map_.erase(key);
+    return lru_list_.erase(it);
+}
+
+size_t packed_weights_cache_t::get_default_capacity() {
+    static const size_t capacity = []() {
+        const int capacity_mb
+                = getenv_int_user("CPU_PACKED_WEIGHTS_CACHE_CAPACITY", 0);
+        return capacity_mb > 0 ? (size_t)capacity_mb << 20 : (size_t)0;
+    }();
+    return capacity;
+}
+
+packed_weights_cache_t &packed_weights_cache() {
+    // Never destroyed: memory objects destroyed at exit still notify it.
+    static auto *cache = new packed_weights_cache_t(
+            packed_weights_cache_t::get_default_capacity());
+    return *cache;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_PACKED_WEIGHTS_CACHE_HPP
+#define CPU_PACKED_WEIGHTS_CACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Process-wide cache of weights packed by an implementation into its internal
+// layout. Entries are identified by the memory object holding the weights, the
+// generation of its data (see `memory_t::generation()`) and an
+// implementation-defined description of the packed layout, so primitives with
+// the same blocking share a single packed copy of the weights.
+//
+// Entries are never matched by the data address, which may be reused by
+// another memory object. The entries of a memory object are dropped when the
+// library is notified about a write to its data and when it is destroyed.
+//
+// Entries are reference counted: an entry evicted from the cache stays alive
+// until the last primitive using it finishes the execution.
+struct packed_weights_cache_t {
+    struct key_t {
+        uint64_t memory_id;
+        uint64_t generation;
+        std::vector<dim_t> layout;
+
+        bool operator==(const key_t &rhs) const {
+            return memory_id == rhs.memory_id && generation == rhs.generation
+                    && layout == rhs.layout;
+        }
+    };
+
+    struct entry_t {
+        entry_t(size_t size);
+        ~entry_t();
+
+        char *data() const { return data_; }
+        size_t size() const { return size_; }
+
+        // The entry can be used for computations only after the weights are
+        // packed into it by the thread that created the entry.
+        bool is_ready() const { return ready_.load(std::memory_order_acquire); }
+        void set_ready() { ready_.store(true, std::memory_order_release); }
+
+    private:
+        char *data_;
+        size_t size_;
+        std::atomic<bool> ready_;
+
+        DNNL_DISALLOW_COPY_AND_ASSIGN(entry_t);
+    };
+
+    // `capacity` is in bytes, zero capacity disables the cache.
+    packed_weights_cache_t(size_t capacity) : capacity_(capacity) {}
+
+    bool is_enabled() const { return capacity_ > 0; }
+
+    // Returns the entry for `key`. When there is no such entry a new one of `size` bytes is created and
+    // `is_new` is set; the caller is then responsible for packing the weights
+    // and marking the entry as ready. Returns nullptr if the entry does not
+    // fit into the cache or if it is being packed by another thread at the
+    // moment. In both cases the caller is expected to fall back to packing the
+    // weights on its own.
+    std::shared_ptr<entry_t> get_or_create(
+            const key_t &key, size_t size, bool &is_new);
+
+    // Drops the entries packed from the data of the memory object
+    // `memory_id`, which was written or destroyed.
+    void drop(uint64_t memory_id);
+
+    size_t capacity() const { return capacity_; }
+    DNNL_API size_t size() const;
+
+    // Reads the capacity from ONEDNN_CPU_PACKED_WEIGHTS_CACHE_CAPACITY, which
+    // is set in megabytes. The cache is disabled by default.
+    static size_t get_default_capacity();
+
+private:
+    struct key_hash_t {
+        size_t operator()(const key_t &key) const;
+    };
+
+    using lru_list_t = std::list<std::pair<key_t, std::shared_ptr<entry_t>>>;
+
+    void evict(size_t size);
+    lru_list_t::iterator remove(lru_list_t::iterator it);
+
+    const size_t capacity_;
+    size_t size_ = 0;
+    lru_list_t lru_list_;
+    std::unordered_map<key_t, lru_list_t::iterator, key_hash_t> map_;
+    // Number of entries per memory object, so that memory objects without
+    // entries are not looked for in the list.
+    std::unordered_map<uint64_t, size_t> n_entries_;
+    mutable std::mutex mutex_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(packed_weights_cache_t);
+};
+
+// Returns the cache with the capacity set by
+// ONEDNN_CPU_PACKED_WEIGHTS_CACHE_CAPACITY.
+DNNL_API packed_weights_cache_t &packed_weights_cache();
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
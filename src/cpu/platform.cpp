@@ -18,8 +18,15 @@
 
 #include <thread>
 
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
 #include "cpu/platform.hpp"
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include <algorithm>
 
@@ -172,6 +179,14 @@ bool has_training_support(data_type_t data_type) {
     }
 }
 
+bool has_src_dyn_quant_support() {
+#if DNNL_X64
+    return !x64::mayiuse(x64::avx512_core_amx);
+#else
+    return true;
+#endif
+}
+
 float s8s8_weights_scale_factor() {
 #if DNNL_X64
     return x64::mayiuse(x64::avx512_core_vnni) || x64::mayiuse(x64::avx2_vnni)
@@ -216,6 +231,49 @@ unsigned get_num_cores() {
 #endif
 }
 
+bool is_numa_first_touch_enabled() {
+#if defined(__linux__)
+    static const bool enabled = getenv_int_user("CPU_NUMA_FIRST_TOUCH", 0);
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+// Linux places a physical page on the NUMA node of the thread that touches it
+// first. Touching pages from library threads with the same static split the
+// primitives use (per-thread buffers are laid out by thread index and outer
+// dimensions are split with balance211) makes most of the accesses local.
+// Without it, the pages of memory written by a single thread first (e.g. when
+// zero-padding) end up on one node.
+void numa_first_touch(void *ptr, size_t size) {
+#if defined(__linux__)
+    static const size_t page_size = [] {
+        const long sz = sysconf(_SC_PAGESIZE);
+        return sz > 0 ? (size_t)sz : (size_t)4096;
+    }();
+    const dim_t npages = (dim_t)(size / page_size);
+    const int nthr = adjust_num_threads(dnnl_get_max_threads(), npages);
+    if (ptr == nullptr || nthr <= 1) return;
+
+    // Align to page boundary: the first partial page stays with the thread
+    // touching the header of the buffer.
+    char *base = (char *)utils::rnd_up((size_t)ptr, page_size);
+    const char *end = (const char *)ptr + size;
+    parallel(nthr, [&](int ithr, int nthr) {
+        dim_t start {0}, stop {0};
+        balance211(npages, nthr, ithr, start, stop);
+        for (dim_t p = start; p < stop; ++p) {
+            char *page = base + p * page_size;
+            if (page < end) *(volatile char *)page = 0;
+        }
+    });
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+#endif
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 // The purpose of this function is to return the potential maximum number of
 // threads in user's threadpool. It is assumed that the number of threads in an
@@ -166,6 +166,10 @@ bool DNNL_API prefer_ymm_requested();
 // implementations since these require specific code-path updates.
 bool DNNL_API has_data_type_support(data_type_t data_type);
 bool DNNL_API has_training_support(data_type_t data_type);
+// Source dynamic quantization is not supported on processors with Intel AMX,
+// where a floating-point source with int8 weights is computed by the Intel AMX
+// kernels instead.
+bool DNNL_API has_src_dyn_quant_support();
 float DNNL_API s8s8_weights_scale_factor();
 
 unsigned DNNL_API get_per_core_cache_size(int level);
@@ -174,6 +178,13 @@ unsigned DNNL_API get_num_cores();
 unsigned DNNL_API get_max_threads_to_use();
 #endif
 
+// NUMA-aware placement of library-allocated memory. Controlled by the
+// ONEDNN_CPU_NUMA_FIRST_TOUCH environment variable, Linux only.
+DNNL_API bool is_numa_first_touch_enabled();
+// Distributes pages of a freshly allocated buffer among NUMA nodes by touching
+// them from the library threads with a static split of the buffer.
+DNNL_API void numa_first_touch(void *ptr, size_t size);
+
 constexpr int get_cache_line_size() {
     return 64;
 }
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/embedding_bag_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_embedding_bag.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    using namespace alg_kind;
+    status_t status = status::success;
+
+    const memory_desc_wrapper indices_d(pd()->src_md(0));
+    const memory_desc_wrapper offsets_d(pd()->src_md(1));
+    const memory_desc_wrapper sw_d(pd()->src_md(2));
+    const memory_desc_wrapper table_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_EMB_OFFSETS);
+    const auto sample_weights
+            = CTX_IN_MEM(const float *, DNNL_ARG_EMB_SAMPLE_WEIGHTS);
+    const auto table = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ZERO_POINTS_BUFFER(zero_points, DNNL_ARG_WEIGHTS);
+
+    const dim_t MB = pd()->batch();
+    const dim_t D = pd()->emb_dim();
+
+    CHECK(embedding_bag_inputs_check(
+            indices, offsets, MB, pd()->nnz(), pd()->num_rows()));
+
+    const auto alg = pd()->alg_kind();
+    const auto table_dt = table_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    // Common scales and zero points are broadcast with a zero stride.
+    const auto *attr = pd()->attr();
+    const dim_t scales_stride = pd()->with_scales()
+            && attr->scales_.get_mask(DNNL_ARG_WEIGHTS) != 0;
+    const dim_t zps_stride = pd()->with_zero_points()
+            && attr->zero_points_.get_mask(DNNL_ARG_WEIGHTS) != 0;
+
+    parallel_nd(MB, D, [&](dim_t b, dim_t d) {
+        const dim_t beg = offsets[offsets_d.off(b)];
+        const dim_t end = offsets[offsets_d.off(b + 1)];
+
+        float acc = alg == reduction_max ? -FLT_MAX : 0.f;
+        for (dim_t i = beg; i < end; i++) {
+            const dim_t r = indices[indices_d.off(i)];
+            const float zp = (float)zero_points[r * zps_stride];
+            const float scale = scales[r * scales_stride];
+            const float v = (io::load_float_value(
+                                     table_dt, table, table_d.off(r, d))
+                                    - zp)
+                    * scale;
+            if (alg == reduction_max)
+                acc = nstl::max(acc, v);
+            else
+                acc += sample_weights ? sample_weights[sw_d.off(i)] * v : v;
+        }
+        if (end == beg)
+            acc = 0.f;
+        else if (alg == reduction_mean)
+            acc /= (float)(end - beg);
+
+        io::store_float_value(dst_dt, acc, dst, dst_d.off(b, d));
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_EMBEDDING_BAG_HPP
+#define CPU_REF_EMBEDDING_BAG_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/embedding_bag_pd.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_embedding_bag_t : public primitive_t {
+    struct pd_t : public embedding_bag_pd_t {
+        using embedding_bag_pd_t::embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_embedding_bag_t);
+
+        status_t init(engine_t *engine) {
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            for (auto dt : {weights_md()->data_type, dst_md()->data_type})
+                VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(dt),
+                        VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(
+                    attr()->has_default_values(skip_mask_t::scales
+                            | skip_mask_t::zero_points),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_EMBEDDING_BAG(attr_quant_ok(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_EMBEDDING_BAG(
+                    set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    ref_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
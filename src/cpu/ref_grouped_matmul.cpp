@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2023-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/grouped_matmul_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_grouped_matmul.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const dim_t G = pd()->ngroups();
+    const dim_t M = pd()->M();
+    const dim_t K = pd()->K();
+    const dim_t N = pd()->N();
+
+    CHECK(grouped_matmul_offsets_check(offsets, G, M));
+
+    std::vector<const void *> weights(G);
+    for (dim_t g = 0; g < G; g++)
+        weights[g] = CTX_IN_MEM(const void *, DNNL_ARG_GROUP_WEIGHTS(g));
+
+    const auto src_dt = src_d.data_type();
+    const auto wei_dt = wei_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+
+    // Rows outside of [offsets[0], offsets[ngroups]) belong to no group and
+    // are left untouched.
+    const dim_t m_begin = offsets[0];
+    const dim_t m_end = offsets[G];
+
+    parallel_nd(m_end - m_begin, N, [&](dim_t i, dim_t n) {
+        const dim_t m = m_begin + i;
+        // The group owning row `m` is the last one starting at or before it.
+        const dim_t g = std::upper_bound(offsets, offsets + G + 1, m) - offsets
+                - 1;
+        const void *wei = weights[g];
+
+        float acc = 0.f;
+        for (dim_t k = 0; k < K; k++) {
+            const float s = io::load_float_value(src_dt, src, src_d.off(m, k));
+            const float w = io::load_float_value(wei_dt, wei, wei_d.off(k, n));
+            acc += s * w;
+        }
+        io::store_float_value(dst_dt, acc, dst, dst_d.off(m, n));
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2023-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_GROUPED_MATMUL_HPP
+#define CPU_REF_GROUPED_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/grouped_matmul_pd.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_grouped_matmul_t : public primitive_t {
+    struct pd_t : public grouped_matmul_pd_t {
+        using grouped_matmul_pd_t::grouped_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_grouped_matmul_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const auto src_dt = src_md()->data_type;
+            const auto wei_dt = weights_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            for (auto dt : {src_dt, wei_dt, dst_dt})
+                VDISPATCH_GROUPED_MATMUL(utils::one_of(dt, f32, bf16, f16)
+                                && platform::has_data_type_support(dt),
+                        VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GROUPED_MATMUL(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_GROUPED_MATMUL(
+                    set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    ref_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
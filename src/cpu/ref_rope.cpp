@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/rope_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_rope.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_rope_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper cos_d(pd()->src_md(1));
+    const memory_desc_wrapper sin_d(pd()->src_md(2));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto cos = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_COS);
+    const auto sin = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_SIN);
+    const auto positions
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ROPE_POSITIONS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const dim_t B = pd()->batch();
+    const dim_t H = pd()->heads();
+    const dim_t S = pd()->seq_len();
+    const dim_t D = pd()->head_size();
+    const dim_t R = pd()->rotary_dim();
+    const dim_t n_pairs = R / 2;
+
+    CHECK(rope_positions_check(positions, B, S, pd()->max_positions()));
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const bool is_interleaved = pd()->is_interleaved();
+
+    // Each row is processed by a single thread and every pair is read before
+    // it is written, which keeps the in-place computations correct.
+    parallel_nd(B, H, S, [&](dim_t b, dim_t h, dim_t s) {
+        const dim_t pos = (positions ? positions[b] : 0) + s;
+        for (dim_t i = 0; i < n_pairs; i++) {
+            const dim_t d0 = is_interleaved ? 2 * i : i;
+            const dim_t d1 = is_interleaved ? 2 * i + 1 : i + n_pairs;
+            const float x0
+                    = io::load_float_value(src_dt, src, src_d.off(b, h, s, d0));
+            const float x1
+                    = io::load_float_value(src_dt, src, src_d.off(b, h, s, d1));
+            const float c = cos[cos_d.off(pos, i)];
+            const float sn = sin[sin_d.off(pos, i)];
+            io::store_float_value(
+                    dst_dt, x0 * c - x1 * sn, dst, dst_d.off(b, h, s, d0));
+            io::store_float_value(
+                    dst_dt, x1 * c + x0 * sn, dst, dst_d.off(b, h, s, d1));
+        }
+        for (dim_t d = R; d < D; d++) {
+            const float x
+                    = io::load_float_value(src_dt, src, src_d.off(b, h, s, d));
+            io::store_float_value(dst_dt, x, dst, dst_d.off(b, h, s, d));
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
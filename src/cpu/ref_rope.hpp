@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_ROPE_HPP
+#define CPU_REF_ROPE_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/rope_pd.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_rope_t : public primitive_t {
+    struct pd_t : public rope_pd_t {
+        using rope_pd_t::rope_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_rope_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            for (auto dt : {src_dt, dst_dt})
+                VDISPATCH_ROPE(utils::one_of(dt, f32, bf16, f16)
+                                && platform::has_data_type_support(dt),
+                        VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_ROPE(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_ROPE(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    ref_rope_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
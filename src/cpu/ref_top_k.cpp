@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_top_k.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_top_k_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper idx_d(pd()->dst_md(1));
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_TOP_K_INDICES, status);
+    CHECK(status);
+
+    const int axis = pd()->axis();
+    const dim_t N = pd()->axis_size();
+    const dim_t K = pd()->k();
+    dim_t outer = 1, inner = 1;
+    for (int d = 0; d < axis; d++)
+        outer *= src_d.dims()[d];
+    for (int d = axis + 1; d < pd()->ndims(); d++)
+        inner *= src_d.dims()[d];
+
+    const bool largest = pd()->alg_kind() == alg_kind::reduction_max;
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+
+    parallel_nd(outer, inner, [&](dim_t o, dim_t i) {
+        std::vector<std::pair<float, dim_t>> row(N);
+        for (dim_t n = 0; n < N; n++) {
+            const dim_t off = src_d.off_l((o * N + n) * inner + i);
+            row[n] = {io::load_float_value(src_dt, src, off), n};
+        }
+        // The best value goes first, equal values keep their order.
+        std::partial_sort(row.begin(), row.begin() + K, row.end(),
+                [&](const std::pair<float, dim_t> &a,
+                        const std::pair<float, dim_t> &b) {
+                    if (a.first != b.first)
+                        return largest ? a.first > b.first
+                                       : a.first < b.first;
+                    return a.second < b.second;
+                });
+        for (dim_t j = 0; j < K; j++) {
+            const dim_t l_off = (o * K + j) * inner + i;
+            io::store_float_value(
+                    dst_dt, row[j].first, dst, dst_d.off_l(l_off));
+            indices[idx_d.off_l(l_off)] = (int32_t)row[j].second;
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
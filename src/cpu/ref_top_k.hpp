@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_TOP_K_HPP
+#define CPU_REF_TOP_K_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/top_k_pd.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_top_k_t : public primitive_t {
+    struct pd_t : public top_k_pd_t {
+        using top_k_pd_t::top_k_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_top_k_t);
+
+        status_t init(engine_t *engine) {
+            for (auto dt : {src_md()->data_type, dst_md()->data_type})
+                VDISPATCH_TOP_K(platform::has_data_type_support(dt),
+                        VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOP_K(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_TOP_K(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    ref_top_k_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
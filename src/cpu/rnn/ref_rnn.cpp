@@ -29,6 +29,9 @@
 
  */
 
+#include <cstring>
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 #include "common/matmul_pd.hpp"
 #include "common/primitive.hpp"
@@ -1052,6 +1055,20 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                   return dnnl_success;
               };
 
+    // With variable-length sequences, iteration `iter` is computed only for
+    // the rows up to the last sequence still running at this iteration. The
+    // sequences sorted by decreasing length give the smallest minibatches.
+    std::vector<int> active_mb;
+    rnn_conf_t var_len_rnn;
+    if (rnn.is_var_len) {
+        const auto seq_lengths
+                = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_LAYER_LENGTHS);
+        active_mb.resize(rnn.n_iter, 0);
+        for_(int b = 0; b < rnn.mb; b++)
+        for (int it = 0; it < seq_lengths[b]; it++)
+            active_mb[it] = b + 1;
+    }
+
     // We run the grid of computation
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
@@ -1066,6 +1083,13 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             const int iter
                     = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
 
+            const rnn_conf_t *cell_rnn = &rnn;
+            if (rnn.is_var_len) {
+                if (active_mb[iter] == 0) continue;
+                var_len_rnn = rnn.active_mb_conf(active_mb[iter]);
+                cell_rnn = &var_len_rnn;
+            }
+
             // We set parameters to the cell execution call
 
             // dst_layer is equal to dst_iter. To avoid
@@ -1132,7 +1156,9 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                         src_iter_c_mdw.off(lay, dir, 0, 0));
                 cell_position |= c_state_first_iter;
             }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            // With variable-length sequences the final c states are
+            // gathered from the workspace by copy_res_iter.
+            if (iter == rnn.n_iter - 1 && dst_iter_c_ && !rnn.is_var_len) {
                 cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
                         dst_iter_c_mdw.off(lay, dir, 0, 0));
                 cell_position |= c_state_last_iter;
@@ -1152,7 +1178,8 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             }
 
 #if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
+            CHECK((this->*cell_func)(ctx, *cell_rnn, cell_position,
+                    cell_dst_layer,
                     cell_dst_iter_c,
                     SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
                     SAFE_PTR(diff_augru_attention, iter, 0, 0),
@@ -1182,7 +1209,8 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                     scratch_src_iter_, cell_dst_iter, amx_scratchpad,
                     addr_batch_global));
 #else
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
+            CHECK((this->*cell_func)(ctx, *cell_rnn, cell_position,
+                    cell_dst_layer,
                     cell_dst_iter_c,
                     SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
                     SAFE_PTR(diff_augru_attention, iter, 0, 0),
@@ -1271,16 +1299,20 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 template <typename src_data_t, typename input_data_t>
 void copy_init_layer_fwd_template(const rnn_conf_t &rnn,
         src_data_t *__restrict ws_states_layer_,
-        const input_data_t *__restrict xt_, const memory_desc_wrapper &xt_d) {
+        const input_data_t *__restrict xt_, const memory_desc_wrapper &xt_d,
+        const int32_t *seq_lengths) {
 
     const AOC<src_data_t, 4> ws_states_layer(ws_states_layer_, rnn.n_dir,
             rnn.n_iter + 1, rnn.mb, rnn.ws_states_layer_ld);
 
     parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+        // Variable-length sequences are reversed within their own length, so
+        // that both directions start at the first iteration.
+        const dim_t len = seq_lengths ? seq_lengths[b] : rnn.n_iter;
         auto xxt = xt_ + xt_d.blk_off(it, b);
         src_data_t *ws_l2r_ptr = &(ws_states_layer(0, it + 1, b, 0));
-        src_data_t *ws_r2l_ptr
-                = &(ws_states_layer(rnn.n_dir - 1, rnn.n_iter - it, b, 0));
+        src_data_t *ws_r2l_ptr = &(ws_states_layer(
+                rnn.n_dir - 1, nstl::max(len - it, dim_t(0)), b, 0));
         if (rnn.exec_dir != r2l) {
             if (rnn.is_bf32()) {
                 cvt_float_to_bfloat16(
@@ -1291,7 +1323,7 @@ void copy_init_layer_fwd_template(const rnn_conf_t &rnn,
                     ws_l2r_ptr[c] = xxt[c];
             }
         }
-        if (rnn.exec_dir != l2r) {
+        if (rnn.exec_dir != l2r && it < len) {
             if (rnn.is_bf32()) {
                 cvt_float_to_bfloat16(
                         (bfloat16_t *)ws_r2l_ptr, (const float *)xxt, rnn.slc);
@@ -1368,10 +1400,10 @@ void copy_init_layer_bwd_template(const rnn_conf_t &rnn,
     template <typename input_data_t> \
     void cname::copy_init_layer(const rnn_conf_t &rnn, \
             src_layer_t *ws_states_layer_, gemm_acc_t *ws_diff_states_layer_, \
-            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_) \
-            const { \
+            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_, \
+            const int32_t *seq_lengths) const { \
         copy_init_layer_fwd_template(rnn, ws_states_layer_, xt_, \
-                memory_desc_wrapper(pd()->src_md(0))); \
+                memory_desc_wrapper(pd()->src_md(0)), seq_lengths); \
     }
 
 RNN_DECL_COPY_INIT_LAYER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1385,8 +1417,8 @@ RNN_DECL_COPY_INIT_LAYER_FWD(ref_rnn_common_fwd_s8s8_t)
     template <typename input_data_t> \
     void cname::copy_init_layer(const rnn_conf_t &rnn, \
             src_layer_t *ws_states_layer_, gemm_acc_t *ws_diff_states_layer_, \
-            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_) \
-            const { \
+            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_, \
+            const int32_t *seq_lengths) const { \
         copy_init_layer_bwd_template(rnn, ws_diff_states_layer_, \
                 diff_dst_layer_, memory_desc_wrapper(pd()->diff_dst_md(0))); \
     }
@@ -1552,7 +1584,7 @@ template <typename src_data_t, typename dst_layer_dt, typename dst_iter_dt>
 void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_layer_dt *dst_layer_, memory_desc_wrapper &dst_layer_d,
         const dst_iter_dt *dst_iter_, const memory_desc_wrapper &dst_iter_d,
-        const src_data_t *ws_states_layer_) {
+        const src_data_t *ws_states_layer_, const int32_t *seq_lengths) {
 
     const AOC<const src_data_t, 5> ws_states_layer(ws_states_layer_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
@@ -1584,6 +1616,12 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         }
     };
 
+    // Outputs past the end of a variable-length sequence are zeroed.
+    const dst_layer_dt zero = rnn.is_int8_conf() && !dequantize
+            ? q10n::qz_a1b0_t<float, dst_layer_dt>()(shift)
+            : dst_layer_dt(0);
+    const int dst_layer_c = rnn.exec_dir == bi_concat ? 2 * rnn.dlc : rnn.dlc;
+
     const auto acc_vec = [&](dst_layer_dt *dd, const src_data_t *ss) {
         if (dequantize) {
             PRAGMA_OMP_SIMD()
@@ -1609,6 +1647,13 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
     // in dst_iter, not in workspace
     parallel_nd(rnn.n_iter - (rnn.skip_dst_iter_copy() ? 1 : 0), rnn.mb,
             [&](dim_t it, dim_t b) {
+                const dim_t len = seq_lengths ? seq_lengths[b] : rnn.n_iter;
+                if (it >= len) {
+                    auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
+                    for (int s = 0; s < dst_layer_c; s++)
+                        dd[s] = zero;
+                    return;
+                }
                 int dir = 0;
                 if (rnn.exec_dir != r2l) {
                     const auto *ss
@@ -1620,7 +1665,7 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
                 }
                 if (rnn.exec_dir != l2r) {
                     const auto *ss = &ws_states_layer(
-                            rnn.n_layer, dir, rnn.n_iter - it, b, 0);
+                            rnn.n_layer, dir, len - it, b, 0);
                     if (rnn.exec_dir == bi_sum) {
                         auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
                         acc_vec(dd, ss);
@@ -1688,11 +1733,12 @@ void copy_res_layer_bwd_template(const rnn_conf_t &rnn,
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         copy_res_layer_fwd_template(rnn, pd(), dst_layer_, dst_layer_d, \
-                dst_iter_, dst_iter_d, ws_states_layer_); \
+                dst_iter_, dst_iter_d, ws_states_layer_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1707,7 +1753,8 @@ RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_common_fwd_s8s8_t)
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer_, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths) const { \
         auto diff_src_layer_d = memory_desc_wrapper(pd()->diff_src_md(0)); \
         copy_res_layer_bwd_template(rnn, diff_src_layer_, diff_src_layer_d, \
                 ws_diff_states_layer_); \
@@ -1722,13 +1769,34 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_iter_dt *dst_iter_, memory_desc_wrapper &dst_iter_d,
         void *dst_iter_c_, memory_desc_wrapper dst_iter_c_d,
         const dst_layer_dt *dst_layer_, memory_desc_wrapper dst_layer_d,
-        const src_data_t *ws_states_iter_, const void *ws_states_iter_c_) {
-    if (dst_iter_ == nullptr) return;
-
+        const src_data_t *ws_states_iter_, const void *ws_states_iter_c_,
+        const int32_t *seq_lengths) {
     const AOC<const src_data_t, 5> ws_states_iter(ws_states_iter_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
             rnn.ws_states_iter_ld);
 
+    // The final states of a variable-length sequence are the ones computed
+    // at its last iteration. The c states are written directly to
+    // dst_iter_c by the cells otherwise.
+    if (seq_lengths && dst_iter_c_) {
+        const auto ws_states_iter_c = rnn_utils::make_raw_aoc(
+                ws_states_iter_c_, types::data_type_size(rnn.src_iter_c_dt),
+                rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
+                rnn.ws_states_iter_c_ld);
+        const size_t dst_iter_c_dt_size
+                = types::data_type_size(rnn.dst_iter_c_dt);
+        parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
+                [&](dim_t lay, dim_t dir, dim_t b) {
+                    const void *ss = ws_states_iter_c(
+                            lay + 1, dir, seq_lengths[b], b, 0);
+                    void *dd = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                            dst_iter_c_d.blk_off(lay, dir, b, 0));
+                    std::memcpy(dd, ss, rnn.dhc * dst_iter_c_dt_size);
+                });
+    }
+
+    if (dst_iter_ == nullptr) return;
+
     const float data_shift = pd->attr()->rnn_data_qparams_.shift_;
     const float data_scale = pd->attr()->rnn_data_qparams_.scale_;
 
@@ -1752,8 +1820,8 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
 
     parallel_nd(n_layer_in_ws, rnn.n_dir, rnn.mb,
             [&](dim_t lay, dim_t dir, dim_t b) {
-                const auto *ss
-                        = &ws_states_iter(lay + 1, dir, rnn.n_iter, b, 0);
+                const dim_t len = seq_lengths ? seq_lengths[b] : rnn.n_iter;
+                const auto *ss = &ws_states_iter(lay + 1, dir, len, b, 0);
                 auto *dd = dst_iter_ + dst_iter_d.blk_off(lay, dir, b, 0);
                 copy_vec(dd, ss);
             });
@@ -1807,13 +1875,14 @@ void copy_res_iter_bwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
             const src_layer_t *ws_states_layer_, \
             const void *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         auto dst_iter_c_d = memory_desc_wrapper(pd()->dst_md(2)); \
         copy_res_iter_fwd_template(rnn, pd(), dst_iter_, dst_iter_d, \
                 dst_iter_c_, dst_iter_c_d, dst_layer_, dst_layer_d, \
-                ws_states_layer_, ws_states_iter_c_); \
+                ws_states_layer_, ws_states_iter_c_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1831,7 +1900,8 @@ RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_common_fwd_s8s8_t)
             const src_layer_t *ws_states_layer_, \
             const void *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths) const { \
         auto diff_src_iter_d = memory_desc_wrapper(pd()->diff_src_md(1)); \
         auto diff_src_iter_c_d = memory_desc_wrapper(pd()->diff_src_md(2)); \
         copy_res_iter_bwd_template(rnn, pd(), diff_src_iter_, diff_src_iter_d, \
@@ -2023,6 +2093,20 @@ status_t _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
     auto diff_dst_iter = CTX_IN_MEM(const gemm_acc_t *, DNNL_ARG_DIFF_DST_ITER);
     auto diff_dst_iter_c = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST_ITER_C);
 
+    const int32_t *seq_lengths = rnn.is_var_len
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_LAYER_LENGTHS)
+            : nullptr;
+    if (rnn.is_var_len) {
+        VCONDCHECK(primitive, exec, check, rnn, seq_lengths != nullptr,
+                status::invalid_arguments, VERBOSE_NULL_ARG);
+        for (int b = 0; b < rnn.mb; b++)
+            VCONDCHECK(primitive, exec, check, rnn,
+                    seq_lengths[b] >= 1 && seq_lengths[b] <= rnn.n_iter,
+                    status::invalid_arguments,
+                    "sequence length %d of batch %d is out of range [1, %d]",
+                    (int)seq_lengths[b], b, rnn.n_iter);
+    }
+
     auto w_layer = reinterpret_cast<const weights_t *>(layer_weights_n_comp);
     auto w_iter = reinterpret_cast<const weights_t *>(iter_weights_n_comp);
     auto w_projection
@@ -2203,10 +2287,10 @@ status_t _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
     if (!(rnn.skip_src_layer_copy() && rnn.is_fwd)) {
         if (pd()->src_md(0)->data_type == data_type::f32)
             copy_init_layer(rnn, ws_states_layer, ws_diff_states_layer,
-                    (const float *)src_layer, diff_dst_layer);
+                    (const float *)src_layer, diff_dst_layer, seq_lengths);
         else
             copy_init_layer(rnn, ws_states_layer, ws_diff_states_layer,
-                    src_layer, diff_dst_layer);
+                    src_layer, diff_dst_layer, seq_lengths);
     }
 
     if (!(rnn.skip_src_iter_copy() && rnn.is_fwd)) {
@@ -2253,10 +2337,11 @@ status_t _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
     if (!(rnn.skip_dst_layer_copy() && rnn.is_fwd)) {
         if (pd()->dst_md(0)->data_type == data_type::f32)
             copy_res_layer(rnn, (float *)dst_layer, diff_src_layer, dst_iter,
-                    ws_states_layer, ws_diff_states_layer);
+                    ws_states_layer, ws_diff_states_layer, seq_lengths);
         else
             copy_res_layer(rnn, (dst_layer_t *)dst_layer, diff_src_layer,
-                    dst_iter, ws_states_layer, ws_diff_states_layer);
+                    dst_iter, ws_states_layer, ws_diff_states_layer,
+                    seq_lengths);
     }
 
     if (!(rnn.skip_dst_iter_copy() && rnn.is_fwd)) {
@@ -2264,12 +2349,12 @@ status_t _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             copy_res_iter(rnn, (float *)dst_iter, dst_iter_c, diff_src_iter,
                     diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
         else
             copy_res_iter(rnn, (dst_iter_t *)dst_iter, dst_iter_c,
                     diff_src_iter, diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
     }
 
     return status::success;
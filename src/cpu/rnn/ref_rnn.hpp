@@ -186,7 +186,8 @@ protected:
     template <typename input_t>
     void copy_init_layer(const rnn_utils::rnn_conf_t &rnn,
             src_layer_t *ws_states_layer_, gemm_acc_t *ws_diff_states_layer_,
-            const input_t *xt_, const gemm_acc_t *diff_dst_layer) const;
+            const input_t *xt_, const gemm_acc_t *diff_dst_layer,
+            const int32_t *seq_lengths) const;
 
     template <typename input_t>
     void copy_init_iter(const rnn_utils::rnn_conf_t &rnn,
@@ -200,7 +201,8 @@ protected:
     void copy_res_layer(const rnn_utils::rnn_conf_t &rnn,
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer_,
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_,
-            const gemm_acc_t *ws_diff_states_layer_) const;
+            const gemm_acc_t *ws_diff_states_layer_,
+            const int32_t *seq_lengths) const;
 
     template <typename prim_dst_iter_t, typename prim_dst_layer_t>
     void copy_res_iter(const rnn_utils::rnn_conf_t &rnn,
@@ -209,7 +211,8 @@ protected:
             const prim_dst_layer_t *dst_layer_,
             const src_iter_t *ws_states_iter_, const void *ws_states_iter_c,
             const gemm_acc_t *ws_diff_states_iter_,
-            const gemm_acc_t *ws_diff_states_iter_c_) const;
+            const gemm_acc_t *ws_diff_states_iter_c_,
+            const int32_t *seq_lengths) const;
 
     rnn_grid_execution_sig(linear_execution);
     rnn_matmul_sig(execute_matmul);
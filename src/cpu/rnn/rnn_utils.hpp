@@ -389,6 +389,9 @@ struct rnn_conf_t {
 
     bool diff_weights_overwrite = false;
     bool use_matmul = false;
+    // Sequences have individual lengths: the finished sequences are dropped
+    // from the minibatch at every iteration, see `active_mb_conf()`.
+    bool is_var_len = false;
 
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
@@ -468,12 +471,13 @@ struct rnn_conf_t {
                         u8u8u8f32, all_f32, all_bf16, all_f16);
     }
     inline bool skip_dst_layer_copy() const {
-        return (exec_dir == l2r) && !is_bf32()
+        return (exec_dir == l2r) && !is_bf32() && !is_var_len
                 && utils::one_of(dt_conf, s8s8s8s8, f32s8f32s8, u8u8u8u8,
                         f32u8f32u8, all_f32, all_bf16, all_f16);
     }
     inline bool skip_dst_iter_copy() const {
         return (exec_dir == l2r) && (dst_iter_ld_ > 0) && !is_bf32()
+                && !is_var_len
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16, all_f16);
     }
@@ -602,6 +606,24 @@ struct rnn_conf_t {
         return 1.0f;
     }
 
+    // Returns the configuration restricted to the first `active_mb` rows of
+    // the minibatch. Used with variable-length sequences to skip the rows of
+    // the finished sequences. Brgemm kernels are generated for a fixed
+    // m_block, so the rows are rounded up to full blocks; matmul primitives
+    // are created for the full minibatch, so nothing is skipped there.
+    rnn_conf_t active_mb_conf(dim_t active_mb) const {
+        rnn_conf_t conf = *this;
+        if (use_matmul || active_mb >= mb) return conf;
+        if (is_brgemm) {
+            conf.M_blocks = utils::div_up(active_mb, m_block);
+            conf.M = nstl::min(conf.M_blocks * m_block, (dim_t)mb);
+            conf.mb = static_cast<int>(conf.M);
+        } else {
+            conf.M = conf.mb = static_cast<int>(active_mb);
+        }
+        return conf;
+    }
+
     bool is_brgemm;
 
     diff_src_brgemm_conf_t diff_src_brgemm;
@@ -678,6 +700,7 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             && !memory_desc_wrapper(rd.weights_projection_desc).is_zero();
     rnn.is_augru
             = utils::one_of(rd.cell_kind, dnnl_lbr_augru, dnnl_vanilla_augru);
+    rnn.is_var_len = rd.flags & rnn_flags::variable_length;
     rnn.bias_dt = bias_d.is_zero() ? data_type::f32 : bias_d.data_type();
     rnn.src_iter_c_dt = src_iter_c_d.is_zero() ? data_type::f32
                                                : src_iter_c_d.data_type();
@@ -892,6 +915,9 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                               && rnn.dst_layer_is_trivial_stride))
                     && (((rnn.is_fwd && rnn.mb < 128) || !rnn.is_fwd)
                             || rnn.is_int8_conf())
+                    // The merged gemm would compute the padded iterations of
+                    // the finished sequences as well.
+                    && !rnn.is_var_len
             : false;
     rnn.merge_gemm_iter = !(rnn.is_brgemm || rnn.use_matmul)
             ? rnn.dst_layer_is_trivial_stride && !(rnn.is_fwd || is_gru)
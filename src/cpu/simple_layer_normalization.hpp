@@ -116,8 +116,9 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
         // reorder input stats
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
-                    {mean.get(), false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {mean.get(), false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {variance.get(), false});
         }
@@ -125,8 +126,9 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
         if (status != status::success) return status;
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(ctx, engine, {mean.get(), true},
-                    ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, {mean.get(), true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {variance.get(), true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -221,8 +223,9 @@ struct simple_layer_normalization_bwd_t : public primitive_t {
             CHECK(safe_ptr_assign(variance,
                     new memory_t(engine, &(pd()->reordered_stat_md_),
                             std::move(variance_mem))));
-            reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
-                    {mean.get(), false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {mean.get(), false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {variance.get(), false});
         }
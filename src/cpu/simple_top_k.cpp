@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <float.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_top_k.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+namespace {
+using entry_t = simple_top_k_t::entry_t;
+
+// `a` is better than `b`: a larger value, or the same value at a lower
+// position. Used as the heap comparator, it keeps the worst of the selected
+// values at the top of the heap.
+inline bool better(const entry_t &a, const entry_t &b) {
+    return a.val > b.val || (a.val == b.val && a.idx < b.idx);
+}
+
+// Selects `k` best values of row[beg:end) into `heap`, sorted best first.
+// Values are multiplied by `sign`, so the smallest values are selected as
+// the largest negated ones. The chunk is expected to hold at least `k`
+// values.
+template <typename data_t>
+void select_chunk(const data_t *row, dim_t beg, dim_t end, dim_t k,
+        float sign, entry_t *heap) {
+    if (k == 1) {
+        float best = sign * (float)row[beg];
+        PRAGMA_OMP_SIMD(reduction(max : best))
+        for (dim_t i = beg + 1; i < end; i++)
+            best = nstl::max(best, sign * (float)row[i]);
+        dim_t best_idx = beg;
+        for (dim_t i = beg; i < end; i++) {
+            if (sign * (float)row[i] == best) {
+                best_idx = i;
+                break;
+            }
+        }
+        heap[0] = {best, (int32_t)best_idx};
+        return;
+    }
+
+    constexpr dim_t blk = 64;
+    dim_t n = 0, i = beg;
+    for (; i < end && n < k; i++) {
+        heap[n++] = {sign * (float)row[i], (int32_t)i};
+        std::push_heap(heap, heap + n, better);
+    }
+
+    float vals[blk];
+    for (; i < end; i += blk) {
+        const dim_t len = nstl::min(blk, end - i);
+        float blk_max = -FLT_MAX;
+        PRAGMA_OMP_SIMD(reduction(max : blk_max))
+        for (dim_t j = 0; j < len; j++) {
+            vals[j] = sign * (float)row[i + j];
+            blk_max = nstl::max(blk_max, vals[j]);
+        }
+        // Values equal to the worst selected one lose to it, as they come
+        // at larger positions, so the whole block can be skipped.
+        if (!(blk_max > heap[0].val)) continue;
+        for (dim_t j = 0; j < len; j++) {
+            if (!(vals[j] > heap[0].val)) continue;
+            std::pop_heap(heap, heap + k, better);
+            heap[k - 1] = {vals[j], (int32_t)(i + j)};
+            std::push_heap(heap, heap + k, better);
+        }
+    }
+    std::sort_heap(heap, heap + k, better);
+}
+} // namespace
+
+template <data_type_t src_dt>
+status_t simple_top_k_t::execute_impl(const exec_ctx_t &ctx) const {
+    using data_t = typename prec_traits_t<src_dt>::type;
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper idx_d(pd()->dst_md(1));
+
+    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_TOP_K_INDICES, status);
+    CHECK(status);
+    auto heaps = ctx.get_scratchpad_grantor().template get<entry_t>(
+            key_top_k_heap);
+
+    const dim_t N = pd()->axis_size();
+    const dim_t K = pd()->k();
+    const dim_t nrows = pd()->nrows();
+    const dim_t nchunks = pd()->nchunks_;
+    dim_t inner = 1;
+    for (int d = pd()->axis() + 1; d < pd()->ndims(); d++)
+        inner *= src_d.dims()[d];
+
+    const float sign
+            = pd()->alg_kind() == alg_kind::reduction_max ? 1.f : -1.f;
+    const auto dst_dt = dst_d.data_type();
+
+    // Offset of the first element of row `r` in a tensor with `len` elements
+    // along the axis. Elements of a row are contiguous.
+    auto row_off = [&](const memory_desc_wrapper &d, dim_t r, dim_t len) {
+        return d.off_l((r / inner) * len * inner + r % inner);
+    };
+    auto store_row = [&](dim_t r, const entry_t *sel) {
+        const dim_t dst_off = row_off(dst_d, r, K);
+        const dim_t idx_off = row_off(idx_d, r, K);
+        for (dim_t j = 0; j < K; j++) {
+            io::store_float_value(dst_dt, sign * sel[j].val, dst, dst_off + j);
+            indices[idx_off + j] = sel[j].idx;
+        }
+    };
+
+    if (nchunks == 1) {
+        parallel(pd()->nthr_, [&](int ithr, int nthr) {
+            dim_t r_beg {0}, r_end {0};
+            balance211(nrows, nthr, ithr, r_beg, r_end);
+            entry_t *heap = heaps + ithr * K;
+            for (dim_t r = r_beg; r < r_end; r++) {
+                select_chunk(src + row_off(src_d, r, N), 0, N, K, sign, heap);
+                store_row(r, heap);
+            }
+        });
+        return status::success;
+    }
+
+    // Long rows: every chunk gets its own heap, the heaps of a row are merged
+    // after all the chunks are done.
+    parallel_nd(nrows, nchunks, [&](dim_t r, dim_t c) {
+        dim_t beg {0}, end {0};
+        balance211(N, nchunks, c, beg, end);
+        select_chunk(src + row_off(src_d, r, N), beg, end, K, sign,
+                heaps + (r * nchunks + c) * K);
+    });
+    parallel_nd(nrows, [&](dim_t r) {
+        entry_t *cand = heaps + r * nchunks * K;
+        std::partial_sort(cand, cand + K, cand + nchunks * K, better);
+        store_row(r, cand);
+    });
+
+    return status::success;
+}
+
+status_t simple_top_k_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    switch (pd()->src_md()->data_type) {
+        case f32: return execute_impl<f32>(ctx);
+        case bf16: return execute_impl<bf16>(ctx);
+        case f16: return execute_impl<f16>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::unimplemented;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TOP_K_HPP
+#define CPU_SIMPLE_TOP_K_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/top_k_pd.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Top-k along the innermost dense axis. Every row is scanned once: a size-k
+// heap keeps the best values seen so far and blocks of the row that cannot
+// improve the heap are skipped after a vectorized block maximum. With k equal
+// to one the heap is replaced by a vectorized maximum search.
+//
+// When there are fewer rows than threads, long rows are split into chunks
+// processed by different threads; the partial heaps of the chunks are then
+// merged.
+struct simple_top_k_t : public primitive_t {
+    struct entry_t {
+        float val;
+        int32_t idx;
+    };
+
+    struct pd_t : public top_k_pd_t {
+        using top_k_pd_t::top_k_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_top_k_t);
+
+        status_t init(engine_t *engine) {
+            for (auto dt : {src_md()->data_type, dst_md()->data_type})
+                VDISPATCH_TOP_K(platform::has_data_type_support(dt),
+                        VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOP_K(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_TOP_K(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            for (auto md : {src_md(), dst_md(0), dst_md(1)}) {
+                const memory_desc_wrapper mdw(md);
+                VDISPATCH_TOP_K(!mdw.has_runtime_dims_or_strides(),
+                        VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+                VDISPATCH_TOP_K(mdw.is_plain() && !mdw.has_zero_dim()
+                                && mdw.blocking_desc().strides[axis()] == 1,
+                        VERBOSE_UNSUPPORTED_TAG);
+            }
+            VDISPATCH_TOP_K(axis_size() <= INT32_MAX, VERBOSE_BAD_DIM, "src",
+                    axis());
+
+            init_conf();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_ = 1;
+        // Number of chunks every row is split into.
+        dim_t nchunks_ = 1;
+
+    private:
+        void init_conf() {
+            // Chunks shorter than this are not worth the merge step.
+            const dim_t min_chunk = nstl::max<dim_t>(k(), 4096);
+            nthr_ = dnnl_get_max_threads();
+            if (nrows() < nthr_)
+                nchunks_ = nstl::max<dim_t>(1,
+                        nstl::min<dim_t>(
+                                nthr_ / nrows(), axis_size() / min_chunk));
+        }
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            // A heap per thread, or a heap per chunk when rows are split:
+            // nrows() * nchunks_ never exceeds the number of threads.
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<entry_t>(key_top_k_heap, nthr_ * k());
+        }
+    };
+
+    simple_top_k_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    template <data_type_t src_dt>
+    status_t execute_impl(const exec_ctx_t &ctx) const;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
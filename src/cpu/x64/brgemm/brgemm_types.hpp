@@ -256,6 +256,8 @@ struct brgemm_desc_t {
 
     int is_oc_scale = 0;
     bool with_dst_scales = false;
+    // Scales of matrix A which vary along M, applied on top of the `scales`.
+    bool with_src_scales_per_m = false;
     // Grouping in batch used by brdgmm kernel
     int bs_group {0};
 
@@ -452,7 +454,7 @@ struct brgemm_desc_t {
                 brgemm_broadcast_t::none, zp_type_a, zp_type_b, zp_type_c);
         return dt_c != dt_d || with_eltwise || with_binary || with_scales
                 || with_bias || with_sum || req_s8s8_compensation
-                || has_zero_points || with_dst_scales;
+                || has_zero_points || with_dst_scales || with_src_scales_per_m;
     }
 
     bool is_xf16() const noexcept { return is_bf16 || is_f16; }
@@ -554,6 +556,7 @@ struct brgemm_kernel_params_t {
     size_t skip_accm = 0;
     int32_t zp_a_val = 1;
     const void *ptr_dst_scales = nullptr;
+    const void *ptr_src_scales = nullptr;
     dim_t dynamic_LDA = 0;
     dim_t dynamic_LDB = 0;
     dim_t dynamic_LDC = 0;
@@ -664,6 +667,9 @@ private:
 /// @param dst_scales - Vector of inverted scale factor values for matix C,
 ///     common scale vector type only is supported, it must be broadcasted to
 ///     vector of simd width length.
+/// @param src_scales - Vector of scale factor values for matrix A, one per
+///     row of the block (vector length is M). Used only if
+///     brgemm_desc_t::with_src_scales_per_m = true.
 ///
 struct brgemm_post_ops_data_t {
     brgemm_post_ops_data_t() = default;
@@ -677,7 +683,8 @@ struct brgemm_post_ops_data_t {
             const void *c_zp_values = nullptr, bool skip_accumulation = false,
             int32_t zp_a_val = 1, bool do_only_comp = false,
             bool do_only_zp_a_val = false, const float *dst_scales = nullptr,
-            const void *a_zp_values = nullptr)
+            const void *a_zp_values = nullptr,
+            const float *src_scales = nullptr)
         : bias(bias)
         , scales(scales)
         , binary_post_ops_rhs(binary_post_ops_rhs)
@@ -693,7 +700,8 @@ struct brgemm_post_ops_data_t {
         , do_only_comp {do_only_comp}
         , do_only_zp_a_val {do_only_zp_a_val}
         , dst_scales(dst_scales)
-        , a_zp_values(a_zp_values) {}
+        , a_zp_values(a_zp_values)
+        , src_scales(src_scales) {}
 
     const void *bias = nullptr;
     const float *scales = nullptr;
@@ -711,6 +719,7 @@ struct brgemm_post_ops_data_t {
     const bool do_only_zp_a_val = false;
     const float *dst_scales = nullptr;
     const void *a_zp_values = nullptr;
+    const float *src_scales = nullptr;
 };
 
 } // namespace x64
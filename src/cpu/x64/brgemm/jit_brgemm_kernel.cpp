@@ -200,6 +200,8 @@ private:
     const reg64_t reg_aux_zp_comp_b = reg_rdb_loop;
     const reg64_t reg_zp_c_values = reg_rdb_loop;
     const reg64_t reg_aux_zp_c_values = reg_rdb_loop;
+    const reg64_t reg_src_scales = reg_rdb_loop;
+    const reg64_t reg_aux_src_scales = reg_rdb_loop;
     const reg64_t reg_tmp_read_values = reg_rdb_loop;
 
     const reg64_t reg_aux_scales = reg_aux_B;
@@ -267,7 +269,9 @@ private:
     // these are used for FP8 as temporary push/pop spaces
     constexpr static int reg_val_tmp_1_ = 256;
     constexpr static int reg_val_tmp_2_ = 264;
-    constexpr static int stack_space_needed_ = 272;
+    constexpr static int reg_src_scales_offs_ = 272;
+    constexpr static int reg_aux_src_scales_offs_ = 280;
+    constexpr static int stack_space_needed_ = 288;
 
     bool is_ldb_loop_ = false;
     bool with_binary_non_scalar_bcast_ = false;
@@ -459,6 +463,8 @@ private:
     dim_t bdb_zp_comp_a_offset(dim_t bd_block2) const noexcept;
     dim_t zp_comp_b_offset(dim_t bd) const noexcept;
     dim_t bdb_zp_comp_b_offset(dim_t bd_block2) const noexcept;
+    dim_t src_scales_offset(dim_t bd) const noexcept;
+    dim_t bdb_src_scales_offset(dim_t bd_block2) const noexcept;
     dim_t zp_c_values_offset(dim_t ld, bool is_tail = false) const noexcept;
 
     bool vpad_exist = false;
@@ -629,6 +635,17 @@ dim_t jit_brgemm_kernel_t<Wmm>::bdb_zp_comp_b_offset(
     return zp_comp_b_offset(bd_block2 * brg.bd_block);
 }
 
+template <typename Wmm>
+dim_t jit_brgemm_kernel_t<Wmm>::src_scales_offset(dim_t bd) const noexcept {
+    return sizeof(float) * bd;
+}
+
+template <typename Wmm>
+dim_t jit_brgemm_kernel_t<Wmm>::bdb_src_scales_offset(
+        dim_t bd_block2) const noexcept {
+    return src_scales_offset(bd_block2 * brg.bd_block);
+}
+
 template <typename Wmm>
 dim_t jit_brgemm_kernel_t<Wmm>::zp_c_values_offset(
         dim_t ld, bool is_tail) const noexcept {
@@ -761,6 +778,11 @@ void jit_brgemm_kernel_t<Wmm>::advance_bdb_post_op_regs(dim_t adj_bd_block) {
         add(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(1));
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
     }
+    if (brg.with_src_scales_per_m) {
+        mov(reg_aux_src_scales, ptr[rsp + reg_aux_src_scales_offs_]);
+        add(reg_aux_src_scales, bdb_src_scales_offset(1));
+        mov(ptr[rsp + reg_aux_src_scales_offs_], reg_aux_src_scales);
+    }
     if (brg.req_comp_pads_with_bcast
             && brg.zp_type_a != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
@@ -779,6 +801,12 @@ void jit_brgemm_kernel_t<Wmm>::restore_bdb_post_op_regs(dim_t bd_block2) {
             sub(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(bd_block2 - 1));
             mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
         }
+        if (brg.with_src_scales_per_m) {
+            post_processed = true;
+            mov(reg_aux_src_scales, ptr[rsp + reg_aux_src_scales_offs_]);
+            sub(reg_aux_src_scales, bdb_src_scales_offset(bd_block2 - 1));
+            mov(ptr[rsp + reg_aux_src_scales_offs_], reg_aux_src_scales);
+        }
         if (brg.req_comp_pads_with_bcast
                 && brg.zp_type_a != brgemm_broadcast_t::none) {
             mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
@@ -856,6 +884,12 @@ void jit_brgemm_kernel_t<Wmm>::advance_bd_block2_post_op_regs(dim_t bd_block2) {
         add(reg_zp_comp_b, bdb_zp_comp_b_offset(bd_block2));
         mov(ptr[rsp + reg_zp_comp_b_offs_], reg_zp_comp_b);
     }
+
+    if (brg.with_src_scales_per_m) {
+        mov(reg_src_scales, ptr[rsp + reg_src_scales_offs_]);
+        add(reg_src_scales, bdb_src_scales_offset(bd_block2));
+        mov(ptr[rsp + reg_src_scales_offs_], reg_src_scales);
+    }
 }
 
 template <typename Wmm>
@@ -892,6 +926,10 @@ void jit_brgemm_kernel_t<Wmm>::copy_post_ops_stack_values_to_aux(
         mov(reg_zp_comp_b, ptr[rsp + reg_zp_comp_b_offs_]);
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_zp_comp_b);
     }
+    if (brg.with_src_scales_per_m) {
+        mov(reg_src_scales, ptr[rsp + reg_src_scales_offs_]);
+        mov(ptr[rsp + reg_aux_src_scales_offs_], reg_src_scales);
+    }
 }
 
 template <typename Wmm>
@@ -960,6 +998,11 @@ void jit_brgemm_kernel_t<Wmm>::read_params() {
         mov(ptr[rsp + reg_dst_scales_offs_], reg_dst_scales);
     }
 
+    if (brg.with_src_scales_per_m) {
+        mov(reg_src_scales, ptr[param1 + GET_OFF(ptr_src_scales)]);
+        mov(ptr[rsp + reg_src_scales_offs_], reg_src_scales);
+    }
+
     if (brg.is_runtime_ldc) {
         mov(reg_tmp_read_values, ptr[param1 + GET_OFF(dynamic_LDC)]);
         if (brg.typesize_C > 1) shl(reg_tmp_read_values, (brg.typesize_C >> 1));
@@ -1319,6 +1362,28 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
         }
     }
 
+    if (brg.with_src_scales_per_m) {
+        mov(reg_aux_src_scales, ptr[rsp + reg_aux_src_scales_offs_]);
+        for (dim_t bd = 0; bd < bd_block; bd++) {
+            const auto src_scales_off = src_scales_offset(bd);
+            auto vmm_src_scales = vmm_tmp(0);
+            if (!is_superset(brg.isa_impl, avx512_core))
+                uni_vbroadcastss(vmm_src_scales,
+                        ptr[reg_aux_src_scales + src_scales_off]);
+            for (dim_t ld = 0; ld < ld_block2; ld++) {
+                auto vmm = accm(ld_block2, bd, ld);
+                if (dq2ps_required && !brg.with_scales)
+                    uni_vcvtdq2ps(vmm, vmm);
+                if (is_superset(brg.isa_impl, avx512_core))
+                    vmulps(vmm, vmm,
+                            EVEX_compress_addr(reg_aux_src_scales,
+                                    src_scales_off, true));
+                else
+                    uni_vmulps(vmm, vmm, vmm_src_scales);
+            }
+        }
+    }
+
     if (brg.with_bias) { mov(reg_aux_bias, ptr[rsp + reg_aux_bias_offs_]); }
 
     if (brg.is_fp8_via_convert()) mov(ptr[rsp + reg_val_tmp_1_], reg64_fp8_aux);
@@ -1332,7 +1397,9 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
         }
         for (dim_t bd = 0; bd < bd_block; bd++) {
             auto vmm = accm(ld_block2, bd, ld);
-            if (dq2ps_required && !brg.with_scales) uni_vcvtdq2ps(vmm, vmm);
+            if (dq2ps_required && !brg.with_scales
+                    && !brg.with_src_scales_per_m)
+                uni_vcvtdq2ps(vmm, vmm);
             if (brg.with_bias) uni_vaddps(vmm, vmm, vmm_bias);
         }
     }
@@ -1739,6 +1806,7 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators(dim_t bd_block2,
                         advance_bdb_post_op_regs(adj_bd_block);
                         post_processed |= utils::one_of(true,
                                 brg.zp_type_b != brgemm_broadcast_t::none,
+                                brg.with_src_scales_per_m,
                                 brg.req_comp_pads_with_bcast
                                         && brg.zp_type_a
                                                 != brgemm_broadcast_t::none);
@@ -1340,9 +1340,15 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
     maybe_conv_weights(ctx, wei, wei);
 
+    dim_t MB = jcp.mb;
+    if (jcp.is_runtime_mb)
+        CHECK(get_runtime_mb(ctx,
+                {{DNNL_ARG_SRC, _pd->src_md()}, {DNNL_ARG_DST, _pd->dst_md()}},
+                MB));
+
     // --------------- Parallel section ------------------------------
-    const dim_t work_amount = static_cast<dim_t>(jcp.mb) * jcp.ngroups
-            * jcp.nb_oc * jcp.nb_od * jcp.nb_oh * jcp.nb_ow;
+    const dim_t work_amount = MB * jcp.ngroups * jcp.nb_oc * jcp.nb_od
+            * jcp.nb_oh * jcp.nb_ow;
     // TODO: consider loop by icc be innermost because for current
     // implementation if we use buffer then we accumulate in it only on row
     // or made ic_chunks = 1 if use_buffer
@@ -1386,7 +1392,7 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         balance211(work_amount, nthr, ithr, start, end);
 
         int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
-        BRGEMM_CONV_ITERATOR_INIT;
+        BRGEMM_CONV_ITERATOR_INIT(MB);
         for (auto work = start; work < end; work++) {
             btc.g = g;
             btc.n = n;
@@ -1440,7 +1446,7 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                 last_btc.ohb = ohb;
                 last_btc.owb = owb;
             }
-            BRGEMM_CONV_ITERATOR_STEP;
+            BRGEMM_CONV_ITERATOR_STEP(MB);
         }
         if (is_amx) { amx_tile_release(); }
     });
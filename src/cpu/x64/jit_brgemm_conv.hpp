@@ -58,6 +58,8 @@ struct brgemm_convolution_fwd_t : public primitive_t {
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_conv_fwd:", isa, ""),
                 brgemm_convolution_fwd_t);
 
+        static constexpr bool supports_runtime_dims = true;
+
         status_t init(engine_t *engine);
 
         int brgs_sz_;
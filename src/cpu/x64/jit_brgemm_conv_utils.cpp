@@ -817,7 +817,7 @@ float brg_blocking_t::est_eff() {
             int start {0}, end {0};
             balance211(work_amount, nthr, ithr, start, end);
             int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
-            BRGEMM_CONV_ITERATOR_INIT;
+            BRGEMM_CONV_ITERATOR_INIT(jcp.mb);
 
             for (auto work = start; work < end; work++) {
                 const int ocp = ocb * oc_block;
@@ -827,7 +827,7 @@ float brg_blocking_t::est_eff() {
                 sp_sz = nstl::min(sp - spp, sp_block);
                 thr_job += sp_sz * oc_sz;
 
-                BRGEMM_CONV_ITERATOR_STEP;
+                BRGEMM_CONV_ITERATOR_STEP(jcp.mb);
             }
             thr_jobs[ithr] = thr_job;
         }
@@ -1684,7 +1684,10 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     jcp.ndims = ndims;
     jcp.prop_kind = cd.prop_kind;
     jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
-    jcp.mb = src_d.dims()[0];
+    // The blocking for a runtime minibatch is chosen as for a single image,
+    // so there is enough parallel work for any minibatch.
+    jcp.is_runtime_mb = is_runtime_value(src_d.dims()[0]);
+    jcp.mb = jcp.is_runtime_mb ? 1 : src_d.dims()[0];
     jcp.oc_without_padding = dst_d.dims()[1];
     jcp.oc = jcp.oc_without_padding / jcp.ngroups;
     jcp.ic_without_padding = src_d.dims()[1] / jcp.ngroups;
@@ -1784,7 +1787,8 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         // Therefore we require
         // IMPLICATION(jcp.ic > jcp.simd_w, jcp.ic % jcp.simd_w == 0)
         // TODO: check if it may go to kw lowering
-        const bool pure_1d = (jcp.mb == 1 && jcp.id == 1 && jcp.ih == 1);
+        const bool pure_1d = (jcp.mb == 1 && !jcp.is_runtime_mb
+                && jcp.id == 1 && jcp.ih == 1);
         auto w_koef_max = nstl::min(jcp.kw, nstl::min(jcp.stride_w, jcp.iw));
         for (int i = 1; i <= w_koef_max; i++) {
             if (IMPLICATION(!pure_1d, jcp.iw % i == 0)
@@ -1883,6 +1887,9 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     const int binary_ind = p.find(primitive_kind::binary);
     const int prelu_ind = p.find(primitive_kind::prelu);
     jcp.with_binary = !everyone_is(-1, binary_ind, prelu_ind);
+    // Binary post-op arguments are addressed by the full dst shape.
+    VDISPATCH_CONV_IC(IMPLICATION(jcp.is_runtime_mb, !jcp.with_binary),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     const auto &zp = attr.zero_points_;
     jcp.src_zero_point
@@ -2482,8 +2489,8 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         auto max_size = 0.75f * brg_blocking_t::L2;
         const dim_t os = static_cast<dim_t>(jcp.od) * jcp.oh * jcp.ow;
         const dim_t os_cutoff = 400; // approximate and empiric
-        const bool use_loop_ngcdhw
-                = max_size < wei_size || (jcp.mb == 1 && os < os_cutoff);
+        const bool use_loop_ngcdhw = max_size < wei_size
+                || (jcp.mb == 1 && !jcp.is_runtime_mb && os < os_cutoff);
         jcp.loop_order = use_loop_ngcdhw ? loop_ngcdhw : loop_ndhwgc;
     }
 
@@ -2564,7 +2571,8 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     if (is_amx(isa)) {
         // heuristic for small mb
         const bool is_small_mb = jcp.nthr > 1 && jcp.mb == 1
-                && jcp.ic * jcp.oh <= 28 * 1024 && jcp.oc * jcp.oh <= 14 * 1024;
+                && !jcp.is_runtime_mb && jcp.ic * jcp.oh <= 28 * 1024
+                && jcp.oc * jcp.oh <= 14 * 1024;
         MAYBE_UNUSED(is_small_mb);
         // non-unrolled kernel does not support bf32, only dispatch unrolled
         // kernel for now
@@ -71,33 +71,34 @@ void get_ow_range(const jit_brgemm_conv_conf_t &jcp, int ow, int kw, int &ow_s,
 void get_kw_range(const jit_brgemm_conv_conf_t &jcp, int ow, int &kw_s,
         int &kw_full_s, int &kw_full_f, int &kw_f);
 
-#define BRGEMM_CONV_NDHWGC_ORDER \
-    n, jcp.mb, odb, jcp.nb_od, ohb, jcp.nb_oh, owb, jcp.nb_ow, g, jcp.ngroups, \
+#define BRGEMM_CONV_NDHWGC_ORDER(mb) \
+    n, mb, odb, jcp.nb_od, ohb, jcp.nb_oh, owb, jcp.nb_ow, g, jcp.ngroups, \
             ocb, jcp.nb_oc
-#define BRGEMM_CONV_NGCDHW_ORDER \
-    n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc, odb, jcp.nb_od, ohb, jcp.nb_oh, \
+#define BRGEMM_CONV_NGCDHW_ORDER(mb) \
+    n, mb, g, jcp.ngroups, ocb, jcp.nb_oc, odb, jcp.nb_od, ohb, jcp.nb_oh, \
             owb, jcp.nb_ow
-#define BRGEMM_CONV_GCNDHW_ORDER \
-    g, jcp.ngroups, ocb, jcp.nb_oc, n, jcp.mb, odb, jcp.nb_od, ohb, jcp.nb_oh, \
+#define BRGEMM_CONV_GCNDHW_ORDER(mb) \
+    g, jcp.ngroups, ocb, jcp.nb_oc, n, mb, odb, jcp.nb_od, ohb, jcp.nb_oh, \
             owb, jcp.nb_ow
 
-#define BRGEMM_CONV_ITERATOR_INIT \
+// `mb` is passed explicitly as it may be defined only at execution time.
+#define BRGEMM_CONV_ITERATOR_INIT(mb) \
     if (jcp.loop_order == loop_ndhwgc) \
-        nd_iterator_init(start, BRGEMM_CONV_NDHWGC_ORDER); \
+        nd_iterator_init(start, BRGEMM_CONV_NDHWGC_ORDER(mb)); \
     else if (jcp.loop_order == loop_ngcdhw) \
-        nd_iterator_init(start, BRGEMM_CONV_NGCDHW_ORDER); \
+        nd_iterator_init(start, BRGEMM_CONV_NGCDHW_ORDER(mb)); \
     else if (jcp.loop_order == loop_gcndhw) \
-        nd_iterator_init(start, BRGEMM_CONV_GCNDHW_ORDER); \
+        nd_iterator_init(start, BRGEMM_CONV_GCNDHW_ORDER(mb)); \
     else \
         assert(!"Unknown loop order");
 
-#define BRGEMM_CONV_ITERATOR_STEP \
+#define BRGEMM_CONV_ITERATOR_STEP(mb) \
     if (jcp.loop_order == loop_ndhwgc) \
-        nd_iterator_step(BRGEMM_CONV_NDHWGC_ORDER); \
+        nd_iterator_step(BRGEMM_CONV_NDHWGC_ORDER(mb)); \
     else if (jcp.loop_order == loop_ngcdhw) \
-        nd_iterator_step(BRGEMM_CONV_NGCDHW_ORDER); \
+        nd_iterator_step(BRGEMM_CONV_NGCDHW_ORDER(mb)); \
     else if (jcp.loop_order == loop_gcndhw) \
-        nd_iterator_step(BRGEMM_CONV_GCNDHW_ORDER); \
+        nd_iterator_step(BRGEMM_CONV_GCNDHW_ORDER(mb)); \
     else \
         assert(!"Unknown loop order");
 
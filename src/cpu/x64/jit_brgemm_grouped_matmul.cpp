@@ -0,0 +1,431 @@
+/*******************************************************************************
+* Copyright 2023-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/grouped_matmul_utils.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+constexpr dim_t default_m_blk = 32;
+constexpr dim_t default_n_blk = 64;
+// Rows of a single task. Big enough to amortize the conversion of a block of
+// weights, small enough to split a large group across the threads.
+constexpr dim_t max_m_chunk = 256;
+
+// A unit of work: rows [m_start, m_end) of group `g` times column block `nb`.
+// `cost` is the number of FLOPs of all the preceding tasks.
+struct task_t {
+    dim_t g, m_start, m_end, nb;
+    dim_t cost;
+};
+
+bool is_supported_dt(data_type_t dt) {
+    return one_of(dt, f32, bf16, f16) && platform::has_data_type_support(dt);
+}
+
+// Converts `n` elements with stride `stride` (in elements) from `src` of type
+// `dt` into contiguous f32 buffer `dst`.
+void cvt_to_f32(
+        float *dst, const void *src, data_type_t dt, dim_t n, dim_t stride) {
+    if (stride == 1) {
+        switch (dt) {
+            case f32: std::memcpy(dst, src, n * sizeof(float)); return;
+            case bf16:
+                cvt_bfloat16_to_float(
+                        dst, static_cast<const bfloat16_t *>(src), n);
+                return;
+            case f16:
+                cvt_float16_to_float(
+                        dst, static_cast<const float16_t *>(src), n);
+                return;
+            default: assert(!"unsupported data type"); return;
+        }
+    }
+    for (dim_t i = 0; i < n; i++)
+        dst[i] = io::load_float_value(dt, src, i * stride);
+}
+
+// Converts `n` elements of contiguous f32 buffer `src` into `dst` of type `dt`
+// with stride `stride` (in elements).
+void cvt_from_f32(
+        void *dst, const float *src, data_type_t dt, dim_t n, dim_t stride) {
+    if (stride == 1) {
+        switch (dt) {
+            case f32: std::memcpy(dst, src, n * sizeof(float)); return;
+            case bf16:
+                cvt_float_to_bfloat16(static_cast<bfloat16_t *>(dst), src, n);
+                return;
+            case f16:
+                cvt_float_to_float16(static_cast<float16_t *>(dst), src, n);
+                return;
+            default: assert(!"unsupported data type"); return;
+        }
+    }
+    for (dim_t i = 0; i < n; i++)
+        io::store_float_value(dt, src[i], dst, i * stride);
+}
+
+// Copies `n` elements with stride `stride` (in elements) from `src` of type
+// `dt` into contiguous buffer `dst` of type `dst_dt`, which is either f32 or
+// `dt` itself.
+void copy_row(void *dst, data_type_t dst_dt, const void *src, data_type_t dt,
+        dim_t n, dim_t stride) {
+    if (dst_dt == f32) {
+        cvt_to_f32(static_cast<float *>(dst), src, dt, n, stride);
+        return;
+    }
+    assert(dst_dt == dt);
+    const size_t dt_sz = types::data_type_size(dt);
+    if (stride == 1) {
+        std::memcpy(dst, src, n * dt_sz);
+        return;
+    }
+    for (dim_t i = 0; i < n; i++)
+        std::memcpy(static_cast<char *>(dst) + i * dt_sz,
+                static_cast<const char *>(src) + i * stride * dt_sz, dt_sz);
+}
+
+// Packs `K` rows of `n` 16-bit weights with strides `str_k` and `str_n` (in
+// elements) into `dst` in the VNNI layout [div_up(K, vnni)][ld][vnni]. The
+// tail of the reduction dimension is zero-padded.
+void pack_b_vnni(void *dst, const void *src, dim_t K, dim_t n, dim_t ld,
+        dim_t vnni, dim_t str_k, dim_t str_n) {
+    const auto *s = static_cast<const uint16_t *>(src);
+    auto *d = static_cast<uint16_t *>(dst);
+    for (dim_t k0 = 0; k0 < K; k0 += vnni) {
+        uint16_t *d_blk = d + (k0 / vnni) * ld * vnni;
+        const dim_t cur_k = nstl::min(vnni, K - k0);
+        for (dim_t j = 0; j < n; j++) {
+            for (dim_t v = 0; v < cur_k; v++)
+                d_blk[j * vnni + v] = s[(k0 + v) * str_k + j * str_n];
+            for (dim_t v = cur_k; v < vnni; v++)
+                d_blk[j * vnni + v] = 0;
+        }
+    }
+}
+
+} // namespace
+
+status_t brgemm_grouped_matmul_t::pd_t::init(engine_t *engine) {
+    VDISPATCH_GROUPED_MATMUL(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GROUPED_MATMUL(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GROUPED_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_grouped_matmul_t::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    c.src_dt = src_d.data_type();
+    c.wei_dt = wei_d.data_type();
+    c.dst_dt = dst_d.data_type();
+    VDISPATCH_GROUPED_MATMUL(is_supported_dt(c.src_dt)
+                    && is_supported_dt(c.wei_dt) && is_supported_dt(c.dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GROUPED_MATMUL(
+            src_d.is_plain() && wei_d.is_plain() && dst_d.is_plain(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    c.ngroups = ngroups();
+    c.M = M();
+    c.K = K();
+    c.N = N();
+    VDISPATCH_GROUPED_MATMUL(c.K > 0, VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_GROUPED_MATMUL(c.N > 0, VERBOSE_EMPTY_TENSOR, "dst");
+
+    // Up-conversion to f32 is used only when the ISA lacks native support for
+    // the input data type.
+    c.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    c.in_dt = f32;
+    if (c.src_dt == c.wei_dt) {
+        if (c.src_dt == bf16 && mayiuse(avx512_core_bf16)) {
+            c.isa = avx512_core_bf16;
+            c.in_dt = bf16;
+        } else if (c.src_dt == f16 && mayiuse(avx512_core_fp16)) {
+            c.isa = avx512_core_fp16;
+            c.in_dt = f16;
+        }
+    }
+    c.wei_vnni = brgemm_desc_t::is_b_data_layout_vnni(
+                         c.in_dt, c.in_dt, false, c.isa)
+            ? static_cast<dim_t>(data_type_vnni_granularity(c.in_dt))
+            : 1;
+
+    c.m_blk = default_m_blk;
+    c.n_blk = nstl::min(c.N, default_n_blk);
+    c.nb_n = div_up(c.N, c.n_blk);
+
+    const auto &src_str = src_d.blocking_desc().strides;
+    const auto &wei_str = wei_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+    c.copy_a = c.src_dt != c.in_dt || src_str[1] != 1;
+    c.copy_b = c.wei_dt != c.in_dt || wei_str[1] != 1 || c.wei_vnni > 1;
+    c.use_c_buf = c.dst_dt != f32 || dst_str[1] != 1;
+    c.lda = c.copy_a ? c.K : src_str[0];
+    c.ldb = c.copy_b ? c.n_blk : wei_str[0];
+    c.ldc = c.use_c_buf ? c.n_blk : dst_str[0];
+
+    // Every group adds at most one partial chunk of rows on top of the
+    // chunks of the whole source.
+    c.max_tasks = (div_up(c.M, c.m_blk) + c.ngroups) * c.nb_n;
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_grouped_matmul_t::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    for (int m_idx = 0; m_idx < max_m_kernels; m_idx++)
+        for (bool is_n_tail : {false, true}) {
+            const dim_t M = c.m_blk >> m_idx;
+            const dim_t N = is_n_tail ? c.N % c.n_blk : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            brgemm_attr_t brgattr;
+            brgattr.max_bs = 1;
+
+            auto &d = brg_descs_[get_brg_idx(m_idx, is_n_tail)];
+            CHECK(brgemm_desc_init(&d, c.isa, brgemm_addr, c.in_dt, c.in_dt,
+                    false, false, brgemm_row_major, 1.f, 0.f, c.lda, c.ldb,
+                    c.ldc, M, N, c.K));
+            CHECK(brgemm_desc_set_attr(&d, brgattr));
+            CHECK(brgemm_desc_finalize(&d));
+        }
+
+    return status::success;
+}
+
+void brgemm_grouped_matmul_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    const size_t in_dt_sz = types::data_type_size(c.in_dt);
+    scratchpad.book<task_t>(key_grouped_matmul_tasks, c.max_tasks);
+    if (c.copy_a)
+        scratchpad.book(key_grouped_matmul_a_buffer, c.nthr * c.m_blk * c.K,
+                in_dt_sz);
+    if (c.copy_b)
+        scratchpad.book(key_grouped_matmul_b_buffer,
+                c.nthr * rnd_up(c.K, c.wei_vnni) * c.n_blk, in_dt_sz);
+    if (c.use_c_buf)
+        scratchpad.book<float>(
+                key_grouped_matmul_c_buffer, c.nthr * c.m_blk * c.n_blk);
+}
+
+status_t brgemm_grouped_matmul_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::brg_kernels_num; idx++) {
+        const auto &d = pd()->brg_descs_[idx];
+        if (d.bcast_dim * d.load_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, d));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+status_t brgemm_grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto src_base = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    auto dst_base = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    CHECK(grouped_matmul_offsets_check(offsets, c.ngroups, c.M));
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &src_str = src_d.blocking_desc().strides;
+    const auto &wei_str = wei_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+
+    const size_t src_dt_sz = types::data_type_size(c.src_dt);
+    const size_t wei_dt_sz = types::data_type_size(c.wei_dt);
+    const size_t dst_dt_sz = types::data_type_size(c.dst_dt);
+    const size_t in_dt_sz = types::data_type_size(c.in_dt);
+
+    std::vector<const char *> weights(c.ngroups);
+    for (dim_t g = 0; g < c.ngroups; g++)
+        weights[g] = CTX_IN_MEM(const char *, DNNL_ARG_GROUP_WEIGHTS(g))
+                + wei_d.offset0() * wei_dt_sz;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    task_t *tasks = scratchpad.template get<task_t>(key_grouped_matmul_tasks);
+    char *a_buf_base
+            = scratchpad.template get<char>(key_grouped_matmul_a_buffer);
+    char *b_buf_base
+            = scratchpad.template get<char>(key_grouped_matmul_b_buffer);
+    float *c_buf_base
+            = scratchpad.template get<float>(key_grouped_matmul_c_buffer);
+
+    // Size the chunks of rows so that every thread gets a few tasks, which
+    // keeps the FLOP-based split below close to the ideal one.
+    const dim_t total_rows = offsets[c.ngroups] - offsets[0];
+    if (total_rows == 0) return status::success;
+    const dim_t m_chunk = nstl::min(max_m_chunk,
+            rnd_up(div_up(total_rows * c.nb_n, 4 * c.nthr), c.m_blk));
+
+    // Groups are laid out one after another with the blocks of rows being
+    // the innermost dimension, so a thread working on consecutive tasks keeps
+    // reusing the same block of weights.
+    dim_t ntasks = 0;
+    dim_t total_cost = 0;
+    for (dim_t g = 0; g < c.ngroups; g++) {
+        const dim_t m_lo = offsets[g];
+        const dim_t m_hi = offsets[g + 1];
+        for (dim_t nb = 0; nb < c.nb_n; nb++) {
+            const dim_t cur_n = nstl::min(c.n_blk, c.N - nb * c.n_blk);
+            for (dim_t m = m_lo; m < m_hi; m += m_chunk) {
+                const dim_t m_end = nstl::min(m + m_chunk, m_hi);
+                assert(ntasks < c.max_tasks);
+                tasks[ntasks++] = {g, m, m_end, nb, total_cost};
+                total_cost += (m_end - m) * cur_n * c.K;
+            }
+        }
+    }
+
+    const task_t *tasks_begin = tasks;
+    const task_t *tasks_end = tasks + ntasks;
+    const int work_nthr = adjust_num_threads(c.nthr, ntasks);
+    parallel(work_nthr, [&](const int ithr, const int nthr) {
+        // A thread takes the tasks starting within its share of FLOPs.
+        const auto by_cost
+                = [](const task_t &t, dim_t cost) { return t.cost < cost; };
+        const dim_t cost_lo = total_cost * ithr / nthr;
+        const dim_t cost_hi = total_cost * (ithr + 1) / nthr;
+        const task_t *start
+                = std::lower_bound(tasks_begin, tasks_end, cost_lo, by_cost);
+        const task_t *end = ithr == nthr - 1
+                ? tasks_end
+                : std::lower_bound(start, tasks_end, cost_hi, by_cost);
+
+        char *a_buf = a_buf_base + ithr * c.m_blk * c.K * in_dt_sz;
+        char *b_buf = b_buf_base
+                + ithr * rnd_up(c.K, c.wei_vnni) * c.n_blk * in_dt_sz;
+        float *c_buf = c_buf_base + ithr * c.m_blk * c.n_blk;
+
+        brgemm_batch_element_t batch;
+        dim_t cached_g = -1, cached_nb = -1;
+
+        for (const task_t *t = start; t < end; t++) {
+            const dim_t n0 = t->nb * c.n_blk;
+            const dim_t cur_n = nstl::min(c.n_blk, c.N - n0);
+            const bool is_n_tail = cur_n < c.n_blk;
+
+            const char *wei_ptr = weights[t->g] + n0 * wei_str[1] * wei_dt_sz;
+            if (c.copy_b) {
+                if (t->g != cached_g || t->nb != cached_nb) {
+                    if (c.wei_vnni > 1)
+                        pack_b_vnni(b_buf, wei_ptr, c.K, cur_n, c.n_blk,
+                                c.wei_vnni, wei_str[0], wei_str[1]);
+                    else
+                        for (dim_t k = 0; k < c.K; k++)
+                            copy_row(b_buf + k * c.n_blk * in_dt_sz, c.in_dt,
+                                    wei_ptr + k * wei_str[0] * wei_dt_sz,
+                                    c.wei_dt, cur_n, wei_str[1]);
+                    cached_g = t->g;
+                    cached_nb = t->nb;
+                }
+                batch.ptr.B = b_buf;
+            } else {
+                batch.ptr.B = wei_ptr;
+            }
+
+            for (dim_t m = t->m_start; m < t->m_end;) {
+                // Take the largest kernel fitting into the remaining rows.
+                const dim_t rem = t->m_end - m;
+                int m_idx = 0;
+                while ((c.m_blk >> m_idx) > rem)
+                    m_idx++;
+                const dim_t cur_m = c.m_blk >> m_idx;
+
+                const char *src_ptr = src_base
+                        + (src_d.offset0() + m * src_str[0]) * src_dt_sz;
+                char *dst_ptr = dst_base
+                        + (dst_d.offset0() + m * dst_str[0] + n0 * dst_str[1])
+                                * dst_dt_sz;
+
+                if (c.copy_a) {
+                    for (dim_t i = 0; i < cur_m; i++)
+                        copy_row(a_buf + i * c.K * in_dt_sz, c.in_dt,
+                                src_ptr + i * src_str[0] * src_dt_sz, c.src_dt,
+                                c.K, src_str[1]);
+                    batch.ptr.A = a_buf;
+                } else {
+                    batch.ptr.A = src_ptr;
+                }
+
+                const int brg_idx = pd_t::get_brg_idx(m_idx, is_n_tail);
+                brgemm_kernel_execute(brg_kernels_[brg_idx].get(), 1, &batch,
+                        c.use_c_buf ? (void *)c_buf : (void *)dst_ptr);
+
+                if (c.use_c_buf)
+                    for (dim_t i = 0; i < cur_m; i++)
+                        cvt_from_f32(dst_ptr + i * dst_str[0] * dst_dt_sz,
+                                c_buf + i * c.n_blk, c.dst_dt, cur_n,
+                                dst_str[1]);
+
+                m += cur_m;
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2023-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_JIT_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/grouped_matmul_pd.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct brgemm_grouped_matmul_conf_t {
+    cpu_isa_t isa;
+
+    // Problem sizes: number of groups, total number of rows of all groups and
+    // the reduction and output dimensions shared by all groups.
+    dim_t ngroups, M, K, N;
+
+    // Blocking over rows and columns. Row blocks are processed with kernels
+    // of `m_blk >> i` rows, so any number of rows of a group is covered by at
+    // most log2(m_blk) + 1 kernel calls per block of `m_blk` rows.
+    dim_t m_blk, n_blk, nb_n;
+
+    data_type_t src_dt, wei_dt, dst_dt;
+
+    // Data type of the inputs of the kernels. bf16 and f16 inputs are used
+    // natively on the ISAs supporting them and up-converted to f32 otherwise.
+    data_type_t in_dt;
+    // VNNI granularity of the weights layout expected by the kernels.
+    dim_t wei_vnni;
+
+    // Inputs of other data types, strided inputs and weights in the VNNI
+    // layout are copied into thread-local buffers. Non-f32 or strided output
+    // is accumulated in a thread-local f32 buffer.
+    bool copy_a, copy_b, use_c_buf;
+    dim_t lda, ldb, ldc;
+
+    // Upper bound of the number of tasks built at execution time.
+    dim_t max_tasks;
+
+    int nthr;
+};
+
+// Grouped matrix multiplication for mixture-of-experts and other ragged
+// workloads.
+//
+// All the groups are scheduled in a single parallel region. The work is split
+// into tasks of (group, block of rows, block of columns) once the group
+// offsets are known, and the tasks are distributed across threads in
+// contiguous ranges of equal number of FLOPs, so a thread may work on several
+// small groups while a large group is shared by several threads.
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public grouped_matmul_pd_t {
+        using grouped_matmul_pd_t::grouped_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", conf_.isa, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_grouped_matmul_conf_t conf_ = utils::zero<decltype(conf_)>();
+
+        // Kernel indices: [log2(m_blk / rows)][is_n_tail].
+        static int get_brg_idx(int m_idx, bool is_n_tail) {
+            return 2 * m_idx + (int)is_n_tail;
+        }
+        static constexpr int max_m_kernels = 6;
+        static constexpr int brg_kernels_num = 2 * max_m_kernels;
+
+        brgemm_desc_t brg_descs_[brg_kernels_num];
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::brg_kernels_num];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,512 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Blocking defaults: Q, K, V, score and accumulator blocks of a single thread
+// stay in L2 for head sizes up to 256.
+constexpr dim_t default_q_block = 64;
+constexpr dim_t default_k_block = 128;
+
+bool is_supported_dt(data_type_t dt) {
+    return one_of(dt, f32, bf16, f16) && platform::has_data_type_support(dt);
+}
+
+// Loads `n` elements with stride `stride` (in elements) from `src` of type
+// `dt` into contiguous f32 buffer `dst` multiplying them by `alpha`.
+void load_row(float *dst, const void *src, data_type_t dt, dim_t n,
+        dim_t stride, float alpha) {
+    if (stride == 1) {
+        switch (dt) {
+            case f32: std::memcpy(dst, src, n * sizeof(float)); break;
+            case bf16:
+                cvt_bfloat16_to_float(
+                        dst, static_cast<const bfloat16_t *>(src), n);
+                break;
+            case f16:
+                cvt_float16_to_float(
+                        dst, static_cast<const float16_t *>(src), n);
+                break;
+            default: assert(!"unsupported data type");
+        }
+        if (alpha != 1.f)
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < n; i++)
+                dst[i] *= alpha;
+        return;
+    }
+    for (dim_t i = 0; i < n; i++)
+        dst[i] = alpha * io::load_float_value(dt, src, i * stride);
+}
+
+// Stores `n` elements of contiguous f32 buffer `src` multiplied by `alpha`
+// into `dst` of type `dt` with stride `stride` (in elements). `src` is used as
+// a temporary storage.
+void store_row(void *dst, float *src, data_type_t dt, dim_t n, dim_t stride,
+        float alpha) {
+    if (stride == 1) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < n; i++)
+            src[i] *= alpha;
+        switch (dt) {
+            case f32: std::memcpy(dst, src, n * sizeof(float)); break;
+            case bf16:
+                cvt_float_to_bfloat16(static_cast<bfloat16_t *>(dst), src, n);
+                break;
+            case f16:
+                cvt_float_to_float16(static_cast<float16_t *>(dst), src, n);
+                break;
+            default: assert(!"unsupported data type");
+        }
+        return;
+    }
+    for (dim_t i = 0; i < n; i++)
+        io::store_float_value(dt, alpha * src[i], dst, i * stride);
+}
+
+// Transposes `n` rows of `hs` contiguous elements of type `dt`, stored with
+// row stride `stride` (in elements), into the f32 buffer `dst` with leading
+// dimension `ld`. The rows are converted tile by tile with contiguous loads
+// and each tile is transposed while it stays in L1.
+void transpose_rows(float *dst, dim_t ld, const char *src, data_type_t dt,
+        dim_t n, dim_t hs, dim_t stride) {
+    constexpr dim_t tile = 16;
+    float buf[tile * tile];
+    const size_t dt_sz = types::data_type_size(dt);
+    for (dim_t j0 = 0; j0 < n; j0 += tile) {
+        const dim_t nj = nstl::min(tile, n - j0);
+        for (dim_t d0 = 0; d0 < hs; d0 += tile) {
+            const dim_t nd = nstl::min(tile, hs - d0);
+            for (dim_t j = 0; j < nj; j++)
+                load_row(buf + j * tile,
+                        src + ((j0 + j) * stride + d0) * dt_sz, dt, nd, 1,
+                        1.f);
+            for (dim_t d = 0; d < nd; d++) {
+                float *out = dst + (d0 + d) * ld + j0;
+                PRAGMA_OMP_SIMD()
+                for (dim_t j = 0; j < nj; j++)
+                    out[j] = buf[j * tile + d];
+            }
+        }
+    }
+}
+
+} // namespace
+
+status_t brgemm_sdpa_fwd_t::pd_t::init(engine_t *engine) {
+    VDISPATCH_SDPA(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(!with_key_scales() && !with_key_zp()
+                    && !with_value_scales() && !with_value_zp(),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_SDPA(
+            utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
+                    val_md()->ndims, dst_md()->ndims),
+            VERBOSE_BAD_NDIMS, "dst", dst_md()->ndims);
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_fwd_t::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+
+    const memory_desc_wrapper q_d(qry_md());
+    const memory_desc_wrapper k_d(key_md());
+    const memory_desc_wrapper v_d(val_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const memory_desc_wrapper msk_d(attn_mask_md());
+
+    c.q_dt = q_d.data_type();
+    c.k_dt = k_d.data_type();
+    c.v_dt = v_d.data_type();
+    c.dst_dt = dst_d.data_type();
+    VDISPATCH_SDPA(is_supported_dt(c.q_dt) && is_supported_dt(c.k_dt)
+                    && is_supported_dt(c.v_dt) && is_supported_dt(c.dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+
+    VDISPATCH_SDPA(q_d.is_plain() && k_d.is_plain() && v_d.is_plain()
+                    && dst_d.is_plain(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    c.mb = dst_d.dims()[0];
+    c.nheads = dst_d.dims()[1];
+    c.kv_nheads = k_d.dims()[1];
+    c.nq = desc()->queries();
+    c.nk = desc()->keys();
+    c.hs = desc()->head_size();
+    c.hs_v = desc()->values();
+
+    // Keys and values may be broadcast over the minibatch and shared across
+    // groups of query heads (grouped-query attention).
+    VDISPATCH_SDPA(q_d.dims()[0] == c.mb && q_d.dims()[1] == c.nheads,
+            VERBOSE_INCONSISTENT_DIM, "q", 0, "dst", 0);
+    VDISPATCH_SDPA(one_of(k_d.dims()[0], 1, c.mb)
+                    && one_of(v_d.dims()[0], 1, c.mb),
+            VERBOSE_INVALID_BROADCAST, "k", 0);
+    VDISPATCH_SDPA(v_d.dims()[1] == c.kv_nheads && c.nheads % c.kv_nheads == 0,
+            VERBOSE_INCONSISTENT_DIM, "k", 1, "v", 1);
+
+    c.with_scale = with_attn_scale();
+    c.scale_dt = desc()->scale_dt;
+    c.invert_scale = desc()->invert_scale;
+    if (c.with_scale)
+        VDISPATCH_SDPA(is_supported_dt(c.scale_dt), VERBOSE_UNSUPPORTED_DT);
+
+    c.mask_type = desc()->mask_type;
+    c.with_causal_mask = with_causal_mask();
+    c.with_mask = with_attn_mask() && !c.with_causal_mask;
+    c.msk_dt = c.with_mask ? msk_d.data_type() : data_type::undef;
+    if (c.with_mask) {
+        VDISPATCH_SDPA(is_supported_dt(c.msk_dt), VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SDPA(msk_d.ndims() == 4 && msk_d.is_plain(),
+                VERBOSE_UNSUPPORTED_TAG);
+        const dim_t full_dims[4] = {c.mb, c.nheads, c.nq, c.nk};
+        for (int d = 0; d < 4; d++)
+            VDISPATCH_SDPA(one_of(msk_d.dims()[d], 1, full_dims[d]),
+                    VERBOSE_INVALID_BROADCAST, "mask", d);
+    }
+
+    c.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    c.q_block = nstl::min(c.nq, default_q_block);
+    c.k_block = nstl::min(c.nk, default_k_block);
+    c.nb_q = div_up(c.nq, c.q_block);
+    c.nb_k = div_up(c.nk, c.k_block);
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_fwd_t::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    for (bool is_q_tail : {false, true})
+        for (bool is_k_tail : {false, true}) {
+            const dim_t M = is_q_tail ? c.nq % c.q_block : c.q_block;
+            const dim_t K_seq = is_k_tail ? c.nk % c.k_block : c.k_block;
+            if (M == 0 || K_seq == 0) continue;
+            const int idx = get_brg_idx(is_q_tail, is_k_tail);
+
+            brgemm_attr_t brgattr;
+            brgattr.max_bs = 1;
+
+            // S[q_block, k_block] = Q[q_block, hs] * K^T[hs, k_block]
+            auto &kq = brg_kq_[idx];
+            CHECK(brgemm_desc_init(&kq, c.isa, brgemm_addr, f32, f32, false,
+                    false, brgemm_row_major, 1.f, 0.f, c.hs, c.k_block,
+                    c.k_block, M, K_seq, c.hs));
+            CHECK(brgemm_desc_set_attr(&kq, brgattr));
+            CHECK(brgemm_desc_finalize(&kq));
+
+            // O[q_block, hs_v] += P[q_block, k_block] * V[k_block, hs_v]
+            auto &vs = brg_vs_[idx];
+            CHECK(brgemm_desc_init(&vs, c.isa, brgemm_addr, f32, f32, false,
+                    false, brgemm_row_major, 1.f, 1.f, c.k_block, c.hs_v,
+                    c.hs_v, M, c.hs_v, K_seq));
+            CHECK(brgemm_desc_set_attr(&vs, brgattr));
+            CHECK(brgemm_desc_finalize(&vs));
+        }
+
+    return status::success;
+}
+
+void brgemm_sdpa_fwd_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.book<float>(key_sdpa_q_buffer, c.nthr * c.q_block * c.hs);
+    scratchpad.book<float>(key_sdpa_k_buffer, c.nthr * c.hs * c.k_block);
+    scratchpad.book<float>(key_sdpa_v_buffer, c.nthr * c.k_block * c.hs_v);
+    scratchpad.book<float>(key_sdpa_score, c.nthr * c.q_block * c.k_block);
+    scratchpad.book<float>(key_sdpa_acc, c.nthr * c.q_block * c.hs_v);
+    // Running max and running sum per query.
+    scratchpad.book<float>(key_sdpa_stats, c.nthr * 2 * c.q_block);
+}
+
+status_t brgemm_sdpa_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::brg_kernels_num; idx++) {
+        const auto &kq = pd()->brg_kq_[idx];
+        const auto &vs = pd()->brg_vs_[idx];
+        if (kq.bcast_dim * kq.load_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, kq));
+        CHECK(safe_ptr_assign(brg_kq_kernels_[idx], ker));
+        CHECK(brgemm_kernel_create(&ker, vs));
+        CHECK(safe_ptr_assign(brg_vs_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+status_t brgemm_sdpa_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto q_base = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    const auto k_base = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    const auto v_base = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    const auto msk_base = CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK);
+    const auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto dst_base = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper q_d(pd()->qry_md());
+    const memory_desc_wrapper k_d(pd()->key_md());
+    const memory_desc_wrapper v_d(pd()->val_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper msk_d(pd()->attn_mask_md());
+
+    const auto &q_str = q_d.blocking_desc().strides;
+    const auto &k_str = k_d.blocking_desc().strides;
+    const auto &v_str = v_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+    const auto &msk_str = msk_d.blocking_desc().strides;
+
+    float scale = 1.f;
+    if (c.with_scale) {
+        scale = io::load_float_value(c.scale_dt, scale_ptr, 0);
+        if (c.invert_scale) scale = 1.f / scale;
+    }
+
+    const dim_t kv_group = c.nheads / c.kv_nheads;
+    // Shift of the causal diagonal: for the bottom-right variant the last
+    // query attends to all the keys.
+    const dim_t causal_shift
+            = c.mask_type == attn_mask_type::bottom_right ? c.nk - c.nq : 0;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *q_buf_base = scratchpad.template get<float>(key_sdpa_q_buffer);
+    float *k_buf_base = scratchpad.template get<float>(key_sdpa_k_buffer);
+    float *v_buf_base = scratchpad.template get<float>(key_sdpa_v_buffer);
+    float *s_buf_base = scratchpad.template get<float>(key_sdpa_score);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    float *stats_base = scratchpad.template get<float>(key_sdpa_stats);
+
+    const size_t q_dt_sz = types::data_type_size(c.q_dt);
+    const size_t k_dt_sz = types::data_type_size(c.k_dt);
+    const size_t v_dt_sz = types::data_type_size(c.v_dt);
+    const size_t dst_dt_sz = types::data_type_size(c.dst_dt);
+    const size_t msk_dt_sz
+            = c.with_mask ? types::data_type_size(c.msk_dt) : size_t(0);
+
+    const dim_t work_amount = c.mb * c.nheads * c.nb_q;
+    // With a causal mask the cost of a query block grows with its index, so
+    // a static split leaves the threads owning the first blocks idle. Let
+    // them steal work block by block. Otherwise the work is uniform and each
+    // thread takes its whole balance211 range at once.
+    const dim_t grain = c.with_causal_mask
+            ? 1
+            : utils::div_up(work_amount, nstl::min<dim_t>(c.nthr, work_amount));
+
+    const auto ker = [&](const int ithr, int, const dim_t start,
+                             const dim_t end) {
+        float *q_buf = q_buf_base + ithr * c.q_block * c.hs;
+        float *k_buf = k_buf_base + ithr * c.hs * c.k_block;
+        float *v_buf = v_buf_base + ithr * c.k_block * c.hs_v;
+        float *s_buf = s_buf_base + ithr * c.q_block * c.k_block;
+        float *acc = acc_base + ithr * c.q_block * c.hs_v;
+        float *row_max = stats_base + ithr * 2 * c.q_block;
+        float *row_sum = row_max + c.q_block;
+
+        brgemm_batch_element_t batch;
+
+        dim_t mb {0}, h {0}, qb {0};
+        nd_iterator_init(start, mb, c.mb, h, c.nheads, qb, c.nb_q);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t q0 = qb * c.q_block;
+            const dim_t cur_q = nstl::min(c.q_block, c.nq - q0);
+            const bool is_q_tail = cur_q < c.q_block;
+
+            const dim_t kv_mb = k_d.dims()[0] == 1 ? 0 : mb;
+            const dim_t kv_h = h / kv_group;
+
+            const char *q_ptr = q_base
+                    + (q_d.offset0() + mb * q_str[0] + h * q_str[1]
+                              + q0 * q_str[2])
+                            * q_dt_sz;
+            const char *k_ptr = k_base
+                    + (k_d.offset0() + kv_mb * k_str[0] + kv_h * k_str[1])
+                            * k_dt_sz;
+            const char *v_ptr = v_base
+                    + (v_d.offset0() + (v_d.dims()[0] == 1 ? 0 : mb) * v_str[0]
+                              + kv_h * v_str[1])
+                            * v_dt_sz;
+            char *dst_ptr = dst_base
+                    + (dst_d.offset0() + mb * dst_str[0] + h * dst_str[1]
+                              + q0 * dst_str[2])
+                            * dst_dt_sz;
+            const char *msk_ptr = c.with_mask ? msk_base
+                            + (msk_d.offset0()
+                                      + (msk_d.dims()[0] == 1 ? 0 : mb)
+                                              * msk_str[0]
+                                      + (msk_d.dims()[1] == 1 ? 0 : h)
+                                              * msk_str[1])
+                                    * msk_dt_sz
+                                              : nullptr;
+            const dim_t msk_q_str = c.with_mask && msk_d.dims()[2] != 1
+                    ? msk_str[2]
+                    : dim_t(0);
+            const dim_t msk_k_str = c.with_mask && msk_d.dims()[3] != 1
+                    ? msk_str[3]
+                    : dim_t(0);
+
+            // The scale is folded into the queries to save a pass over the
+            // scores.
+            for (dim_t i = 0; i < cur_q; i++)
+                load_row(q_buf + i * c.hs, q_ptr + i * q_str[2] * q_dt_sz,
+                        c.q_dt, c.hs, q_str[3], scale);
+
+            for (dim_t i = 0; i < cur_q; i++) {
+                row_max[i] = -INFINITY;
+                row_sum[i] = 0.f;
+            }
+            std::memset(acc, 0, sizeof(float) * cur_q * c.hs_v);
+
+            // Key blocks above the causal diagonal do not contribute to the
+            // result.
+            const dim_t nk_eff = c.with_causal_mask
+                    ? nstl::max<dim_t>(0,
+                            nstl::min(c.nk, q0 + cur_q + causal_shift))
+                    : c.nk;
+
+            for (dim_t k0 = 0; k0 < nk_eff; k0 += c.k_block) {
+                const dim_t cur_k = nstl::min(c.k_block, c.nk - k0);
+                const bool is_k_tail = cur_k < c.k_block;
+                const int brg_idx = pd_t::get_brg_idx(is_q_tail, is_k_tail);
+
+                // K is logically [hs, nk]: gather a [hs, cur_k] block.
+                if (k_str[3] == 1 || k_str[2] != 1) {
+                    for (dim_t d = 0; d < c.hs; d++)
+                        load_row(k_buf + d * c.k_block,
+                                k_ptr + (d * k_str[2] + k0 * k_str[3])
+                                        * k_dt_sz,
+                                c.k_dt, cur_k, k_str[3], 1.f);
+                } else {
+                    // Transposed keys: read contiguous rows of `hs` elements.
+                    transpose_rows(k_buf, c.k_block,
+                            k_ptr + k0 * k_str[3] * k_dt_sz, c.k_dt, cur_k,
+                            c.hs, k_str[3]);
+                }
+                for (dim_t j = 0; j < cur_k; j++)
+                    load_row(v_buf + j * c.hs_v,
+                            v_ptr + (k0 + j) * v_str[2] * v_dt_sz, c.v_dt,
+                            c.hs_v, v_str[3], 1.f);
+
+                batch.ptr.A = q_buf;
+                batch.ptr.B = k_buf;
+                brgemm_kernel_execute(
+                        brg_kq_kernels_[brg_idx].get(), 1, &batch, s_buf);
+
+                for (dim_t i = 0; i < cur_q; i++) {
+                    float *s = s_buf + i * c.k_block;
+                    if (c.with_mask) {
+                        const char *m = msk_ptr
+                                + ((q0 + i) * msk_q_str + k0 * msk_k_str)
+                                        * msk_dt_sz;
+                        for (dim_t j = 0; j < cur_k; j++)
+                            s[j] += io::load_float_value(
+                                    c.msk_dt, m, j * msk_k_str);
+                    }
+                    if (c.with_causal_mask) {
+                        const dim_t last_k = q0 + i + causal_shift;
+                        for (dim_t j = nstl::max<dim_t>(0, last_k + 1 - k0);
+                                j < cur_k; j++)
+                            s[j] = -INFINITY;
+                    }
+
+                    float blk_max = -INFINITY;
+                    for (dim_t j = 0; j < cur_k; j++)
+                        blk_max = nstl::max(blk_max, s[j]);
+                    const float new_max = nstl::max(row_max[i], blk_max);
+
+                    if (new_max == -INFINITY) {
+                        // Fully masked so far: nothing to accumulate.
+                        std::memset(s, 0, sizeof(float) * cur_k);
+                        continue;
+                    }
+
+                    float blk_sum = 0.f;
+                    for (dim_t j = 0; j < cur_k; j++) {
+                        s[j] = ::expf(s[j] - new_max);
+                        blk_sum += s[j];
+                    }
+
+                    const float corr = ::expf(row_max[i] - new_max);
+                    row_sum[i] = row_sum[i] * corr + blk_sum;
+                    row_max[i] = new_max;
+                    if (corr != 1.f) {
+                        float *o = acc + i * c.hs_v;
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t d = 0; d < c.hs_v; d++)
+                            o[d] *= corr;
+                    }
+                }
+
+                batch.ptr.A = s_buf;
+                batch.ptr.B = v_buf;
+                brgemm_kernel_execute(
+                        brg_vs_kernels_[brg_idx].get(), 1, &batch, acc);
+            }
+
+            for (dim_t i = 0; i < cur_q; i++) {
+                const float inv_sum
+                        = row_sum[i] > 0.f ? 1.f / row_sum[i] : 0.f;
+                store_row(dst_ptr + i * dst_str[2] * dst_dt_sz,
+                        acc + i * c.hs_v, c.dst_dt, c.hs_v, dst_str[3],
+                        inv_sum);
+            }
+
+            nd_iterator_step(mb, c.mb, h, c.nheads, qb, c.nb_q);
+        }
+    };
+    parallel_dynamic(c.nthr, work_amount, grain, ker);
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct brgemm_sdpa_conf_t {
+    cpu_isa_t isa;
+
+    // Problem sizes: batch (mb), query heads, key/value heads, number of
+    // queries, number of keys, head size of queries/keys and of values.
+    dim_t mb, nheads, kv_nheads, nq, nk, hs, hs_v;
+
+    // Blocking over queries and keys. Each thread owns a block of queries and
+    // walks over all key blocks keeping running softmax statistics, so the
+    // full score matrix is never materialized.
+    dim_t q_block, k_block;
+    dim_t nb_q, nb_k;
+
+    data_type_t q_dt, k_dt, v_dt, dst_dt, msk_dt, scale_dt;
+    bool with_scale, invert_scale;
+    bool with_mask, with_causal_mask;
+    attn_mask_type_t mask_type;
+
+    int nthr;
+};
+
+// Flash-attention style scaled dot-product attention.
+//
+// For every (mb, head, query block) the implementation computes
+//   S = Q * K^T                 (brgemm, f32 accumulation)
+//   P = exp(S - max), rescale   (online softmax over key blocks)
+//   O += P * V                  (brgemm, f32 accumulation)
+// and normalizes O by the running sum once all key blocks are processed.
+// Q, K and V blocks are up-converted to f32 into thread-local buffers which
+// also handles arbitrary plain strides and the transposed key layout.
+struct brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public sdpa_pd_t {
+        using sdpa_pd_t::sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", conf_.isa, ""),
+                brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_sdpa_conf_t conf_ = utils::zero<decltype(conf_)>();
+
+        // Kernel indices: [is_q_tail][is_k_tail].
+        static int get_brg_idx(bool is_q_tail, bool is_k_tail) {
+            return 2 * (int)is_q_tail + (int)is_k_tail;
+        }
+        static constexpr int brg_kernels_num = 4;
+
+        brgemm_desc_t brg_kq_[brg_kernels_num];
+        brgemm_desc_t brg_vs_[brg_kernels_num];
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kq_kernels_[pd_t::brg_kernels_num];
+    std::unique_ptr<brgemm_kernel_t> brg_vs_kernels_[pd_t::brg_kernels_num];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -281,9 +281,10 @@ inline bool has_large_size(const convolution_desc_t &cd,
         const memory_desc_wrapper &dst_d) {
     auto is_large = [](const dim_t val) { return val > INT_MAX; };
     auto img_size = [](const memory_desc_wrapper &mem_d) {
-        // assuming that first dimension for src and dst is minibatch
-        const auto mb = mem_d.dims()[0] != 0 ? mem_d.dims()[0] : 1;
-        return mem_d.nelems() / mb;
+        // assuming that first dimension for src and dst is minibatch, which
+        // may be unknown until execution
+        if (mem_d.dims()[0] == 0) return dim_t(0);
+        return utils::array_product(mem_d.dims() + 1, mem_d.ndims() - 1);
     };
 
     // Check if numbers of elements (excepting minibatch) for any memory
@@ -712,7 +713,10 @@ struct jit_brgemm_conv_conf_t {
     conv_harness_t harness;
     int simd_w, acc_simd_w, amx_w, amx_h;
     int ndims;
+    // With a runtime minibatch, `mb` is only a representative value used by
+    // the blocking heuristics.
     int mb;
+    bool is_runtime_mb;
     int ngroups, ic, oc, oc_without_padding, ic_without_padding;
 
     int od_block, oh_block, nb_od,
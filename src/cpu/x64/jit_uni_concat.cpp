@@ -0,0 +1,463 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/jit_uni_concat.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace concat_impl {
+using namespace Xbyak;
+using namespace data_type;
+
+template <cpu_isa_t isa>
+struct jit_concat_kernel_t : public jit_concat_kernel_base_t,
+                             public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_concat_kernel_t)
+
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    static constexpr auto vlen = cpu_isa_traits_t<isa>::vlen;
+    static constexpr dim_t simd_w_ = vlen / sizeof(float);
+    static constexpr int unroll_regs_ = 4;
+
+    jit_concat_kernel_t(const kernel_conf_t &conf)
+        : jit_concat_kernel_base_t(conf)
+        , jit_generator_t(jit_name(), isa)
+        , src_dt_size_(conf.zero_fill ? 0 : types::data_type_size(conf.src_dt))
+        , dst_dt_size_(types::data_type_size(conf.dst_dt))
+        , tail_(conf.nelems % simd_w_) {
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx_,
+                vtail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
+                bf16_emu_zmm_2_idx_, bf16_emu_zmm_3_idx_, reg_tmp,
+                bf16_emu_zmm_4_idx_);
+        io::io_saturation_conf_t io_saturation_conf(
+                vzero.getIdx(), vsaturation_ubound.getIdx(), reg_tmp);
+        typename io::jit_io_multi_dt_helper_t<Vmm>::data_types_t dts {
+                conf.dst_dt};
+        if (!conf.zero_fill) dts.insert(conf.src_dt);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa, dts, io_conf,
+                io_tail_conf, io_bf16_conf,
+                {{conf.dst_dt, io_saturation_conf}});
+    }
+
+    void operator()(const call_params_t *p) const override {
+        return jit_generator_t::operator()(p);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    const size_t src_dt_size_;
+    const size_t dst_dt_size_;
+    const dim_t tail_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_nrows = r10;
+    Reg64 reg_src_cur = r11;
+    Reg64 reg_dst_cur = r12;
+    Reg64 reg_loop_cnt = r13;
+    Reg64 reg_tmp = r14;
+
+    Vmm vtail_mask = Vmm(0);
+    Vmm vscale = Vmm(unroll_regs_ + 1);
+    Vmm vzero = Vmm(unroll_regs_ + 2);
+    Vmm vsaturation_ubound = Vmm(unroll_regs_ + 3);
+
+    const int bf16_emu_zmm_1_idx_ = 28;
+    const int bf16_emu_zmm_2_idx_ = 29;
+    const int bf16_emu_zmm_3_idx_ = 30;
+    const int bf16_emu_zmm_4_idx_ = 31;
+    const int tail_opmask_idx_ = 2;
+
+    Vmm vreg_data(int idx) const { return Vmm(1 + idx); }
+
+    // Converts `n_vregs` vectors starting at the current source pointer into
+    // the current destination pointer.
+    void copy_vregs(int n_vregs, bool tail) {
+        for (int i = 0; i < n_vregs; i++) {
+            const Vmm vmm = vreg_data(i);
+            if (conf_.zero_fill) {
+                uni_vpxor(vmm, vmm, vmm);
+                continue;
+            }
+            io_[conf_.src_dt]->load(
+                    ptr[reg_src_cur + i * simd_w_ * src_dt_size_], vmm, tail);
+            if (conf_.with_scale) uni_vmulps(vmm, vmm, vscale);
+        }
+        for (int i = 0; i < n_vregs; i++)
+            io_[conf_.dst_dt]->store(vreg_data(i),
+                    ptr[reg_dst_cur + i * simd_w_ * dst_dt_size_], tail);
+    }
+
+    void copy_row() {
+        const dim_t n_vregs = conf_.nelems / simd_w_;
+        const dim_t n_loops = n_vregs / unroll_regs_;
+        const int n_vregs_rem = static_cast<int>(n_vregs % unroll_regs_);
+
+        mov(reg_src_cur, reg_src);
+        mov(reg_dst_cur, reg_dst);
+
+        if (n_loops > 0) {
+            Label loop;
+            if (n_loops > 1) mov(reg_loop_cnt, n_loops);
+            L(loop);
+            {
+                copy_vregs(unroll_regs_, false);
+                add(reg_src_cur, unroll_regs_ * simd_w_ * src_dt_size_);
+                add(reg_dst_cur, unroll_regs_ * simd_w_ * dst_dt_size_);
+                if (n_loops > 1) {
+                    dec(reg_loop_cnt);
+                    jnz(loop, T_NEAR);
+                }
+            }
+        }
+
+        if (n_vregs_rem > 0) {
+            copy_vregs(n_vregs_rem, false);
+            add(reg_src_cur, n_vregs_rem * simd_w_ * src_dt_size_);
+            add(reg_dst_cur, n_vregs_rem * simd_w_ * dst_dt_size_);
+        }
+
+        if (tail_ > 0) copy_vregs(1, true);
+    }
+
+    void generate() override {
+        preamble();
+        io_.init_bf16();
+        if (tail_ > 0) io_.prepare_tail_mask();
+        if (types::is_integral_dt(conf_.dst_dt))
+            io_.init_saturate_f32({conf_.dst_dt});
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+        if (conf_.with_scale) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(scale)]);
+            uni_vbroadcastss(vscale, ptr[reg_tmp]);
+        }
+#undef PARAM_OFF
+
+        Label row_loop, row_loop_end;
+        L(row_loop);
+        {
+            test(reg_nrows, reg_nrows);
+            jz(row_loop_end, T_NEAR);
+
+            copy_row();
+
+            add(reg_src, conf_.src_row_stride * src_dt_size_);
+            add(reg_dst, conf_.dst_row_stride * dst_dt_size_);
+            dec(reg_nrows);
+            jmp(row_loop, T_NEAR);
+        }
+        L(row_loop_end);
+
+        postamble();
+    }
+};
+
+jit_concat_kernel_base_t *jit_concat_kernel_base_t::create(
+        const kernel_conf_t &conf, const cpu_isa_t isa) {
+#define HANDLE_ISA(isa_) \
+    if ((isa_) == isa) return new jit_concat_kernel_t<isa_>(conf);
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core_fp16));
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core_bf16));
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core));
+    REG_AVX2_ISA(HANDLE_ISA(avx2_vnni_2));
+    REG_AVX2_ISA(HANDLE_ISA(avx2));
+#undef HANDLE_ISA
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
+} // namespace concat_impl
+
+using namespace concat_impl;
+
+status_t jit_uni_concat_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using sm = primitive_attr_t::skip_mask_t;
+
+    for (const auto isa : {avx512_core_fp16, avx512_core_bf16, avx512_core,
+                 avx2_vnni_2, avx2}) {
+        if (mayiuse(isa)) {
+            isa_ = isa;
+            break;
+        }
+    }
+    VDISPATCH_CONCAT(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    VDISPATCH_CONCAT(
+            attr()->has_default_values(sm::scales), VERBOSE_UNSUPPORTED_ATTR);
+    const auto &sc = attr()->scales_;
+    for (int i = 0; i < n_inputs(); ++i) {
+        if (sc.has_default_values(DNNL_ARG_MULTIPLE_SRC + i)) continue;
+        VDISPATCH_CONCAT(sc.get_mask(DNNL_ARG_MULTIPLE_SRC + i) == 0,
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    // Unlike the default heuristic, keep the blocked layout of the inputs for
+    // the destination even if the inputs can't be represented as its
+    // sub-memories, as channel tails are handled by the kernel.
+    if (dst_md_.format_kind == format_kind::any) {
+        const memory_desc_wrapper src0_d(src_md(0));
+        VDISPATCH_CONCAT(
+                src0_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+        CHECK(memory_desc_init_by_blocking_desc(
+                dst_md_, src0_d.blocking_desc()));
+    }
+
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONCAT(dst_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_CONCAT(!dst_d.has_zero_dim(), VERBOSE_EMPTY_TENSOR, "dst");
+
+    const auto is_dt_ok = [&](data_type_t dt) {
+        return utils::one_of(dt, f32, bf16, f16, s8, u8)
+                && IMPLICATION(dt == bf16,
+                        is_superset(isa_, avx512_core) || isa_ == avx2_vnni_2)
+                && IMPLICATION(dt == f16,
+                        is_superset(isa_, avx512_core_fp16)
+                                || isa_ == avx2_vnni_2);
+    };
+    VDISPATCH_CONCAT(is_dt_ok(dst_d.data_type()), VERBOSE_UNSUPPORTED_DT);
+
+    // All tensors must be dense and share the blocking structure of the
+    // destination, which is checked by re-creating their descriptors from
+    // the destination blocking.
+    const auto has_dst_layout = [&](const memory_desc_t &md) {
+        memory_desc_t expected = md;
+        if (memory_desc_init_by_blocking_desc(expected, dst_d.blocking_desc())
+                != status::success)
+            return false;
+        return memory_desc_wrapper(md) == expected;
+    };
+    VDISPATCH_CONCAT(has_dst_layout(dst_md_), VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper src_d(src_md(i));
+        VDISPATCH_CONCAT(is_dt_ok(src_d.data_type()), VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_CONCAT(src_d.is_blocking_desc(),
+                VERBOSE_UNSUPPORTED_FORMAT_KIND);
+        VDISPATCH_CONCAT(has_dst_layout(*src_md(i)), VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    // Only a single (innermost) block over the concat dimension is supported.
+    const auto &bd = dst_d.blocking_desc();
+    for (int iblk = 0; iblk < bd.inner_nblks; ++iblk) {
+        VDISPATCH_CONCAT(IMPLICATION(bd.inner_idxs[iblk] == concat_dim(),
+                                 iblk == bd.inner_nblks - 1),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    VDISPATCH_CONCAT(init_jobs() == status::success,
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "concat");
+
+    return status::success;
+}
+
+int jit_uni_concat_t::pd_t::add_kernel(const kernel_conf_t &conf) {
+    for (size_t k = 0; k < kernel_confs_.size(); ++k)
+        if (kernel_confs_[k] == conf) return static_cast<int>(k);
+    kernel_confs_.push_back(conf);
+    return static_cast<int>(kernel_confs_.size()) - 1;
+}
+
+void jit_uni_concat_t::pd_t::add_copy(int src_idx, const kernel_conf_t &conf,
+        dim_t src_off, dim_t dst_off, dim_t nrows) {
+    if (nrows > 1) {
+        jobs_.push_back({src_idx, add_kernel(conf), src_off, dst_off, nrows});
+        return;
+    }
+
+    // A single contiguous region is split into chunks to give threads enough
+    // work when there are only a few outer blocks.
+    const dim_t chunk = 16 * 1024;
+    for (dim_t off = 0; off < conf.nelems; off += chunk) {
+        kernel_conf_t chunk_conf = conf;
+        chunk_conf.nelems = nstl::min(chunk, conf.nelems - off);
+        chunk_conf.src_row_stride = chunk_conf.dst_row_stride = 0;
+        jobs_.push_back({src_idx, add_kernel(chunk_conf), src_off + off,
+                dst_off + off, 1});
+    }
+}
+
+status_t jit_uni_concat_t::pd_t::init_jobs() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int c = concat_dim();
+
+    dims_t blocks;
+    dst_d.compute_blocks(blocks);
+    const dim_t blk = blocks[c];
+    // Stride of a block over the concat dimension, it matches for all inputs.
+    const dim_t blk_stride = dst_d.blocking_desc().strides[c];
+    const dim_t nrows = blk_stride / blk;
+    const dim_t dst_nb = dst_d.padded_dims()[c] / blk;
+
+    dst_outer_stride_ = dst_nb * blk_stride;
+    n_outer_ = dst_d.nelems(true) / dst_outer_stride_;
+    src_outer_strides_.resize(n_inputs());
+
+    const data_type_t dst_dt = dst_d.data_type();
+    const auto &sc = attr()->scales_;
+
+    dim_t off = 0;
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper src_d(src_md(i));
+        const dim_t len = src_d.dims()[c];
+        src_outer_strides_[i] = src_d.padded_dims()[c] / blk * blk_stride;
+        if (len == 0) continue;
+
+        kernel_conf_t conf = utils::zero<kernel_conf_t>();
+        conf.src_dt = src_d.data_type();
+        conf.dst_dt = dst_dt;
+        conf.src_row_stride = conf.dst_row_stride = blk;
+        conf.with_scale = !sc.has_default_values(DNNL_ARG_MULTIPLE_SRC + i);
+
+        const dim_t shift = off % blk;
+        if (shift == 0) {
+            // Input starts at a block boundary: full blocks form a single
+            // contiguous region in both tensors.
+            const dim_t nb_full = len / blk;
+            if (nb_full > 0) {
+                conf.nelems = nb_full * blk_stride;
+                add_copy(i, conf, 0, off / blk * blk_stride, 1);
+            }
+            const dim_t tail = len % blk;
+            if (tail > 0) {
+                conf.nelems = tail;
+                add_copy(i, conf, nb_full * blk_stride,
+                        (off / blk + nb_full) * blk_stride, nrows);
+            }
+        } else {
+            // Every source block spans two destination blocks.
+            for (dim_t b = 0; b < utils::div_up(len, blk); ++b) {
+                const dim_t b_len = nstl::min(blk, len - b * blk);
+                const dim_t dst_b = (off + b * blk) / blk;
+                const dim_t head = nstl::min(b_len, blk - shift);
+                conf.nelems = head;
+                add_copy(i, conf, b * blk_stride, dst_b * blk_stride + shift,
+                        nrows);
+                if (b_len > head) {
+                    conf.nelems = b_len - head;
+                    add_copy(i, conf, b * blk_stride + head,
+                            (dst_b + 1) * blk_stride, nrows);
+                }
+            }
+        }
+        off += len;
+    }
+
+    // Keep the padded area of the last destination block zeroed.
+    if (off % blk != 0) {
+        kernel_conf_t conf = utils::zero<kernel_conf_t>();
+        conf.src_dt = conf.dst_dt = dst_dt;
+        conf.nelems = blk - off % blk;
+        conf.src_row_stride = conf.dst_row_stride = blk;
+        conf.zero_fill = true;
+        add_copy(-1, conf, 0, off / blk * blk_stride + off % blk, nrows);
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_concat_t::init(engine_t *engine) {
+    const auto &confs = pd()->kernel_confs_;
+    kernels_.resize(confs.size());
+    for (size_t k = 0; k < confs.size(); ++k) {
+        CHECK(safe_ptr_assign(kernels_[k],
+                jit_concat_kernel_base_t::create(confs[k], pd()->isa_)));
+        CHECK(kernels_[k]->create_kernel());
+    }
+    return status::success;
+}
+
+status_t jit_uni_concat_t::execute(const exec_ctx_t &ctx) const {
+    const int n = pd()->n_inputs();
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+    dst += dst_d.offset0() * dst_d.data_type_size();
+
+    std::vector<const char *> srcs(n, nullptr);
+    std::vector<size_t> src_dt_sizes(n);
+    std::vector<float> scales(n, 1.f);
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper src_d(pd()->src_md(i));
+        src_dt_sizes[i] = src_d.data_type_size();
+        const auto src = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + i);
+        if (src != nullptr)
+            srcs[i] = src + src_d.offset0() * src_d.data_type_size();
+
+        DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_MULTIPLE_SRC + i);
+        scales[i] = src_scales[0];
+    }
+
+    const auto &jobs = pd()->jobs_;
+    const auto &src_outer_strides = pd()->src_outer_strides_;
+    const dim_t dst_outer_stride = pd()->dst_outer_stride_;
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    parallel_nd(pd()->n_outer_, static_cast<dim_t>(jobs.size()),
+            [&](dim_t o, dim_t j) {
+                const auto &job = jobs[j];
+                jit_concat_kernel_base_t::call_params_t p;
+                p.src = nullptr;
+                p.scale = nullptr;
+                if (job.src_idx >= 0) {
+                    const int i = job.src_idx;
+                    if (srcs[i] == nullptr) return;
+                    p.src = srcs[i]
+                            + (o * src_outer_strides[i] + job.src_off)
+                                    * src_dt_sizes[i];
+                    p.scale = &scales[i];
+                }
+                p.dst = dst
+                        + (o * dst_outer_stride + job.dst_off) * dst_dt_size;
+                p.nrows = job.nrows;
+                (*kernels_[job.ker_idx])(&p);
+            });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
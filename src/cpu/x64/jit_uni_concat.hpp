@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_CONCAT_HPP
+#define CPU_X64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace concat_impl {
+
+// Describes a single kernel: it copies `nrows` rows of `nelems` contiguous
+// elements each, converting from `src_dt` to `dst_dt` and optionally applying
+// a common scale. A zero-fill kernel writes zeros instead and has no source.
+struct kernel_conf_t {
+    data_type_t src_dt, dst_dt;
+    dim_t nelems;
+    dim_t src_row_stride, dst_row_stride; // in elements
+    bool with_scale;
+    bool zero_fill;
+
+    bool operator==(const kernel_conf_t &rhs) const {
+        return src_dt == rhs.src_dt && dst_dt == rhs.dst_dt
+                && nelems == rhs.nelems
+                && src_row_stride == rhs.src_row_stride
+                && dst_row_stride == rhs.dst_row_stride
+                && with_scale == rhs.with_scale && zero_fill == rhs.zero_fill;
+    }
+};
+
+// A unit of work executed for every outer index. Offsets are in elements and
+// are relative to the outer block of the corresponding tensor.
+struct job_t {
+    int src_idx; // input index, -1 for zero-fill of the dst padded area
+    int ker_idx;
+    dim_t src_off, dst_off;
+    dim_t nrows;
+};
+
+// This class isolates primitive implementation from templates introduced by
+// the kernel.
+struct jit_concat_kernel_base_t {
+    static jit_concat_kernel_base_t *create(
+            const kernel_conf_t &conf, const cpu_isa_t isa);
+
+    virtual ~jit_concat_kernel_base_t() = default;
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *src, *dst;
+        const float *scale;
+        size_t nrows;
+    };
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+
+protected:
+    jit_concat_kernel_base_t(const kernel_conf_t &conf) : conf_(conf) {}
+
+    const kernel_conf_t conf_;
+};
+} // namespace concat_impl
+
+// Concatenation of inputs sharing the layout of the destination. Unlike
+// `simple_concat_t` it converts data types on the fly (with optional common
+// scales per input) and supports concatenation over a blocked dimension when
+// the sizes of the inputs are not a multiple of the block (e.g. nChw16c with
+// 24 + 40 channels), without going through an intermediate buffer.
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        const char *impl_name() const {
+            return JIT_IMPL_NAME_HELPER("jit:", isa_, "");
+        }
+
+        DECLARE_CONCAT_PD_T(impl_name(), jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        cpu_isa_t isa_ = isa_undef;
+        // Number of outer blocks, i.e. all dimensions in front of the concat
+        // one collapsed together.
+        dim_t n_outer_ = 0;
+        dim_t dst_outer_stride_ = 0;
+        std::vector<dim_t> src_outer_strides_;
+        std::vector<concat_impl::kernel_conf_t> kernel_confs_;
+        std::vector<concat_impl::job_t> jobs_;
+
+    private:
+        status_t init_jobs();
+        int add_kernel(const concat_impl::kernel_conf_t &conf);
+        void add_copy(int src_idx, const concat_impl::kernel_conf_t &conf,
+                dim_t src_off, dim_t dst_off, dim_t nrows);
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<std::unique_ptr<concat_impl::jit_concat_kernel_base_t>>
+            kernels_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,476 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/embedding_bag_utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+#include "cpu/x64/jit_uni_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+
+namespace {
+cpu_isa_t get_io_isa(cpu_isa_t isa, bool has_f16, bool has_bf16) {
+    // re-using avx512_core instantiation for xf16
+    // re-using avx2 instantiation for xf16
+    if (has_f16 || has_bf16)
+        return is_superset(isa, avx512_core) ? (has_f16    ? avx512_core_fp16
+                               : mayiuse(avx512_core_bf16) ? avx512_core_bf16
+                                                           : avx512_core)
+                                             : avx2_vnni_2;
+    else
+        return isa;
+}
+
+bool is_int4(data_type_t dt) {
+    return utils::one_of(dt, s4, u4);
+}
+
+template <cpu_isa_t isa>
+struct kernel_t : public jit_uni_embedding_bag_t::kernel_base_t,
+                  public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_t::kernel_t);
+
+    kernel_t(const embedding_bag_pd_t *pd)
+        : jit_generator_t(jit_name(), isa)
+        , alg_(pd->alg_kind())
+        , table_dt_(pd->weights_md()->data_type)
+        , dst_dt_(pd->dst_md()->data_type)
+        , with_sample_weights_(pd->with_sample_weights())
+        , with_scales_(pd->with_scales())
+        , with_zero_points_(pd->with_zero_points())
+        , per_row_scales_(with_scales_
+                  && pd->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS) != 0)
+        , per_row_zero_points_(with_zero_points_
+                  && pd->attr()->zero_points_.get_mask(DNNL_ARG_WEIGHTS) != 0)
+        , simd_w_(vlen / sizeof(float))
+        , emb_dim_(pd->emb_dim())
+        , tail_(emb_dim_ % simd_w_) {
+        const memory_desc_wrapper table_d(pd->weights_md());
+        table_dt_size_ = table_d.data_type_size();
+        table_sub_byte_mult_ = table_d.sub_byte_data_type_multiplier();
+        table_row_stride_ = table_offt(table_d.blocking_desc().strides[0]);
+
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const bool has_f16 = utils::one_of(f16, table_dt_, dst_dt_);
+        const bool has_bf16 = utils::one_of(bf16, table_dt_, dst_dt_);
+        const auto io_isa = get_io_isa(isa, has_f16, has_bf16);
+        // 4-bit values are unpacked by the kernel itself.
+        const auto load_dt = is_int4(table_dt_) ? f32 : table_dt_;
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {load_dt, dst_dt_}, io_conf, io_tail_conf, io_bf16_conf);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+    void operator()(const int32_t *indices, const float *sample_weights,
+            const void *table, const float *scales, const int32_t *zero_points,
+            void *dst, size_t nindices, size_t nprefetch) const override {
+        ker_args_t args;
+        args.indices = indices;
+        args.sample_weights = sample_weights;
+        args.table = table;
+        args.scales = scales;
+        args.zero_points = zero_points;
+        args.dst = dst;
+        args.nindices = nindices;
+        args.nprefetch = nprefetch;
+        jit_generator_t::operator()(&args);
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    const int vlen = cpu_isa_traits_t<isa>::vlen;
+    // Accumulators of a block of the embedding dimension. The block is pooled
+    // over all the indices of the bag before the next block is started.
+    static constexpr int max_acc = isa == avx512_core ? 16 : 8;
+    // Rows are prefetched this many indices ahead of the computations: table
+    // rows are scattered over a large table and miss in all the caches.
+    static constexpr int prefetch_distance = 8;
+    static constexpr int cache_line_size = 64;
+
+    struct ker_args_t {
+        const int32_t *indices;
+        const float *sample_weights;
+        const void *table;
+        const float *scales;
+        const int32_t *zero_points;
+        void *dst;
+        size_t nindices;
+        size_t nprefetch;
+    };
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    const alg_kind_t alg_;
+    const data_type_t table_dt_;
+    const data_type_t dst_dt_;
+    const bool with_sample_weights_;
+    const bool with_scales_;
+    const bool with_zero_points_;
+    const bool per_row_scales_;
+    const bool per_row_zero_points_;
+    const dim_t simd_w_;
+    const dim_t emb_dim_;
+    const dim_t tail_;
+    dim_t table_dt_size_ = 0;
+    dim_t table_sub_byte_mult_ = 1;
+    dim_t table_row_stride_ = 0;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_indices = rax;
+    const Reg64 reg_sample_weights = rdx;
+    const Reg64 reg_table = rbx;
+    const Reg64 reg_scales = r8;
+    const Reg64 reg_zero_points = r9;
+    const Reg64 reg_tmp = r10;
+    const Reg64 reg_dst = r11;
+    const Reg64 reg_nindices = r12;
+    const Reg64 reg_i = r13;
+    const Reg64 reg_row = r14;
+    const Reg64 reg_row_ptr = r15;
+    const Reg64 reg_nprefetch = rsi;
+    const Reg64 reg_row_stride = rbp;
+    const Reg64 reg_prefetch = abi_not_param1;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_mul = Vmm(1);
+    const Vmm vmm_zp = Vmm(2);
+    const Vmm vmm_val = Vmm(3);
+    const Vmm vmm_int4_shift = Vmm(4);
+    const Vmm vmm_tmp = Vmm(5);
+    const int acc_start_idx = 8;
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+
+    Vmm vmm_acc(int i) const { return Vmm(acc_start_idx + i); }
+
+    bool is_max() const { return alg_ == alg_kind::reduction_max; }
+
+    size_t table_offt(dim_t offt_elems) const {
+        return offt_elems * table_dt_size_ / table_sub_byte_mult_;
+    }
+
+    // Every 4-bit value is moved to a dword of its own: bytes are duplicated
+    // into adjacent dwords and the shifts by [28, 24] move the low and the
+    // high nibble of a byte to the top of the even and the odd dword.
+    void load_int4(const Address &addr, const Vmm &vmm) {
+        const Xmm xmm(vmm.getIdx());
+        if (is_superset(isa, avx512_core))
+            vmovq(xmm, addr);
+        else
+            vmovd(xmm, addr);
+        vpunpcklbw(xmm, xmm, xmm);
+        vpmovzxbd(vmm, xmm);
+        vpsllvd(vmm, vmm, vmm_int4_shift);
+        if (table_dt_ == s4)
+            vpsrad(vmm, vmm, 28);
+        else
+            vpsrld(vmm, vmm, 28);
+        vcvtdq2ps(vmm, vmm);
+    }
+
+    void prefetch_row(dim_t block_offt, dim_t block_size) {
+        Label skip;
+        lea(reg_prefetch, ptr[reg_i + prefetch_distance]);
+        cmp(reg_prefetch, reg_nprefetch);
+        jge(skip, T_NEAR);
+        movsxd(reg_prefetch,
+                dword[reg_indices + reg_prefetch * sizeof(int32_t)]);
+        imul(reg_prefetch, reg_row_stride);
+        add(reg_prefetch, reg_table);
+        const size_t beg = table_offt(block_offt);
+        const size_t end = table_offt(block_offt + block_size);
+        for (size_t offt = beg; offt < end; offt += cache_line_size)
+            prefetcht0(ptr[reg_prefetch + offt]);
+        L(skip);
+    }
+
+    // Broadcasts the factor of the current row: the product of its scale and
+    // its sample weight.
+    void load_row_params() {
+        if (with_scales_) {
+            if (per_row_scales_)
+                uni_vbroadcastss(
+                        vmm_mul, ptr[reg_scales + reg_row * sizeof(float)]);
+            else
+                uni_vbroadcastss(vmm_mul, ptr[reg_scales]);
+        }
+        if (with_sample_weights_) {
+            const auto addr = ptr[reg_sample_weights + reg_i * sizeof(float)];
+            if (with_scales_) {
+                uni_vbroadcastss(vmm_tmp, addr);
+                vmulps(vmm_mul, vmm_mul, vmm_tmp);
+            } else
+                uni_vbroadcastss(vmm_mul, addr);
+        }
+        if (with_zero_points_) {
+            if (per_row_zero_points_)
+                uni_vpbroadcastd(vmm_zp,
+                        ptr[reg_zero_points + reg_row * sizeof(int32_t)]);
+            else
+                uni_vpbroadcastd(vmm_zp, ptr[reg_zero_points]);
+            vcvtdq2ps(vmm_zp, vmm_zp);
+        }
+    }
+
+    void compute_block(dim_t block_offt, int nvecs) {
+        const bool with_mul = with_scales_ || with_sample_weights_;
+        const dim_t block_size
+                = nstl::min(nvecs * simd_w_, emb_dim_ - block_offt);
+
+        for (int v = 0; v < nvecs; v++) {
+            if (is_max())
+                init_vmm(vmm_acc(v), reg_tmp, -FLT_MAX);
+            else
+                uni_vxorps(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+        }
+
+        Label index_loop, index_loop_end;
+        xor_(reg_i, reg_i);
+        L(index_loop);
+        {
+            cmp(reg_i, reg_nindices);
+            jge(index_loop_end, T_NEAR);
+
+            prefetch_row(block_offt, block_size);
+
+            movsxd(reg_row, dword[reg_indices + reg_i * sizeof(int32_t)]);
+            mov(reg_row_ptr, reg_row);
+            imul(reg_row_ptr, reg_row_stride);
+            add(reg_row_ptr, reg_table);
+            load_row_params();
+
+            for (int v = 0; v < nvecs; v++) {
+                const dim_t offt = block_offt + v * simd_w_;
+                const bool tail = offt + simd_w_ > emb_dim_;
+                const auto addr = ptr[reg_row_ptr + table_offt(offt)];
+                if (is_int4(table_dt_))
+                    load_int4(addr, vmm_val);
+                else
+                    io_[table_dt_]->load(addr, vmm_val, tail);
+                if (with_zero_points_) vsubps(vmm_val, vmm_val, vmm_zp);
+
+                if (is_max()) {
+                    if (with_scales_) vmulps(vmm_val, vmm_val, vmm_mul);
+                    vmaxps(vmm_acc(v), vmm_acc(v), vmm_val);
+                } else if (with_mul)
+                    vfmadd231ps(vmm_acc(v), vmm_val, vmm_mul);
+                else
+                    vaddps(vmm_acc(v), vmm_acc(v), vmm_val);
+            }
+
+            inc(reg_i);
+            jmp(index_loop, T_NEAR);
+        }
+        L(index_loop_end);
+
+        if (alg_ == alg_kind::reduction_mean) {
+            const Xmm xmm_tmp(vmm_tmp.getIdx());
+            uni_vxorps(xmm_tmp, xmm_tmp, xmm_tmp);
+            vcvtsi2ss(xmm_tmp, xmm_tmp, reg_nindices);
+            uni_vbroadcastss(vmm_tmp, xmm_tmp);
+        }
+
+        for (int v = 0; v < nvecs; v++) {
+            const dim_t offt = block_offt + v * simd_w_;
+            const bool tail = offt + simd_w_ > emb_dim_;
+            if (alg_ == alg_kind::reduction_mean)
+                vdivps(vmm_acc(v), vmm_acc(v), vmm_tmp);
+            io_[dst_dt_]->store(vmm_acc(v),
+                    ptr[reg_dst + offt * types::data_type_size(dst_dt_)],
+                    tail);
+        }
+    }
+
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_indices, ptr[reg_param + PARAM_OFF(indices)]);
+        mov(reg_sample_weights, ptr[reg_param + PARAM_OFF(sample_weights)]);
+        mov(reg_table, ptr[reg_param + PARAM_OFF(table)]);
+        mov(reg_scales, ptr[reg_param + PARAM_OFF(scales)]);
+        mov(reg_zero_points, ptr[reg_param + PARAM_OFF(zero_points)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_nindices, ptr[reg_param + PARAM_OFF(nindices)]);
+        mov(reg_nprefetch, ptr[reg_param + PARAM_OFF(nprefetch)]);
+#undef PARAM_OFF
+        mov(reg_row_stride, table_row_stride_);
+
+        if (is_int4(table_dt_)) {
+            mov(reg_tmp, 0x000000180000001c);
+            uni_vmovq(Xmm(vmm_int4_shift.getIdx()), reg_tmp);
+            vpbroadcastq(vmm_int4_shift, Xmm(vmm_int4_shift.getIdx()));
+        }
+
+        const dim_t nvecs_total = utils::div_up(emb_dim_, simd_w_);
+        for (dim_t v = 0; v < nvecs_total; v += max_acc) {
+            const int nvecs = (int)nstl::min<dim_t>(max_acc, nvecs_total - v);
+            compute_block(v * simd_w_, nvecs);
+        }
+
+        postamble();
+    }
+};
+
+bool is_dense_row(const memory_desc_wrapper &mdw, int last_dim) {
+    return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0
+            && mdw.blocking_desc().strides[last_dim] == 1;
+}
+} // namespace
+
+jit_uni_embedding_bag_t::kernel_base_t *
+jit_uni_embedding_bag_t::kernel_base_t::create(const pd_t *pd) {
+    switch (pd->isa_) {
+        case avx512_core: return new kernel_t<avx512_core>(pd);
+        case avx2: return new kernel_t<avx2>(pd);
+        default: assert(!"kernel is empty."); return nullptr;
+    }
+}
+
+status_t jit_uni_embedding_bag_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto table_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+    const bool has_bf16 = utils::one_of(bf16, table_dt, dst_dt);
+    const bool has_f16 = utils::one_of(f16, table_dt, dst_dt);
+    const bool has_xf16 = has_bf16 || has_f16;
+
+    VDISPATCH_EMBEDDING_BAG(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_EMBEDDING_BAG(!memory_desc_wrapper(dst_md()).has_zero_dim(),
+            VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_EMBEDDING_BAG(
+            IMPLICATION(has_bf16, mayiuse(avx512_core) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_EMBEDDING_BAG(IMPLICATION(has_f16,
+                                    mayiuse(avx512_core_fp16)
+                                            || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_EMBEDDING_BAG(
+            attr()->has_default_values(
+                    skip_mask_t::scales | skip_mask_t::zero_points),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_EMBEDDING_BAG(attr_quant_ok(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_EMBEDDING_BAG(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_EMBEDDING_BAG(is_dense_row(memory_desc_wrapper(weights_md()), 1)
+                    && is_dense_row(memory_desc_wrapper(dst_md()), 1),
+            VERBOSE_UNSUPPORTED_TAG_S, "table");
+    VDISPATCH_EMBEDDING_BAG(is_dense_row(memory_desc_wrapper(src_md(0)), 0)
+                    && is_dense_row(memory_desc_wrapper(src_md(1)), 0)
+                    && IMPLICATION(with_sample_weights(),
+                            is_dense_row(memory_desc_wrapper(src_md(2)), 0)),
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+
+    // 4-bit rows must start at a byte boundary.
+    const dim_t table_row_stride
+            = memory_desc_wrapper(weights_md()).blocking_desc().strides[0];
+    VDISPATCH_EMBEDDING_BAG(
+            IMPLICATION(is_int4(table_dt), table_row_stride % 2 == 0),
+            VERBOSE_UNSUPPORTED_TAG_S, "table");
+
+    for (auto isa : {avx512_core, avx2}) {
+        if (!mayiuse(isa)) continue;
+        // avx2 handles xf16 with avx2_vnni_2 conversions only
+        if (isa == avx2 && has_xf16 && !mayiuse(avx2_vnni_2)) continue;
+        // 4-bit rows are unpacked by whole vectors only
+        const dim_t simd_w = isa_max_vlen(isa) / sizeof(float);
+        if (is_int4(table_dt) && emb_dim() % simd_w != 0) continue;
+        isa_ = isa;
+        break;
+    }
+    VDISPATCH_EMBEDDING_BAG(isa_ != isa_undef, VERBOSE_BLOCKING_FAIL,
+            "embedding dimension is not a multiple of the vector length");
+
+    return status::success;
+}
+
+status_t jit_uni_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_EMB_OFFSETS);
+    const auto sample_weights
+            = CTX_IN_MEM(const float *, DNNL_ARG_EMB_SAMPLE_WEIGHTS);
+    const auto table = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ZERO_POINTS_BUFFER(zero_points, DNNL_ARG_WEIGHTS);
+
+    const dim_t MB = pd()->batch();
+    const dim_t nnz = pd()->nnz();
+
+    CHECK(embedding_bag_inputs_check(
+            indices, offsets, MB, nnz, pd()->num_rows()));
+
+    const size_t dst_dt_size = dst_d.data_type_size();
+    const size_t dst_row_size = pd()->emb_dim() * dst_dt_size;
+
+    parallel_nd(MB, [&](dim_t b) {
+        const dim_t beg = offsets[b];
+        const dim_t end = offsets[b + 1];
+        char *dst_row = dst + dst_d.off(b, 0) * dst_dt_size;
+
+        // Empty bags produce zeros, all-zero bits are 0.f in all the
+        // supported destination data types.
+        if (beg == end) {
+            std::memset(dst_row, 0, dst_row_size);
+            return;
+        }
+
+        const float *sw = sample_weights ? sample_weights + beg : nullptr;
+        (*kernel_)(indices + beg, sw, table, scales, zero_points, dst_row,
+                end - beg, nnz - beg);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -119,6 +119,7 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , use_shift_(pd_->use_shift())
         , save_stats_(pd_->is_training())
         , calculate_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean())
         , eps_(pd_->desc()->layer_norm_epsilon)
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(src_d_.data_type(), data_type::f16,
@@ -182,6 +183,7 @@ protected:
     const bool use_shift_;
     const bool save_stats_;
     const bool calculate_stats_;
+    const bool skip_mean_;
     const float eps_;
     const bool has_ne_convert_src_xf16_;
     bool with_postops_ = false;
@@ -415,13 +417,17 @@ protected:
         if (has_ne_convert_src_xf16_)
             compute_ne_convert_xf16(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(
+                                    vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         else
             compute(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(
+                                    vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         if (save_stats_)
@@ -442,7 +448,7 @@ protected:
             if (use_shift_)
                 io_[f32]->load(
                         shift_ptr(offt_elems + j * simd_w_), vmm_shift, tail);
-            uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+            if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
             uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
             if (use_scale_ && use_shift_)
                 uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -486,7 +492,7 @@ protected:
             io_[f32]->load(shift_ptr(offt_elems), vmm_shift, tail);
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
-        uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
         uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
         if (use_scale_ && use_shift_)
             uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -606,13 +612,16 @@ protected:
             jle(end, T_NEAR);
 
             if (calculate_stats_) {
-                // compute stats
-                compute_mean();
+                // compute stats, in RMS mode the variance is computed as the
+                // mean of squares in a single pass over the source
+                if (!skip_mean_) compute_mean();
                 compute_var();
             } else {
                 // read mean and var from input
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
                 uni_vmovss(xmm_tmp, dword[reg_var]);
                 uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
             }
@@ -629,7 +638,7 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_dst, c_dst_size);
-            add(reg_mean, float_size);
+            if (!skip_mean_) add(reg_mean, float_size);
             add(reg_var, float_size);
             jmp(unroll_loop);
         }
@@ -751,6 +760,7 @@ struct jit_diff_ss_kernel_t : diff_ss_kernel_t, public jit_generator_t {
         , C_(pd_->norm_axis())
         , axis_simd_full_(C_ / simd_w_)
         , axis_simd_tail_(C_ % simd_w_)
+        , skip_mean_(pd_->skip_mean())
         , eps_(pd_->desc()->layer_norm_epsilon) {
 
         io::io_conf_t io_conf;
@@ -790,6 +800,7 @@ protected:
     const dim_t C_;
     const dim_t axis_simd_full_;
     const dim_t axis_simd_tail_;
+    const bool skip_mean_;
     const float eps_;
 
     const Reg64 reg_param = abi_param1;
@@ -840,7 +851,7 @@ protected:
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
         uni_vaddps(vmm_dshift, vmm_dshift, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
         uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
         uni_vfmadd231ps(vmm_dscale, vmm_src, vmm_ddst);
 
@@ -879,8 +890,10 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
-            uni_vmovss(xmm_tmp, dword[reg_mean]);
-            uni_vbroadcastss(vmm_mean, xmm_tmp);
+            if (!skip_mean_) {
+                uni_vmovss(xmm_tmp, dword[reg_mean]);
+                uni_vbroadcastss(vmm_mean, xmm_tmp);
+            }
             uni_vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
@@ -891,7 +904,7 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
-            add(reg_mean, float_size);
+            if (!skip_mean_) add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
             jmp(unroll_loop);
         }
@@ -948,7 +961,8 @@ struct jit_diff_data_base_kernel_t : diff_data_kernel_t,
         , axis_simd_tail_(C_ % simd_w_)
         , use_scale_(pd_->use_scale())
         , use_shift_(pd_->use_shift())
-        , calculate_diff_stats_(!pd_->stats_are_src()) {
+        , calculate_diff_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean()) {
 
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -994,6 +1008,7 @@ protected:
     const bool use_scale_;
     const bool use_shift_;
     const bool calculate_diff_stats_;
+    const bool skip_mean_;
 
     const Reg64 reg_param = abi_param1;
     const Reg64 reg_src = rdx;
@@ -1052,8 +1067,12 @@ protected:
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
-        uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        // The mean is not subtracted in RMS mode, so its gradient term
+        // (dd_scale) is not needed.
+        if (!skip_mean_) {
+            uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
+            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        }
         uni_vfmadd231ps(vmm_dd_scale_x, vmm_ddst, vmm_src);
     };
 
@@ -1066,9 +1085,12 @@ protected:
         }
         if (calculate_diff_stats_) {
             io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
-            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+            if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
             uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
-            uni_vfmadd213ps(vmm_src, vmm_dd_scale_x, vmm_dd_scale);
+            if (skip_mean_)
+                uni_vmulps(vmm_src, vmm_src, vmm_dd_scale_x);
+            else
+                uni_vfmadd213ps(vmm_src, vmm_dd_scale_x, vmm_dd_scale);
             uni_vdivps(vmm_src, vmm_src, vmm_C);
             uni_vsubps(vmm_dsrc, vmm_dsrc, vmm_src);
         }
@@ -1096,7 +1118,7 @@ protected:
         mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(ss)]);
 
-        if (calculate_diff_stats_)
+        if (calculate_diff_stats_ && !skip_mean_)
             mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
         mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
@@ -1119,8 +1141,10 @@ protected:
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
             if (calculate_diff_stats_) {
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
 
                 uni_vpxor(vmm_dd_scale, vmm_dd_scale, vmm_dd_scale);
                 uni_vpxor(vmm_dd_scale_x, vmm_dd_scale_x, vmm_dd_scale_x);
@@ -1130,7 +1154,7 @@ protected:
                 if (axis_simd_tail_)
                     compute_dd_scales(axis_simd_full_ * simd_w_, true);
 
-                reduce(vmm_dd_scale, vmm_tmp);
+                if (!skip_mean_) reduce(vmm_dd_scale, vmm_tmp);
                 reduce(vmm_dd_scale_x, vmm_tmp);
                 uni_vmulps(vmm_dd_scale_x, vmm_dd_scale_x, vmm_inv_sqrtvar);
             }
@@ -1143,7 +1167,7 @@ protected:
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
             add(reg_diff_src, c_dsrc_size);
-            if (calculate_diff_stats_) add(reg_mean, float_size);
+            if (calculate_diff_stats_ && !skip_mean_) add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
             jmp(unroll_loop);
         }
@@ -1245,6 +1269,11 @@ status_t jit_uni_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
 
         return injector::post_ops_ok(post_ops_args);
     };
+    // Binary post-op arguments are addressed by the full dst shape.
+    VDISPATCH_LNORM(IMPLICATION(has_runtime_dims_or_strides(),
+                            attr()->post_ops_.find(primitive_kind::binary)
+                                    == -1),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
     VDISPATCH_LNORM(attr_.set_default_formats(dst_md(0)) == status::success,
             VERBOSE_UNSUPPORTED_POSTOP);
     VDISPATCH_LNORM(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
@@ -1252,6 +1281,10 @@ status_t jit_uni_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
     VDISPATCH_LNORM(fill_compatible_stats_md(*src_md(), reordered_stat_md_)
                     == status::success,
             VERBOSE_INCONSISTENT_MDS, "src", "stat");
+    VDISPATCH_LNORM(IMPLICATION(has_runtime_dims_or_strides(),
+                            reordered_stat_md_ == *stat_md()
+                                    || stats_are_tmp()),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
         CHECK(reorder_primitive_desc_create(reorder_pd_, engine,
@@ -1259,6 +1292,7 @@ status_t jit_uni_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
                 stats_are_src() ? &reordered_stat_md_ : stat_md()));
     }
 
+    nthr_ = dnnl_get_max_threads();
     init_scratchpad();
     return status::success;
 }
@@ -1296,22 +1330,46 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
-    const dim_t N = pd()->across_axis();
+    dim_t N = pd()->across_axis();
+    if (pd()->has_runtime_dims_or_strides()) {
+        dim_t mb = 0;
+        CHECK(get_runtime_mb(ctx,
+                {{DNNL_ARG_SRC, pd()->src_md()}, {DNNL_ARG_DST, pd()->dst_md()},
+                        {DNNL_ARG_MEAN, pd()->stat_md()},
+                        {DNNL_ARG_VARIANCE, pd()->stat_md()}},
+                mb));
+        N = mb
+                * utils::array_product(
+                        src_d.dims() + 1, pd()->ndims() - 2);
+    }
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
-
-    parallel(0, [&](const int ithr, const int nthr) {
-        dim_t N_start = 0, N_end = 0;
-        balance211(N, nthr, ithr, N_start, N_end);
-        const char *const __restrict src_ptr
-                = reinterpret_cast<const char *>(src)
-                + N_start * C_padded * src_d.data_type_size();
-        char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
-                + N_start * C_padded * dst_d.data_type_size();
-        const int block_size = N_end - N_start;
-        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, &mean[N_start],
-                &variance[N_start], src_scales, dst_scales,
-                post_ops_binary_rhs_arg_vec.data(), block_size);
-    });
+    const bool skip_mean = pd()->skip_mean();
+    const bool tmp_stats_per_thr = pd()->use_tmp_stats_per_thr();
+    const dim_t stats_block = tmp_stats_per_thr ? pd_t::tmp_stats_block : N;
+
+    parallel(tmp_stats_per_thr ? pd()->nthr_ : 0,
+            [&](const int ithr, const int nthr) {
+                dim_t N_start = 0, N_end = 0;
+                balance211(N, nthr, ithr, N_start, N_end);
+                for (dim_t n = N_start; n < N_end; n += stats_block) {
+                    const char *const __restrict src_ptr
+                            = reinterpret_cast<const char *>(src)
+                            + n * C_padded * src_d.data_type_size();
+                    char *const __restrict dst_ptr
+                            = reinterpret_cast<char *>(dst)
+                            + n * C_padded * dst_d.data_type_size();
+                    const int block_size
+                            = (int)nstl::min(stats_block, N_end - n);
+                    const dim_t stats_off
+                            = tmp_stats_per_thr ? ithr * stats_block : n;
+                    float *const mean_ptr
+                            = skip_mean ? nullptr : &mean[stats_off];
+                    (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift,
+                            mean_ptr, &variance[stats_off], src_scales,
+                            dst_scales, post_ops_binary_rhs_arg_vec.data(),
+                            block_size);
+                }
+            });
     return status::success;
 }
 
@@ -1358,6 +1416,7 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
     }
 
     const int max_nthr = pd()->nthr_;
+    const bool skip_mean = pd()->skip_mean();
 
     parallel(max_nthr, [&](int ithr, int nthr) {
         dim_t N_start = 0, N_end = 0;
@@ -1370,6 +1429,8 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
                 = reinterpret_cast<const char *>(diff_dst)
                 + N_start * C_padded * diff_dst_d.data_type_size();
 
+        const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
+
         float *my_diff_gamma = reduce + C * ithr;
         float *my_diff_beta = reduce + C * nthr + C * ithr;
         for (dim_t c = 0; c < C; c++) {
@@ -1377,7 +1438,7 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
             my_diff_beta[c] = 0.;
         }
         (*diff_ss_kernel_)(src_ptr, diff_dst_ptr, my_diff_gamma, my_diff_beta,
-                &mean[N_start], &variance[N_start], &inv_sqrtvar[N_start],
+                mean_ptr, &variance[N_start], &inv_sqrtvar[N_start],
                 block_size);
     });
 
@@ -1404,8 +1465,10 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
         char *const __restrict diff_src_ptr = reinterpret_cast<char *>(diff_src)
                 + N_start * C_padded * diff_src_d.data_type_size();
 
+        const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
+
         (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale,
-                &mean[N_start], &inv_sqrtvar[N_start], block_size);
+                mean_ptr, &inv_sqrtvar[N_start], block_size);
     });
     return status::success;
 }
@@ -94,22 +94,36 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
 
         DECLARE_COMMON_PD_T("jit:uni", jit_uni_layer_normalization_fwd_t);
 
+        static constexpr bool supports_runtime_dims = true;
+
         status_t init(engine_t *engine);
 
         bool use_tmp_stats() const { return reorder_pd_ || stats_are_tmp(); }
 
+        // With a runtime minibatch the number of rows is unknown, so every
+        // thread keeps temporary statistics for `tmp_stats_block` rows at a
+        // time.
+        static constexpr dim_t tmp_stats_block = 256;
+        bool use_tmp_stats_per_thr() const {
+            return use_tmp_stats() && has_runtime_dims_or_strides();
+        }
+
         std::shared_ptr<primitive_desc_t> reorder_pd_;
         memory_desc_t reordered_stat_md_;
+        int nthr_ = 0; // To not exceed the limit in execute used for set up.
 
     private:
         void init_scratchpad() {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
             if (use_tmp_stats()) {
+                const dim_t tmp_stats_size = use_tmp_stats_per_thr()
+                        ? nthr_ * tmp_stats_block
+                        : across_axis();
                 scratchpad.template book<float>(
-                        key_lnorm_tmp_mean, across_axis());
+                        key_lnorm_tmp_mean, tmp_stats_size);
                 scratchpad.template book<float>(
-                        key_lnorm_tmp_var, across_axis());
+                        key_lnorm_tmp_var, tmp_stats_size);
             }
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
                 scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
@@ -150,6 +164,8 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
          * as data tensor (i.e. data in abcd, stats in abc) and user's
          * input/output statistics are reordered if necessary */
         using namespace memory_tracking::names;
+        if (!reorder_) return execute_forward(ctx);
+
         engine_t *engine = ctx.stream()->engine();
         auto scratchpad = ctx.get_scratchpad_grantor();
         auto mean_mem = scratchpad.get_memory_storage(key_lnorm_tmp_mean);
@@ -165,8 +181,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
 
         // reorder input stats
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
-                    {mean.get(), false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {mean.get(), false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {variance.get(), false});
         }
@@ -174,8 +191,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
         if (status != status::success) return status;
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(ctx, engine, {mean.get(), true},
-                    ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, {mean.get(), true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {variance.get(), true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -330,8 +348,9 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
             CHECK(safe_ptr_assign(variance,
                     new memory_t(engine, &(pd()->reordered_stat_md_),
                             std::move(variance_mem))));
-            reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
-                    {mean.get(), false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {mean.get(), false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {variance.get(), false});
         }
@@ -2311,12 +2311,9 @@ status_t jit_uni_reorder_t::pd_t::init_scratchpad() {
     const bool compensation_needed
             = prb_.req_s8s8_comp || prb_.req_asymmetric_comp;
     if (compensation_needed) {
-        const memory_desc_wrapper od(dst_md());
-        const auto G = with_groups_ ? od.padded_dims()[0] : 1;
-        const auto N = od.padded_dims()[with_groups_ ? 1 : 0];
         static constexpr int cache_line_size = 16;
         const auto wspace_per_thr_size
-                = utils::rnd_up(G * N, cache_line_size) * sizeof(int32_t);
+                = utils::rnd_up(comp_size_, cache_line_size) * sizeof(int32_t);
 
         const auto compensation_reduce_size = wspace_per_thr_size * nthr_;
 
@@ -2383,8 +2380,10 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
 
     _pd->nthr_ = nthr;
     _pd->prb_ = prb;
-    _pd->with_groups_
-            = prb.compensation_mask == tr::prb_t::comp_mask_with_groups;
+    _pd->comp_size_ = 1;
+    for (int d = 0; d < dst_md->ndims; ++d)
+        if (prb.compensation_mask & (1 << d))
+            _pd->comp_size_ *= dst_md->padded_dims[d];
     CHECK(_pd->init(engine, src_engine, dst_engine));
     _pd->ker_desc_ = ker_desc;
     CHECK(_pd->init_scratchpad_md());
@@ -2601,11 +2600,9 @@ void jit_uni_reorder_t::omp_driver(const char *in, char *out,
     int32_t *compensation_reduce_scratch = scratchpad.template get<int32_t>(
             memory_tracking::names::key_reorder_space);
 
-    const memory_desc_wrapper od(pd()->dst_md());
-    const auto G = pd()->with_groups_ ? od.padded_dims()[0] : 1;
-    const auto N = od.padded_dims()[pd()->with_groups_ ? 1 : 0];
     static constexpr int cache_line_size = 16;
-    const auto wspace_per_thr_size = utils::rnd_up(G * N, cache_line_size);
+    const auto wspace_per_thr_size
+            = utils::rnd_up(pd()->comp_size_, cache_line_size);
     const auto wspace_per_thr_bytes = wspace_per_thr_size * sizeof(int32_t);
 
     if (ndims - ndims_ker == 0) {
@@ -2665,15 +2662,13 @@ void jit_uni_reorder_t::reduce_compensation(char *out,
 
     // Note: We do not need to explicitly zero-out compensation buffer, as the
     // per_thread buffers are already zeroed out in the padded area.
-    const auto G = pd()->with_groups_ ? od.padded_dims()[0] : 1;
-    const auto N = od.padded_dims()[pd()->with_groups_ ? 1 : 0];
-    const auto GN = G * N;
+    const auto comp_size = pd()->comp_size_;
     const bool req_s8s8_comp = pd()->prb_.req_s8s8_comp;
     const bool req_asymmetric_comp = pd()->prb_.req_asymmetric_comp;
     const size_t zp_offset
-            = offset + (pd()->prb_.req_s8s8_comp ? GN * comp_dt_size : 0);
+            = offset + (req_s8s8_comp ? comp_size * comp_dt_size : 0);
 
-    parallel_nd(GN, [&](int idx) {
+    parallel_nd(comp_size, [&](dim_t idx) {
         int32_t acc = 0;
         for (int ithr = 0; ithr < nthr; ithr++) {
             acc -= compensation_reduce_scratch[ithr * wspace_per_thr_size
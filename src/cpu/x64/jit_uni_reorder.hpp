@@ -53,16 +53,12 @@ struct node_t {
 enum class scale_type_t { NONE, COMMON, MANY };
 
 struct prb_t {
-    /* The compensation mask value indicates how big an additional buffer should be.
-     * Possible values for reorder:
-     *     1) standard compensation = 1 = 0b01
-     *     2) asymmetric compensation = 2 = 0b10
-     *     3) compensation if tensor contains group = 3 = 0b11 */
+    /* The compensation mask selects the dimensions the compensation is
+     * computed over, e.g.:
+     *     1) convolution weights = 0b01
+     *     2) grouped convolution weights = 0b11
+     *     3) matmul weights = all the dimensions except for K */
     static constexpr int invalid_comp_mask = 0;
-    static constexpr int standard_comp_mask = 0b1;
-    static constexpr int asymmetric_comp_mask = 0b10;
-    static constexpr int comp_mask_with_groups
-            = standard_comp_mask + asymmetric_comp_mask;
 
     bool is_tail_in_one_of_child_nodes(int parent_node_id) const {
         for (int i = parent_node_id; i >= 0; i--) {
@@ -220,7 +216,9 @@ struct jit_uni_reorder_t : public primitive_t {
         tr::prb_t prb_;
         tr::kernel_t::desc_t ker_desc_;
         int nthr_;
-        bool with_groups_ = false;
+        // Number of compensation values: the product of the padded
+        // destination dimensions selected by the compensation mask.
+        dim_t comp_size_ = 0;
         dim_t D_mask_ = 0;
 
         status_t init(
@@ -133,20 +133,6 @@ status_t cvt_mem_desc_to_layout_desc(const memory_desc_t &md_,
     return success;
 }
 
-static bool is_with_groups(const memory_desc_t &dst_md) {
-    using namespace memory_extra_flags;
-    auto dst_d = memory_desc_wrapper(dst_md);
-    const int grp_bit = 1 << 1;
-    auto check_flag_and_mask = [&](int flag, int mask) {
-        return (dst_d.extra().flags & flag) && (mask & grp_bit);
-    };
-
-    return check_flag_and_mask(
-                   compensation_conv_s8s8, dst_d.extra().compensation_mask)
-            || check_flag_and_mask(compensation_conv_asymmetric_src,
-                    dst_d.extra().asymm_compensation_mask);
-}
-
 static inline int get_next_parent_node(node_t *nodes, int ndims, int cur_node) {
     const int cur_id = nodes[cur_node].dim_id;
     for (int d = cur_node + 1; d < ndims; ++d) {
@@ -155,6 +141,13 @@ static inline int get_next_parent_node(node_t *nodes, int ndims, int cur_node) {
     return -1;
 }
 
+// Computes the strides of the compensation buffer. The buffer is dense over
+// the dimensions selected by the mask and keeps their order and blocking from
+// the destination, i.e. it is described by the destination tag with the other
+// dimensions dropped (Ab4a for Abcd4a and mask 0x3, ba for cdba and mask 0x3).
+// Hence the nodes are visited in the normalized order, from the smallest
+// output stride to the largest one, and permuted destinations need no special
+// handling.
 static void prb_set_compensation_strides(prb_t &p) {
 
     auto require_n_stride = [&](int cur_node) -> bool {
@@ -309,18 +302,13 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
     p.req_asymmetric_comp = om_d.extra().flags
             & memory_extra_flags::compensation_conv_asymmetric_src;
 
-    const bool with_groups = is_with_groups(omd);
-
-    auto mask_ok = [&](bool check, int mask) {
-        return IMPLICATION(check, mask == (with_groups ? 0x3 : 0x1));
-    };
-
-    VDISPATCH_REORDER_IC(
-            mask_ok(p.req_s8s8_comp, om_d.extra().compensation_mask),
-            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
-    VDISPATCH_REORDER_IC(mask_ok(p.req_asymmetric_comp,
-                                 om_d.extra().asymm_compensation_mask),
-            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+    // Both compensations are accumulated in the same scratchpad, hence they
+    // must be computed over the same dimensions.
+    const bool comp_masks_ok
+            = IMPLICATION(p.req_s8s8_comp && p.req_asymmetric_comp,
+                    om_d.extra().compensation_mask
+                            == om_d.extra().asymm_compensation_mask);
+    VDISPATCH_REORDER_IC(comp_masks_ok, VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
 
     ptrdiff_t ss[max_ndims] = {0}; // scales strides
     if (p.src_scale_type == scale_type_t::MANY
@@ -349,12 +337,9 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
                 ? om_d.extra().compensation_mask
                 : (p.req_asymmetric_comp ? om_d.extra().asymm_compensation_mask
                                          : tr::prb_t::invalid_comp_mask);
-
-        if (p.compensation_mask == tr::prb_t::asymmetric_comp_mask)
-            return unimplemented;
-
-        assert(p.compensation_mask == tr::prb_t::standard_comp_mask
-                || p.compensation_mask == tr::prb_t::comp_mask_with_groups);
+        VDISPATCH_REORDER_IC(
+                p.compensation_mask != tr::prb_t::invalid_comp_mask,
+                VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
     }
 
     int ndims = 0;
@@ -0,0 +1,356 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/rope_utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+#include "cpu/x64/jit_uni_rope.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+
+namespace {
+cpu_isa_t get_io_isa(cpu_isa_t isa, bool has_f16, bool has_bf16) {
+    // re-using avx512_core instantiation for xf16
+    // re-using avx2 instantiation for xf16
+    if (has_f16 || has_bf16)
+        return is_superset(isa, avx512_core) ? (has_f16    ? avx512_core_fp16
+                               : mayiuse(avx512_core_bf16) ? avx512_core_bf16
+                                                           : avx512_core)
+                                             : avx2_vnni_2;
+    else
+        return isa;
+}
+
+template <cpu_isa_t isa>
+struct kernel_t : public jit_uni_rope_t::kernel_base_t, public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_rope_t::kernel_t);
+
+    kernel_t(const rope_pd_t *pd)
+        : jit_generator_t(jit_name(), isa)
+        , dt_(pd->src_md()->data_type)
+        , dt_size_(types::data_type_size(dt_))
+        , is_interleaved_(pd->is_interleaved())
+        , simd_w_(vlen / sizeof(float))
+        , n_pairs_(pd->rotary_dim() / 2)
+        , tail_(is_interleaved_ ? 0 : n_pairs_ % simd_w_) {
+        const memory_desc_wrapper src_d(pd->src_md(0));
+        const memory_desc_wrapper cos_d(pd->src_md(1));
+        const memory_desc_wrapper sin_d(pd->src_md(2));
+        const memory_desc_wrapper dst_d(pd->dst_md());
+        src_row_stride_ = src_d.blocking_desc().strides[2] * dt_size_;
+        dst_row_stride_ = dst_d.blocking_desc().strides[2] * dt_size_;
+        cos_row_stride_ = cos_d.blocking_desc().strides[0] * sizeof(float);
+        sin_row_stride_ = sin_d.blocking_desc().strides[0] * sizeof(float);
+
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const auto io_isa = get_io_isa(isa, dt_ == f16, dt_ == bf16);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {dt_, f32 /* cos and sin */}, io_conf, io_tail_conf,
+                io_bf16_conf);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+    void operator()(const void *src, void *dst, const float *cos,
+            const float *sin, size_t nrows) const override {
+        ker_args_t args;
+        args.src = src;
+        args.dst = dst;
+        args.cos = cos;
+        args.sin = sin;
+        args.nrows = nrows;
+        jit_generator_t::operator()(&args);
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    const int vlen = cpu_isa_traits_t<isa>::vlen;
+
+    struct ker_args_t {
+        const void *src;
+        void *dst;
+        const float *cos;
+        const float *sin;
+        size_t nrows;
+    };
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    const data_type_t dt_;
+    const size_t dt_size_;
+    const bool is_interleaved_;
+    const dim_t simd_w_;
+    const dim_t n_pairs_;
+    const dim_t tail_;
+    size_t src_row_stride_ = 0;
+    size_t dst_row_stride_ = 0;
+    size_t cos_row_stride_ = 0;
+    size_t sin_row_stride_ = 0;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = rax;
+    const Reg64 reg_dst = rdx;
+    const Reg64 reg_cos = rbx;
+    const Reg64 reg_sin = r8;
+    const Reg64 reg_nrows = r9;
+    const Reg64 reg_tmp = r10;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_cos = Vmm(1);
+    const Vmm vmm_sin = Vmm(2);
+    const Vmm vmm_x0 = Vmm(3);
+    const Vmm vmm_x1 = Vmm(4);
+    const Vmm vmm_dst0 = Vmm(5);
+    const Vmm vmm_dst1 = Vmm(6);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+
+    Address src_ptr(dim_t offt_elems) {
+        return ptr[reg_src + offt_elems * dt_size_];
+    }
+    Address dst_ptr(dim_t offt_elems) {
+        return ptr[reg_dst + offt_elems * dt_size_];
+    }
+
+    // Pairs are the elements `i` and `i + n_pairs_` of the row:
+    //   dst0 = x0 * cos - x1 * sin
+    //   dst1 = x1 * cos + x0 * sin
+    void compute_half_split_row() {
+        for (dim_t i = 0; i < n_pairs_; i += simd_w_) {
+            const bool tail = i + simd_w_ > n_pairs_;
+            io_[f32]->load(ptr[reg_cos + i * sizeof(float)], vmm_cos, tail);
+            io_[f32]->load(ptr[reg_sin + i * sizeof(float)], vmm_sin, tail);
+            io_[dt_]->load(src_ptr(i), vmm_x0, tail);
+            io_[dt_]->load(src_ptr(i + n_pairs_), vmm_x1, tail);
+
+            vmulps(vmm_dst0, vmm_x1, vmm_sin);
+            vfmsub231ps(vmm_dst0, vmm_x0, vmm_cos);
+            vmulps(vmm_dst1, vmm_x0, vmm_sin);
+            vfmadd231ps(vmm_dst1, vmm_x1, vmm_cos);
+
+            io_[dt_]->store(vmm_dst0, dst_ptr(i), tail);
+            io_[dt_]->store(vmm_dst1, dst_ptr(i + n_pairs_), tail);
+        }
+    }
+
+    // Pairs are adjacent elements of the row. The angles of the pairs are
+    // duplicated to both elements of a pair and the elements are swapped
+    // within the pairs, so fmaddsub subtracts on even and adds on odd lanes:
+    //   dst[2i]     = x[2i] * cos - x[2i + 1] * sin
+    //   dst[2i + 1] = x[2i + 1] * cos + x[2i] * sin
+    void compute_interleaved_row() {
+        const dim_t rotary_dim = 2 * n_pairs_;
+        for (dim_t i = 0; i < rotary_dim; i += simd_w_) {
+            const size_t angle_offt = (i / 2) * sizeof(float);
+            vpmovzxdq(vmm_cos, ptr[reg_cos + angle_offt]);
+            vmovsldup(vmm_cos, vmm_cos);
+            vpmovzxdq(vmm_sin, ptr[reg_sin + angle_offt]);
+            vmovsldup(vmm_sin, vmm_sin);
+            io_[dt_]->load(src_ptr(i), vmm_x0, false);
+            vpermilps(vmm_x1, vmm_x0, 0xB1);
+
+            vmulps(vmm_dst0, vmm_x1, vmm_sin);
+            vfmaddsub231ps(vmm_dst0, vmm_x0, vmm_cos);
+
+            io_[dt_]->store(vmm_dst0, dst_ptr(i), false);
+        }
+    }
+
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_cos, ptr[reg_param + PARAM_OFF(cos)]);
+        mov(reg_sin, ptr[reg_param + PARAM_OFF(sin)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+        Label row_loop, end;
+        L(row_loop);
+        {
+            cmp(reg_nrows, 0);
+            jle(end, T_NEAR);
+
+            if (is_interleaved_)
+                compute_interleaved_row();
+            else
+                compute_half_split_row();
+
+            safe_add(reg_src, src_row_stride_, reg_tmp);
+            safe_add(reg_dst, dst_row_stride_, reg_tmp);
+            safe_add(reg_cos, cos_row_stride_, reg_tmp);
+            safe_add(reg_sin, sin_row_stride_, reg_tmp);
+            dec(reg_nrows);
+
+            jmp(row_loop, T_NEAR);
+        }
+        L(end);
+
+        postamble();
+    }
+};
+
+// The interleaved layout has no tail handling: every vector register holds
+// whole pairs and the rotary dimension must be a multiple of the vector length.
+bool is_isa_applicable(cpu_isa_t isa, const rope_pd_t *pd) {
+    if (!mayiuse(isa)) return false;
+    const dim_t simd_w = isa_max_vlen(isa) / sizeof(float);
+    return IMPLICATION(pd->is_interleaved(), pd->rotary_dim() % simd_w == 0);
+}
+
+bool is_dense_row(const memory_desc_wrapper &mdw, int last_dim) {
+    return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0
+            && mdw.blocking_desc().strides[last_dim] == 1;
+}
+} // namespace
+
+jit_uni_rope_t::kernel_base_t *jit_uni_rope_t::kernel_base_t::create(
+        const pd_t *pd) {
+    switch (pd->isa_) {
+        case avx512_core: return new kernel_t<avx512_core>(pd);
+        case avx2: return new kernel_t<avx2>(pd);
+        default: assert(!"kernel is empty."); return nullptr;
+    }
+}
+
+status_t jit_uni_rope_t::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md()->data_type;
+
+    VDISPATCH_ROPE(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_ROPE(!memory_desc_wrapper(src_md()).has_zero_dim(),
+            VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_ROPE(utils::one_of(src_dt, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(src_dt == dst_md()->data_type, VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(IMPLICATION(src_dt == bf16,
+                           mayiuse(avx512_core) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_ROPE(IMPLICATION(src_dt == f16,
+                           mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_ROPE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ROPE(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_ROPE(is_dense_row(memory_desc_wrapper(src_md(0)), 3)
+                    && is_dense_row(memory_desc_wrapper(dst_md()), 3),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_ROPE(is_dense_row(memory_desc_wrapper(src_md(1)), 1)
+                    && is_dense_row(memory_desc_wrapper(src_md(2)), 1),
+            VERBOSE_UNSUPPORTED_TAG_S, "cos");
+
+    for (auto isa : {avx512_core, avx2}) {
+        // avx2 handles xf16 with avx2_vnni_2 conversions only
+        if (isa == avx2 && src_dt != f32 && !mayiuse(avx2_vnni_2)) continue;
+        if (is_isa_applicable(isa, this)) {
+            isa_ = isa;
+            break;
+        }
+    }
+    VDISPATCH_ROPE(isa_ != isa_undef, VERBOSE_BLOCKING_FAIL,
+            "rotary dimension is not a multiple of the vector length");
+
+    return status::success;
+}
+
+status_t jit_uni_rope_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper cos_d(pd()->src_md(1));
+    const memory_desc_wrapper sin_d(pd()->src_md(2));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto cos = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_COS);
+    const auto sin = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_SIN);
+    const auto positions
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ROPE_POSITIONS);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const dim_t B = pd()->batch();
+    const dim_t H = pd()->heads();
+    const dim_t S = pd()->seq_len();
+    const dim_t D = pd()->head_size();
+    const dim_t R = pd()->rotary_dim();
+
+    CHECK(rope_positions_check(positions, B, S, pd()->max_positions()));
+
+    const size_t dt_size = src_d.data_type_size();
+    // The elements after the rotary dimension are passed through. Nothing to
+    // do for in-place computations.
+    const bool copy_pass_through = D > R && src != dst;
+
+    // Tokens of a head are split into chunks to have enough work for all the
+    // threads when the number of heads is small, e.g. for a single sequence.
+    const int nthr = dnnl_get_max_threads();
+    const dim_t nchunks
+            = nstl::min(S, utils::div_up(4 * (dim_t)nthr, B * H));
+    const dim_t chunk_size = utils::div_up(S, nchunks);
+
+    parallel_nd(B, H, nchunks, [&](dim_t b, dim_t h, dim_t c) {
+        const dim_t s_start = c * chunk_size;
+        const dim_t s_end = nstl::min(S, s_start + chunk_size);
+        if (s_start >= s_end) return;
+
+        const dim_t pos = (positions ? positions[b] : 0) + s_start;
+        const char *src_row = src + src_d.off(b, h, s_start, 0) * dt_size;
+        char *dst_row = dst + dst_d.off(b, h, s_start, 0) * dt_size;
+
+        (*kernel_)(src_row, dst_row, cos + cos_d.off(pos, 0),
+                sin + sin_d.off(pos, 0), s_end - s_start);
+
+        if (!copy_pass_through) return;
+        for (dim_t s = s_start; s < s_end; s++) {
+            std::memcpy(dst + dst_d.off(b, h, s, R) * dt_size,
+                    src + src_d.off(b, h, s, R) * dt_size, (D - R) * dt_size);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_ROPE_HPP
+#define CPU_X64_JIT_UNI_ROPE_HPP
+
+#include "common/primitive.hpp"
+#include "common/rope_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_uni_rope_t : public primitive_t {
+    using primitive_t::primitive_t;
+
+    struct pd_t : public rope_pd_t {
+        using rope_pd_t::rope_pd_t;
+
+        const char *impl_name() const {
+            return JIT_IMPL_NAME_HELPER("jit:", isa_, "");
+        }
+
+        DECLARE_COMMON_PD_T(impl_name(), jit_uni_rope_t);
+
+        status_t init(engine_t *engine);
+
+        cpu_isa_t isa_ = isa_undef;
+    };
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd())));
+        if (kernel_) CHECK(kernel_->create_kernel());
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    struct kernel_base_t {
+        // Rotates `nrows` consecutive rows of a head. The rows of `src` and
+        // `dst` are the tokens of the sequence, the rows of `cos` and `sin`
+        // are the angles of the corresponding positions.
+        virtual void operator()(const void *src, void *dst, const float *cos,
+                const float *sin, size_t nrows) const = 0;
+        static kernel_base_t *create(const pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_base_t() = default;
+    };
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<kernel_base_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1626,8 +1626,17 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
             = binary_injector::prepare_binary_args(
                     pd()->attr()->post_ops_, ctx);
 
-    const memory_desc_wrapper src_d(pd()->src_md());
-    const memory_desc_wrapper dst_d(pd()->dst_md());
+    if (pd()->has_runtime_dims_or_strides()) {
+        dim_t mb = 0;
+        CHECK(get_runtime_mb(ctx,
+                {{DNNL_ARG_SRC, pd()->src_md()},
+                        {DNNL_ARG_DST, pd()->dst_md()}},
+                mb));
+    }
+    const memory_desc_wrapper src_d
+            = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const memory_desc_wrapper dst_d
+            = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
     const auto src_data_type_size = src_d.data_type_size();
     const auto dst_data_type_size = dst_d.data_type_size();
     const auto &bd = src_d.blocking_desc();
@@ -81,6 +81,8 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
         DECLARE_COMMON_PD_T(impl_name(), jit_uni_softmax_fwd_t);
 
+        static constexpr bool supports_runtime_dims = true;
+
         status_t init(engine_t *engine) {
             using namespace data_type;
             using skip_mask_t = primitive_attr_t::skip_mask_t;
@@ -134,6 +136,12 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                                       | skip_mask_t::post_ops),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_SOFTMAX(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+            // Binary post-op arguments are addressed by the full dst shape.
+            VDISPATCH_SOFTMAX(
+                    IMPLICATION(has_runtime_dims_or_strides(),
+                            attr()->post_ops_.find(primitive_kind::binary)
+                                    == -1),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
             VDISPATCH_SOFTMAX(set_default_formats() == status::success,
                     VERBOSE_UNSUPPORTED_TAG);
@@ -236,7 +244,9 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         }
 
         bool is_dense(const cpu_isa_t isa) const {
-            const memory_desc_wrapper src_d(src_md());
+            // The minibatch of 2 makes the check account for its stride.
+            const memory_desc_t src_md_mb = memory_desc_with_mb(*src_md(), 2);
+            const memory_desc_wrapper src_d(src_md_mb);
             const auto &bd = src_d.blocking_desc();
 
             if (!src_d.is_dense(true) || !src_d.only_padded_dim(axis()))
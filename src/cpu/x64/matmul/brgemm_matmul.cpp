@@ -17,6 +17,7 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
+#include "common/primitive_hashing.hpp"
 #include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -52,6 +53,21 @@ void brgemm_matmul_t<isa>::pd_t::maybe_set_LDB2() {
     }
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::pd_t::init_packed_B_layout() {
+    // Everything the content of packed B depends on besides the weights
+    // values. The weights memory descriptor is represented by its hash.
+    const auto &c = bgmmc_;
+    packed_B_layout_ = {(dim_t)isa, (dim_t)c.orig_wei_dt, (dim_t)c.wei_dt,
+            (dim_t)primitive_hashing::get_md_hash(*weights_md(0)), c.batch,
+            c.N, c.K, c.N_blk, c.K_blk, c.brgemm_batch_size, c.K_chunk_size,
+            c.LDB, c.LDB2, c.wei_n_blk, c.wei_k_blk, c.tr_b_dt_sz,
+            c.buffer_b_chunk_sz, c.copy_B_wei_stride, (dim_t)c.wei_tag,
+            (dim_t)c.transposed_B, (dim_t)c.blocked_B,
+            (dim_t)c.req_wei_vnni_downconvert, (dim_t)c.extendable_k,
+            (dim_t)c.is_amx};
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const auto src_dt = src_md_.data_type;
@@ -59,8 +75,13 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const auto dst_dt = dst_md_.data_type;
 
     const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
-    const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8
-            && one_of(dst_dt, u8, s8, s32, f32, f16, bf16);
+    // Source quantized to s8 by the copy routine, computations are in int8.
+    const bool is_src_dyn_quant = with_src_dyn_quant()
+            && one_of(src_dt, f32, bf16, f16) && wei_dt == s8
+            && one_of(dst_dt, f32, bf16);
+    const bool is_int8 = (one_of(src_dt, u8, s8) && wei_dt == s8
+                                 && one_of(dst_dt, u8, s8, s32, f32, f16, bf16))
+            || is_src_dyn_quant;
     const bool is_f8 = one_of(src_dt, f8_e5m2, f8_e4m3)
             && one_of(wei_dt, f8_e5m2, f8_e4m3)
             && one_of(dst_dt, f32, f16, bf16, f8_e5m2, f8_e4m3);
@@ -72,9 +93,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = src_dt == f32 && wei_dt == f16 && one_of(dst_dt, f16, f32);
     const bool is_f32_bf16
             = src_dt == f32 && wei_dt == bf16 && one_of(dst_dt, bf16, f32);
-    const bool is_bf16_with_int_wei = src_dt == bf16
+    const bool is_bf16_with_int_wei = !is_src_dyn_quant && src_dt == bf16
             && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, bf16, f32);
-    const bool is_f16_with_int_wei = src_dt == f16
+    const bool is_f16_with_int_wei = !is_src_dyn_quant && src_dt == f16
             && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, f16, f32);
 
     auto check_bias = [&]() -> bool {
@@ -183,7 +204,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                                     zero_points_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt
-                            | primitive_attr_t::skip_mask_t::fpmath_mode,
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::weights_paging
+                            | primitive_attr_t::skip_mask_t::src_dyn_quant,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt, is_int8),
@@ -265,6 +288,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         if (bgmmc_.apply_scales_in_buffer_b) brg.skip_scales = true;
         CHECK(brgemm_desc_set_postops(
                 &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+        brg.with_src_scales_per_m = bgmmc_.with_src_dyn_quant;
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
@@ -301,6 +325,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                 brg.get_wsp_buffer_size(), bgmmc_.wsp_tile_per_thr_bytes);
     }
 
+    const auto &pw_cache = packed_weights_cache();
+    bgmmc_.use_packed_b_cache = pw_cache.is_enabled()
+            && is_packed_b_cache_applicable(bgmmc_, weights_md(0))
+            && (size_t)bgmmc_.buffer_b_packed_sz <= pw_cache.capacity();
+    if (bgmmc_.use_packed_b_cache) init_packed_B_layout();
+
     auto scratchpad = scratchpad_registry().registrar();
     init_scratchpad(scratchpad, bgmmc_);
     const auto wei_scale_count = bgmmc_.is_oscale_per_k
@@ -415,6 +445,10 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    if (bgmmc.is_paged_B)
+        CHECK(check_weights_page_table(
+                CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE),
+                pd(), ctx.memory_mdw(DNNL_ARG_WEIGHTS)));
     const bool has_wei_scales
             = !pd()->attr()->scales_.has_default_values(DNNL_ARG_WEIGHTS);
     const int wei_scale_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
@@ -445,6 +479,16 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     const int N_chunks = brgmm_ctx.get_N_chunks();
     const int N_chunk_tail = brgmm_ctx.get_N_chunk_tail();
+
+    // Holds a reference to the cached packed B until the end of the execution
+    // in case the entry gets evicted by a concurrent execution.
+    const auto packed_B = bgmmc.use_packed_b_cache
+            ? get_packed_B(ctx, brgmm_ctx)
+            : nullptr;
+    const bool use_packed_B = packed_B != nullptr;
+
+    if (bgmmc.with_src_dyn_quant) compute_src_dyn_quant_scales(brgmm_ctx);
+
     parallel(num_threads, [&](const int ithr, const int nthr) {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn_gemm(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
@@ -531,13 +575,13 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                         for (int kb = kb_start; kb < kb_end; kb++) {
 
                             if (bgmmc.use_buffer_b && mb == m_start
-                                    && !skip_copy_b)
+                                    && !skip_copy_b && !use_packed_B)
                                 copy_b_chunk_in_buffer(brgmm_ctx, b_batch_ptr,
                                         ithr, b, nb, kb);
 
                             if (use_buffer_a && nb == n_start && !skip_copy_a)
-                                copy_a_chunk_in_buffer(
-                                        brgmm_ctx, a_batch_ptr, ithr, mb, kb);
+                                copy_a_chunk_in_buffer(brgmm_ctx,
+                                        a_batch_ptr, ithr, b, mb, kb);
 
                             compute_kernel(brgmm_ctx, a_batch_ptr, b_batch_ptr,
                                     ithr, b, mb, nb, kb,
@@ -562,6 +606,51 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+std::shared_ptr<packed_weights_cache_t::entry_t>
+brgemm_matmul_t<isa>::get_packed_B(
+        const exec_ctx_t &ctx, brg_matmul_exec_ctx_t &brgmm_ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const memory_t *wei_mem = ctx.input(DNNL_ARG_WEIGHTS);
+    if (wei_mem == nullptr) return nullptr;
+
+    const packed_weights_cache_t::key_t key {
+            wei_mem->id(), wei_mem->generation(), pd()->packed_B_layout()};
+    bool is_new = false;
+    auto entry = packed_weights_cache().get_or_create(
+            key, bgmmc.buffer_b_packed_sz, is_new);
+    if (entry == nullptr) return nullptr;
+
+    brgmm_ctx.set_packed_B_ptr(entry->data());
+    if (!is_new) return entry;
+
+    // B batches are either not broadcast or broadcast across all batch
+    // dimensions, see is_packed_b_cache_applicable().
+    const int B_batch
+            = bgmmc.bcast_B_desc.bcast_across_all_batch_dims ? 1 : bgmmc.batch;
+    const int K_chunks = brgmm_ctx.get_K_chunks();
+    const int K_chunk_size = brgmm_ctx.get_K_chunk_size();
+    const int K_chunk_tail = brgmm_ctx.get_K_chunk_tail();
+    parallel(0, [&](const int ithr, const int nthr) {
+        for_nd(ithr, nthr, B_batch, bgmmc.num_N_blocks, K_chunks,
+                [&](int b, int nb, int kc) {
+                    const bool k_chunk_tail
+                            = kc == K_chunks - 1 && K_chunk_tail > 0;
+                    const int kb_start = kc * K_chunk_size;
+                    const int kb_end = kb_start
+                            + (k_chunk_tail ? K_chunk_tail : K_chunk_size);
+                    const char *b_batch_ptr
+                            = brgmm_ctx.get_data_B_batch_ptr(b);
+                    for (int kb = kb_start; kb < kb_end; kb++)
+                        copy_b_chunk_in_buffer(
+                                brgmm_ctx, b_batch_ptr, ithr, b, nb, kb);
+                });
+    });
+    entry->set_ready();
+
+    return entry;
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::compute_kernel(
         const brg_matmul_exec_ctx_t &brgmm_ctx, const char *A_data_batch_ptr,
@@ -649,7 +738,9 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                    brgmm_ctx.get_src_dyn_quant_scales_ptr(
+                            b_idx, dst_row_logical_off)};
             brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch,
                     &leading_dimensions);
@@ -704,7 +795,9 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                    brgmm_ctx.get_src_dyn_quant_scales_ptr(
+                            b_idx, dst_row_logical_off)};
 
             brgemm_kernel_execute_postops(brg_kernel_k_tail, 1, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch,
@@ -1012,7 +1105,8 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 static_cast<const void *>(zp_comp_b),
                                 static_cast<const void *>(zp_c_val_ptr),
                                 skip_accumulation, 1, false, false,
-                                brgmm_ctx.get_dst_scales_ptr()};
+                                brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                                brgmm_ctx.get_src_dyn_quant_scales_ptr(b, m)};
 
                         brgemm_kernel_execute_postops(brg_kernel, 0, nullptr,
                                 (void *)ptr_C, (void *)ptr_D, post_ops_data,
@@ -1029,7 +1123,7 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, const char *A_data_batch_ptr,
-        int ithr, int m_blk_idx, int k_blk_idx) const {
+        int ithr, int b_idx, int m_blk_idx, int k_blk_idx) const {
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
 
     auto ctx = jit_brgemm_matmul_copy_a_t::ctx_t();
@@ -1052,6 +1146,8 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     ctx.zp_b_neg_value_ptr = (void *)brgmm_ctx.get_zp_b_neg_val_ptr();
     ctx.zp_ab_comp_ptr = (void *)brgmm_ctx.get_zp_ab_mixed_comp_ptr();
     ctx.dynamic_src_ld = brgmm_ctx.get_src_stride();
+    ctx.src_inv_scales_ptr
+            = brgmm_ctx.get_src_dyn_quant_inv_scales_ptr(b_idx, m);
 
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
@@ -1076,6 +1172,46 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     }
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::compute_src_dyn_quant_scales(
+        const brg_matmul_exec_ctx_t &brgmm_ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const dim_t K = bgmmc.K;
+
+    // The whole row is required to find the scale, while the copy routine
+    // processes A by K blocks, hence the scales are found beforehand.
+    auto abs_max = [&](const char *row) -> float {
+        float amax = 0.f;
+        switch (bgmmc.orig_src_dt) {
+            case f32: {
+                const auto *ptr = reinterpret_cast<const float *>(row);
+                for (dim_t k = 0; k < K; k++)
+                    amax = nstl::max(amax, std::fabs(ptr[k]));
+            } break;
+            case bf16: {
+                const auto *ptr = reinterpret_cast<const bfloat16_t *>(row);
+                for (dim_t k = 0; k < K; k++)
+                    amax = nstl::max(amax, std::fabs((float)ptr[k]));
+            } break;
+            case f16: {
+                const auto *ptr = reinterpret_cast<const float16_t *>(row);
+                for (dim_t k = 0; k < K; k++)
+                    amax = nstl::max(amax, std::fabs((float)ptr[k]));
+            } break;
+            default: assert(!"unsupported data type");
+        }
+        return amax;
+    };
+
+    parallel_nd(bgmmc.batch, bgmmc.M, [&](dim_t b, dim_t m) {
+        const char *row = brgmm_ctx.get_data_A_mk_ptr(
+                brgmm_ctx.get_data_A_batch_ptr(b), m, 0);
+        get_src_dyn_quant_scales(abs_max(row),
+                *brgmm_ctx.get_src_dyn_quant_scales_ptr(b, m),
+                *brgmm_ctx.get_src_dyn_quant_inv_scales_ptr(b, m));
+    });
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, const char *B_data_batch_ptr,
@@ -1099,7 +1235,7 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             p.bitmask_ptr
                     = (void *)brgmm_ctx.get_data_B_bitmask_ptr(b_idx, k, n);
             p.dst_ptr = (void *)brgmm_ctx.get_buf_B_ptr(
-                    ithr, k_blk_idx, n_blk_idx, gb);
+                    ithr, b_idx, k_blk_idx, n_blk_idx, gb);
             (*sparse_decompress_kernel_)(&p);
         }
         return;
@@ -1116,9 +1252,11 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
 
     for (int gb = 0; gb < gemm_batch; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
-        ctx.src = (void *)brgmm_ctx.get_data_B_kn_ptr(B_data_batch_ptr, k, n);
+        ctx.src = bgmmc.is_paged_B
+                ? (void *)brgmm_ctx.get_data_B_paged_ptr(b_idx, k, n)
+                : (void *)brgmm_ctx.get_data_B_kn_ptr(B_data_batch_ptr, k, n);
         ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(
-                ithr, k_blk_idx, n_blk_idx, gb);
+                ithr, b_idx, k_blk_idx, n_blk_idx, gb);
         ctx.compensation_ptr
                 = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
         ctx.current_K_start = k;
@@ -1137,9 +1275,11 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
 
     if (is_K_tail) {
         const int k = k_start + gemm_batch * bgmmc.K_blk;
-        ctx.src = (void *)brgmm_ctx.get_data_B_kn_ptr(B_data_batch_ptr, k, n);
+        ctx.src = bgmmc.is_paged_B
+                ? (void *)brgmm_ctx.get_data_B_paged_ptr(b_idx, k, n)
+                : (void *)brgmm_ctx.get_data_B_kn_ptr(B_data_batch_ptr, k, n);
         ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(
-                ithr, k_blk_idx, n_blk_idx, gemm_batch);
+                ithr, b_idx, k_blk_idx, n_blk_idx, gemm_batch);
         ctx.compensation_ptr
                 = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
         ctx.current_K_start = k;
@@ -1191,6 +1331,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             B_packed_sparse_block_size_ = weights_d.blk_size();
         }
 
+        if (bgmmc_.is_paged_B)
+            B_page_table_ptr_ = CTX_IN_MEM(
+                    const int32_t *, DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE);
+
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
 
         oscales_ptr_ = oscales;
@@ -1219,6 +1363,11 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 ? scratchpad.template get<char>(key_brgemm_primitive_buffer_d)
                 : nullptr;
 
+        src_dyn_quant_scales_ptr_ = bgmmc.with_src_dyn_quant
+                ? scratchpad.template get<float>(
+                        key_brgemm_primitive_src_dyn_quant_scales)
+                : nullptr;
+
         buf_reduce_ptr_ = bgmmc.use_buffer_reduce
                 ? scratchpad.template get<char>(
                         key_brgemm_primitive_buffer_reduce)
@@ -1548,12 +1697,12 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return batch_ptr + A_strides_[1] * m + A_strides_[0] * k;
     }
 
-    dim_t get_data_B_kn_off(int k, int n) const {
+    dim_t get_data_B_kn_off(dim_t k, dim_t n) const {
         int dt_b_k_blk = bgmmc_.is_bf32
                 ? data_type_vnni_simd_elems(f32, bgmmc_.isa)
                 : bgmmc_.wei_k_blk;
-        int k_idx = bgmmc_.blocked_B ? k / dt_b_k_blk : k;
-        int n_idx = bgmmc_.blocked_B ? n / bgmmc_.wei_n_blk : n;
+        dim_t k_idx = bgmmc_.blocked_B ? k / dt_b_k_blk : k;
+        dim_t n_idx = bgmmc_.blocked_B ? n / bgmmc_.wei_n_blk : n;
         const int int4_fac = bgmmc_.is_int4_weights ? 2 : 1;
         return (B_strides_[1] * k_idx + B_strides_[0] * n_idx
                        + get_data_B_off_within_block(k, n))
@@ -1595,6 +1744,22 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return b_off;
     }
 
+    // Paged B ignores the batch strides: the rows of the paged dimension of
+    // a B batch are located with its page table. Blocks never cross page
+    // boundaries, so the block start is enough to locate the whole block.
+    const char *get_data_B_paged_ptr(int b_idx, int k, int n) const {
+        assert(bgmmc_.is_paged_B);
+        const dim_t b = get_bb_idx(b_idx, bgmmc_.bcast_B_desc);
+        const dim_t page_size = bgmmc_.B_page_size;
+        const int row = bgmmc_.paged_B_by_K ? k : n;
+        const dim_t page
+                = B_page_table_ptr_[b * bgmmc_.B_n_pages + row / page_size];
+        const dim_t paged_row = page * page_size + row % page_size;
+        return bgmmc_.paged_B_by_K
+                ? data_B_ptr_ + get_data_B_kn_off(paged_row, n)
+                : data_B_ptr_ + get_data_B_kn_off(k, paged_row);
+    }
+
     const char *get_data_B_batch_ptr(int b_idx) const {
         const int b = get_bb_idx(b_idx, bgmmc_.bcast_B_desc);
         return data_B_ptr_ + get_data_B_batch_off(b);
@@ -1634,7 +1799,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                     ? get_buf_A_ptr(ithr, m_blk_idx, k_blk_idx, brg_batch_idx)
                     : get_data_A_mk_ptr(A_data_batch_ptr, m, k);
             addr_batch[b_iter].ptr.B = (bgmmc_.use_buffer_b)
-                    ? get_buf_B_ptr(ithr, k_blk_idx, n_blk_idx, brg_batch_idx)
+                    ? get_buf_B_ptr(
+                            ithr, b_idx, k_blk_idx, n_blk_idx, brg_batch_idx)
+                    : bgmmc_.is_paged_B
+                    ? get_data_B_paged_ptr(b_idx, k, n)
                     : get_data_B_kn_ptr(B_data_batch_ptr, k, n);
         }
     }
@@ -1671,15 +1839,28 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 + gb * bgmmc_.buffer_a_gb_stride;
     }
 
-    char *get_buf_B_ptr(int ithr, int k_blk_idx, int n_blk_idx, int gb) const {
-        UNUSED(n_blk_idx);
+    char *get_buf_B_ptr(
+            int ithr, int b, int k_blk_idx, int n_blk_idx, int gb) const {
         if (!bgmmc_.use_buffer_b) return nullptr;
         int k_blk_local = k_blk_idx % get_K_chunk_size();
+        if (packed_B_ptr_ != nullptr) {
+            const int k_chunk = k_blk_idx / get_K_chunk_size();
+            return packed_B_ptr_
+                    + get_bb_idx(b, bgmmc_.bcast_B_desc)
+                    * bgmmc_.buffer_b_packed_batch_stride
+                    + n_blk_idx * bgmmc_.buffer_b_packed_n_blk_stride
+                    + k_chunk * bgmmc_.buffer_b_chunk_sz
+                    + k_blk_local * bgmmc_.buffer_b_k_brg_stride
+                    + gb * bgmmc_.buffer_b_gb_stride;
+        }
         return buf_B_ptr_ + ithr * bgmmc_.buffer_b_per_thread_sz
                 + k_blk_local * bgmmc_.buffer_b_k_brg_stride
                 + gb * bgmmc_.buffer_b_gb_stride;
     }
 
+    // Switches B buffer to the whole packed B, see get_packed_B().
+    void set_packed_B_ptr(char *ptr) { packed_B_ptr_ = ptr; }
+
     char *get_buf_C_ptr(int ithr, int m_blk_idx, int n_blk_idx) const {
         if (!bgmmc_.use_buffer_c) return nullptr;
 
@@ -1744,13 +1925,13 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 + get_data_C_off(0, m, n) * bgmmc_.acc_dt_sz / bgmmc_.c_dt_sz;
     }
 
-    dim_t get_data_B_off_within_block(int k, int n) const {
+    dim_t get_data_B_off_within_block(dim_t k, dim_t n) const {
         using namespace format_tag;
 
         if (!bgmmc_.blocked_B) return 0;
 
-        int x0 = k % bgmmc_.wei_k_blk;
-        int x1 = n % bgmmc_.wei_n_blk;
+        int x0 = static_cast<int>(k % bgmmc_.wei_k_blk);
+        int x1 = static_cast<int>(n % bgmmc_.wei_n_blk);
         dim_t offset = static_cast<dim_t>(x0 / vnni_factor) * vnni_factor
                         * bgmmc_.wei_n_blk
                 + x1 * vnni_factor + x0 % vnni_factor;
@@ -1838,6 +2019,17 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const float *get_dst_scales_ptr() const { return dst_scales_ptr_; }
 
+    // Scales of the dynamically quantized A rows and their reciprocals, both
+    // are indexed by the batch and the row.
+    float *get_src_dyn_quant_scales_ptr(int b, dim_t m) const {
+        if (!bgmmc_.with_src_dyn_quant) return nullptr;
+        return src_dyn_quant_scales_ptr_ + b * bgmmc_.M + m;
+    }
+    float *get_src_dyn_quant_inv_scales_ptr(int b, dim_t m) const {
+        if (!bgmmc_.with_src_dyn_quant) return nullptr;
+        return src_dyn_quant_scales_ptr_ + (bgmmc_.batch + b) * bgmmc_.M + m;
+    }
+
     const int32_t *get_zp_a_neg_val_ptr() const {
         return &zero_point_a_negative_val_;
     }
@@ -2162,6 +2354,7 @@ private:
     const memory_desc_wrapper dst_d_;
     const char *data_A_ptr_;
     const char *data_B_ptr_;
+    const int32_t *B_page_table_ptr_ = nullptr;
     // The offsets and bitmask pointers are only available when the weights
     // are sparse and packed.
     const dim_t *data_B_offsets_ptr_;
@@ -2176,6 +2369,7 @@ private:
 
     char *buf_A_ptr_;
     char *buf_B_ptr_;
+    char *packed_B_ptr_ = nullptr;
     char *buf_C_ptr_;
     char *buf_D_ptr_;
     char *buf_reduce_ptr_;
@@ -2184,6 +2378,7 @@ private:
     const char *bias_ptr_;
     const float *oscales_ptr_;
     const float *dst_scales_ptr_;
+    float *src_dyn_quant_scales_ptr_;
     int32_t *s8s8_compensation_ptr_;
 
     int32_t *zero_point_a_compensations_ptr_;
@@ -17,11 +17,15 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <memory>
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
+#include "cpu/packed_weights_cache.hpp"
 
 #include "cpu/x64/brgemm/brgemm.hpp"
 #include "cpu/x64/brgemm/brgemm_containers.hpp"
@@ -117,9 +121,17 @@ struct brgemm_matmul_t : public primitive_t {
 
         void maybe_set_LDB2();
 
+        // Identifies the layout of packed B in the packed weights cache.
+        const std::vector<dim_t> &packed_B_layout() const {
+            return packed_B_layout_;
+        }
+
     private:
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
+        std::vector<dim_t> packed_B_layout_;
+
+        void init_packed_B_layout();
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
@@ -141,11 +153,15 @@ private:
             int ithr, int b_idx, int m_blk_idx, int n_blk_idx, int k_blk_idx,
             bool do_init, int &prev_ker_idx) const;
     void copy_a_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
-            const char *A_data_batch_ptr, int ithr, int m_blk_idx,
+            const char *A_data_batch_ptr, int ithr, int b_idx, int m_blk_idx,
             int k_blk_idx) const;
+    void compute_src_dyn_quant_scales(
+            const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void copy_b_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *B_data_batch_ptr, int ithr, int b_idx, int n_blk_idx,
             int k_blk_idx) const;
+    std::shared_ptr<packed_weights_cache_t::entry_t> get_packed_B(
+            const exec_ctx_t &ctx, brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void maybe_reduce_partial_results_and_apply_postops(
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void maybe_reduce_A(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
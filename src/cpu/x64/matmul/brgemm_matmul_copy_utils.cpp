@@ -526,6 +526,164 @@ void jit_brgemm_matmul_copy_a_impl_t<Vmm>::generate() {
 template struct jit_brgemm_matmul_copy_a_impl_t<Zmm>;
 template struct jit_brgemm_matmul_copy_a_impl_t<Ymm>;
 
+// Quantizes rows of f32, bf16 or f16 A to s8 while copying them into the
+// buffer: every row is multiplied by the reciprocal of its scale and then
+// rounded and saturated. The buffer layout matches the one of the int8 copy.
+struct jit_brgemm_matmul_copy_a_quantize_impl_t
+    : public jit_brgemm_matmul_copy_a_t,
+      public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_quantize_impl_t)
+
+    jit_brgemm_matmul_copy_a_quantize_impl_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_a_t(conf)
+        , jit_generator_t(jit_name())
+        , typesize_(conf_->a_dt_sz)
+        , vnni_granularity_(data_type_vnni_granularity(conf_->src_dt))
+        , src_stride_(conf_->copy_A_src_stride)
+        , tr_src_stride_(conf_->LDA * conf_->tr_a_dt_sz) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using opmask_t = const Xbyak::Opmask;
+
+    static constexpr int k_step_ = 16;
+    static constexpr int k_loop_unroll_ = 8;
+
+    const int typesize_;
+    const int vnni_granularity_;
+    const dim_t src_stride_;
+    const dim_t tr_src_stride_;
+
+    opmask_t kTail_load = k7;
+    opmask_t kTail_store = k6;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_inv_scales = r8;
+    reg64_t reg_M_blk = r9;
+    reg64_t reg_K_blk = r10;
+    reg64_t regq_tmp = r14;
+
+    Zmm zmm_inv_scale = Zmm(31);
+
+    Zmm get_zmm_copy(int i) {
+        assert(i >= 0 && i < k_loop_unroll_);
+        return Zmm(i);
+    }
+
+    void load(Zmm zmm, size_t offset, bool is_tail);
+    void quantize_and_store(Zmm zmm, size_t offset, bool is_tail);
+    void copy_K_loop(bool is_K_tail);
+    void copy_M_loop(bool is_K_tail);
+    void generate() override;
+};
+
+void jit_brgemm_matmul_copy_a_quantize_impl_t::load(
+        Zmm zmm, size_t offset, bool is_tail) {
+    const auto zmm_load = is_tail ? zmm | kTail_load | T_z : zmm;
+    const auto addr = EVEX_compress_addr(reg_src, offset * typesize_);
+    switch (conf_->orig_src_dt) {
+        case data_type::f32: vmovups(zmm_load, addr); break;
+        case data_type::bf16:
+            vpmovzxwd(zmm_load, addr);
+            vpslld(zmm, zmm, 16);
+            break;
+        case data_type::f16: vcvtph2ps(zmm_load, addr); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_brgemm_matmul_copy_a_quantize_impl_t::quantize_and_store(
+        Zmm zmm, size_t offset, bool is_tail) {
+    vmulps(zmm, zmm, zmm_inv_scale);
+    vcvtps2dq(zmm, zmm);
+    const auto xmm = Xmm(zmm.getIdx());
+    vpmovsdb(xmm, zmm);
+    const auto addr = EVEX_compress_addr(reg_tr_src, offset);
+    if (is_tail)
+        vmovdqu8(addr | kTail_store, xmm);
+    else
+        vmovdqu8(addr, xmm);
+}
+
+void jit_brgemm_matmul_copy_a_quantize_impl_t::copy_K_loop(bool is_K_tail) {
+    const int K_blk = is_K_tail ? conf_->K % conf_->K_blk
+                                : nstl::min(conf_->K, conf_->K_blk);
+    const int k_tail = K_blk % k_step_;
+    const int num_k_iters = K_blk / k_step_;
+
+    for (int kb = 0; kb < div_up(num_k_iters, k_loop_unroll_); kb++) {
+        const int k_end
+                = nstl::min(k_loop_unroll_, num_k_iters - kb * k_loop_unroll_);
+        for (int k = 0; k < k_end; k++) {
+            const size_t offset = (size_t)(kb * k_loop_unroll_ + k) * k_step_;
+            load(get_zmm_copy(k), offset, false);
+        }
+        for (int k = 0; k < k_end; k++) {
+            const size_t offset = (size_t)(kb * k_loop_unroll_ + k) * k_step_;
+            quantize_and_store(get_zmm_copy(k), offset, false);
+        }
+    }
+
+    if (k_tail > 0) {
+        // Zeroes loaded beyond the tail are stored up to the vnni granularity.
+        mov(regq_tmp, (1 << k_tail) - 1);
+        kmovw(kTail_load, regq_tmp.cvt32());
+        mov(regq_tmp, (1 << rnd_up(k_tail, vnni_granularity_)) - 1);
+        kmovw(kTail_store, regq_tmp.cvt32());
+
+        const size_t offset = (size_t)num_k_iters * k_step_;
+        load(get_zmm_copy(0), offset, true);
+        quantize_and_store(get_zmm_copy(0), offset, true);
+    }
+}
+
+void jit_brgemm_matmul_copy_a_quantize_impl_t::copy_M_loop(bool is_K_tail) {
+    Label loop_M;
+    L(loop_M);
+
+    vbroadcastss(zmm_inv_scale, ptr[reg_inv_scales]);
+    copy_K_loop(is_K_tail);
+
+    add(reg_src, src_stride_);
+    add(reg_tr_src, tr_src_stride_);
+    add(reg_inv_scales, sizeof(float));
+
+    dec(reg_M_blk);
+    jnz(loop_M, T_NEAR);
+}
+
+void jit_brgemm_matmul_copy_a_quantize_impl_t::generate() {
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_inv_scales, ptr[param1 + GET_OFF(src_inv_scales_ptr)]);
+    mov(reg_K_blk, ptr[param1 + GET_OFF(current_K_blk)]);
+    mov(reg_M_blk, ptr[param1 + GET_OFF(current_M_blk)]);
+
+    Label done;
+    const dim_t K_blk_tail = conf_->K_tail > 0 ? conf_->K % conf_->K_blk : 0;
+    if (K_blk_tail > 0) {
+        Label not_K_tail;
+        cmp(reg_K_blk, K_blk_tail);
+        jne(not_K_tail, T_NEAR);
+        copy_M_loop(true);
+        jmp(done, T_NEAR);
+
+        L(not_K_tail);
+    }
+    copy_M_loop(false);
+    L(done);
+
+    postamble();
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_a_transposed_impl_t
     : public jit_brgemm_matmul_copy_a_t,
@@ -5102,6 +5260,10 @@ status_t create_brgemm_matmul_copy_a(
         else
             CHECK(safe_ptr_assign(copy_ker,
                     new jit_brgemm_matmul_copy_a_transposed_impl_t<Ymm>(conf)));
+    } else if (conf->with_src_dyn_quant) {
+        if (!is_superset(conf->isa, avx512_core)) return status::unimplemented;
+        CHECK(safe_ptr_assign(
+                copy_ker, new jit_brgemm_matmul_copy_a_quantize_impl_t(conf)));
     } else {
         if (is_superset(conf->isa, avx512_core))
             CHECK(safe_ptr_assign(
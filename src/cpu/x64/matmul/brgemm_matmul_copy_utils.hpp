@@ -60,6 +60,8 @@ struct jit_brgemm_matmul_copy_a_t {
         const void *zp_a_compensation_result_ptr;
         const void *zp_b_neg_value_ptr;
         const void *zp_ab_comp_ptr;
+        // Reciprocals of the per-row scales, used to quantize A on the fly.
+        const void *src_inv_scales_ptr;
 
         dim_t current_K_start;
         dim_t current_K_blk;
@@ -688,6 +688,43 @@ struct matmul_avx512_blocking_params_t {
     }
 };
 
+// Decode-like shapes, e.g. the attention products for a single generated
+// token, have only a few rows of A and do not have enough M/N work to occupy
+// all the threads. For such shapes the reduction is split between threads as
+// well: every thread accumulates a partial result over its own part of K and
+// the partial results are reduced at the end. Returns the number of threads
+// for K (1 if the shape does not qualify) and reduces `k_blk` so that every
+// thread gets at least one block of K.
+int get_decode_nthr_k(const brgemm_matmul_conf_t &bgmmc,
+        const brgemm_matmul_conf_utils_t &bm_conf_utils,
+        const matmul_avx512_blocking_params_t::matmul_params_t &matmul,
+        int n_blk, int &k_blk) {
+    constexpr int max_decode_m = 16;
+    // Partial results reduction must stay negligible compared to the
+    // computations, so every thread gets at least this many elements of K.
+    constexpr int min_k_per_thr = 256;
+
+    // int8 compensations are not split between threads.
+    const bool is_decode = matmul.M <= max_decode_m
+            && matmul.K >= 2 * min_k_per_thr && !bgmmc.is_runtime_M
+            && !bgmmc.is_runtime_N && !bgmmc.is_runtime_K
+            && !bm_conf_utils.check_is_transposed(bgmmc.src_tag)
+            && one_of(true, bm_conf_utils.is_f32(), bm_conf_utils.is_bf16(),
+                    bm_conf_utils.is_f16());
+    if (!is_decode) return 1;
+
+    const dim_t bmn_work
+            = static_cast<dim_t>(matmul.batch) * div_up(matmul.N, n_blk);
+    if (bmn_work >= bgmmc.nthr) return 1;
+
+    const int nthr_k = nstl::min(static_cast<int>(bgmmc.nthr / bmn_work),
+            matmul.K / min_k_per_thr);
+    if (nthr_k <= 1) return 1;
+
+    k_blk = nstl::min(k_blk, rnd_up(div_up(matmul.K, nthr_k), 64));
+    return nthr_k;
+}
+
 float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils,
         const matmul_avx512_blocking_params_t::matmul_params_t &matmul,
@@ -790,6 +827,10 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
             // Fix number of threads for k-dim.
             start_nthr_k = nthr_k;
             last_nthr_k = nthr_k;
+        } else if (low_spatial_work && start_nthr_k == 1) {
+            start_nthr_k = get_decode_nthr_k(
+                    bgmmc, bm_conf_utils, matmul, n_blk, k_blk);
+            last_nthr_k = start_nthr_k;
         }
     }
 
@@ -881,6 +922,9 @@ float compute_blocking_heuristic_avx2(brgemm_matmul_conf_t &bgmmc,
             if (!bm_conf_utils.check_n_blk_fixed()
                     && IMPLICATION(n_chunks == 1, bgmmc.batch_ndims > 0))
                 n_blk = nstl::min(matmul.N, 32);
+
+            start_nthr_k = get_decode_nthr_k(
+                    bgmmc, bm_conf_utils, matmul, n_blk, k_blk);
         }
     }
 
@@ -947,6 +991,10 @@ float compute_blocking_heuristic_avx2_f32(brgemm_matmul_conf_t &bgmmc,
         }
     }
 
+    if (req_additional_parallel > 1)
+        start_nthr_k = get_decode_nthr_k(
+                bgmmc, bm_conf_utils, matmul, n_blk, k_blk);
+
     max_m_blk = nstl::max(max_m_blk, min_m_blk);
     for_(int nthr_k = start_nthr_k; nthr_k >= 1; --nthr_k)
     for_(int n_chunk_size = n_chunks_start; n_chunk_size >= 1; --n_chunk_size)
@@ -1123,6 +1171,57 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
     return status::success;
 }
 
+// Blocks of paged B must not cross page boundaries, so the block along the
+// paged dimension is reduced to a divisor of the page size when needed.
+status_t adjust_blocking_for_paged_B(brgemm_matmul_conf_t &bgmmc) {
+    if (!bgmmc.is_paged_B) return status::success;
+
+    const dim_t page_size = bgmmc.B_page_size;
+    if (bgmmc.paged_B_by_K) {
+        if (bgmmc.K <= page_size || page_size % bgmmc.K_blk == 0)
+            return status::success;
+
+        // AMX kernels put extra restrictions on K blocking, keep it intact.
+        VCONDCHECK_BG(!bgmmc.is_amx, VERBOSE_BLOCKING_FAIL,
+                "K block does not divide the page size");
+        dim_t K_blk = bgmmc.K_blk;
+        while (K_blk > 0
+                && (page_size % K_blk != 0
+                        || K_blk % bgmmc.required_k_granularity != 0))
+            K_blk--;
+        VCONDCHECK_BG(K_blk > 0, VERBOSE_BLOCKING_FAIL,
+                "K block does not divide the page size");
+
+        // Keep the amount of K processed per brgemm call.
+        const dim_t K_chunk_elems = bgmmc.K_blk * bgmmc.brgemm_batch_size;
+        bgmmc.K_blk = K_blk;
+        bgmmc.brgemm_batch_size
+                = nstl::max(K_chunk_elems / K_blk, static_cast<dim_t>(1));
+        // Smaller K blocks may introduce a K tail, which requires the
+        // accumulation buffer unless the destination keeps accumulators.
+        bgmmc.use_buffer_c = bgmmc.use_buffer_c || bgmmc.nthr_k > 1
+                || bgmmc.acc_dt != bgmmc.dst_dt || bgmmc.with_sum;
+    } else {
+        if (bgmmc.N <= page_size || page_size % bgmmc.N_blk == 0)
+            return status::success;
+
+        VCONDCHECK_BG(!bgmmc.is_amx, VERBOSE_BLOCKING_FAIL,
+                "N block does not divide the page size");
+        dim_t N_blk = 0;
+        for (dim_t blk : {64, 48, 32, 16}) {
+            if (blk <= bgmmc.N_blk && page_size % blk == 0) {
+                N_blk = blk;
+                break;
+            }
+        }
+        VCONDCHECK_BG(N_blk > 0, VERBOSE_BLOCKING_FAIL,
+                "N block does not divide the page size");
+        bgmmc.N_blk = N_blk;
+    }
+
+    return status::success;
+}
+
 status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         const matmul_desc_t &mmd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -1142,6 +1241,21 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.wei_dt = weights_d.data_type();
     bgmmc.orig_wei_dt = weights_d.data_type();
 
+    // With dynamic quantization of src the kernel computes in int8, while A
+    // is converted from the original data type by the copy routine.
+    bgmmc.with_src_dyn_quant = !attr.src_dyn_quant_.has_default_values();
+    if (bgmmc.with_src_dyn_quant) {
+        VCONDCHECK_BG(is_superset(isa, avx512_core_vnni)
+                        && !is_superset(isa, avx512_core_amx)
+                        && platform::has_src_dyn_quant_support(),
+                VERBOSE_ISA_DT_MISMATCH);
+        VCONDCHECK_BG(one_of(bgmmc.orig_src_dt, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VCONDCHECK_BG(attr.weights_paging_.has_default_values(),
+                VERBOSE_UNSUPPORTED_FEATURE, "paged weights");
+        bgmmc.src_dt = attr.src_dyn_quant_.data_type_;
+    }
+
     bgmmc.with_reduce = mmd.reduce_desc.format_kind != format_kind::undef;
     bgmmc.reduce_dt
             = bgmmc.with_reduce ? mmd.reduce_desc.data_type : data_type::undef;
@@ -1166,12 +1280,19 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_amx = is_superset(isa, avx512_core_amx);
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    if (bgmmc.with_src_dyn_quant)
+        bgmmc.a_dt_sz = types::data_type_size(bgmmc.orig_src_dt);
 
     bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc();
     if (bgmmc.packed_sparse_weights) {
         VCONDCHECK_BG(bgmmc.is_amx, VERBOSE_ISA_SPARSE_ENCODING_MISMATCH);
         VCONDCHECK_BG(bgmmc.wei_dt == s8, VERBOSE_UNSUPPORTED_DT);
     }
+    bgmmc.is_paged_B = !attr.weights_paging_.has_default_values();
+    if (bgmmc.is_paged_B) {
+        bgmmc.paged_B_by_K = matmul_weights_paged_by_K(weights_md);
+        bgmmc.B_page_size = attr.weights_paging_.page_size_;
+    }
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
     bgmmc.is_bf16_with_int_wei = bm_conf_utils.is_bf16_with_int_wei();
     bgmmc.is_f16_with_int_wei = bm_conf_utils.is_f16_with_int_wei();
@@ -1329,6 +1450,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.transposed_B = bm_conf_utils.check_is_transposed(bgmmc.wei_tag)
             || bgmmc.wei_tag == adbc;
     bgmmc.use_buffer_b = bm_conf_utils.use_buffer_b();
+    // Rows of paged B are contiguous within a page only, so B paged along N
+    // must be gathered by the copy routine block by block.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.is_paged_B,
+                          !bgmmc.blocked_B
+                                  && IMPLICATION(!bgmmc.paged_B_by_K,
+                                          bgmmc.use_buffer_b)),
+            VERBOSE_UNSUPPORTED_FEATURE, "paged weights with this layout");
     bgmmc.req_transpose_scales = bgmmc.apply_scales_in_buffer_b
             && bgmmc.is_oscale_per_k && bgmmc.is_oscale_per_n
             && bgmmc.transposed_B;
@@ -1438,6 +1566,15 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.use_buffer_a = is_copy_a_required;
 
+    // Source quantization happens in the copy routine for plain A only.
+    if (bgmmc.with_src_dyn_quant) {
+        VCONDCHECK_BG(!bgmmc.transposed_A && !bgmmc.is_runtime_M
+                        && !bgmmc.is_runtime_N && !bgmmc.is_runtime_K,
+                VERBOSE_UNSUPPORTED_FEATURE,
+                "dynamic quantization of src with this problem");
+        bgmmc.use_buffer_a = true;
+    }
+
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
     // show worse performance for it in comparison with copy whole A approach
@@ -1480,6 +1617,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // - nthr_K
     VCHECK_BG(compute_blocking_heuristic(bgmmc, bm_conf_utils),
             VERBOSE_BLOCKING_FAIL, "");
+    CHECK(adjust_blocking_for_paged_B(bgmmc));
 
     if (bgmmc.wei_n_blk > bgmmc.N_blk
             && IMPLICATION(
@@ -1497,6 +1635,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     VCHECK_BG(bm_conf_utils.set_B_flags(weights_md), VERBOSE_BLOCKING_FAIL, "");
 
+    if (bgmmc.is_paged_B)
+        bgmmc.B_n_pages = div_up(
+                bgmmc.paged_B_by_K ? bgmmc.K : bgmmc.N, bgmmc.B_page_size);
+
     bgmmc.M_tail = bgmmc.is_runtime_M ? 0 : bgmmc.M % bgmmc.M_blk;
     bgmmc.N_tail = bgmmc.is_runtime_N ? 0 : bgmmc.N % bgmmc.N_blk;
     bgmmc.K_tail = bgmmc.K > bgmmc.K_blk
@@ -1754,6 +1896,14 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.buffer_b_per_thread_sz = bgmmc.buffer_b_chunk_sz;
 
+    bgmmc.buffer_b_packed_n_blk_stride
+            = bgmmc.buffer_b_chunk_sz * bgmmc.K_chunks;
+    bgmmc.buffer_b_packed_batch_stride
+            = bgmmc.buffer_b_packed_n_blk_stride * bgmmc.num_N_blocks;
+    bgmmc.buffer_b_packed_sz = bgmmc.buffer_b_packed_batch_stride
+            * (bgmmc.bcast_B_desc.bcast_across_all_batch_dims ? 1
+                                                              : bgmmc.batch);
+
     bgmmc.buffer_reduce_per_thread_sz = 0;
     if (bgmmc.reduce_kind == matmul_reduce_kind::src) {
         assert(bgmmc.acc_dt == f32);
@@ -1847,7 +1997,7 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
             bgmmc.with_eltwise, bgmmc.with_binary, bgmmc.acc_dt != bgmmc.dst_dt,
             bgmmc.s8s8_compensation_required, bgmmc.has_zero_point_a,
             bgmmc.has_zero_point_b, bgmmc.has_zero_point_c,
-            bgmmc.with_dst_scales);
+            bgmmc.with_dst_scales, bgmmc.with_src_dyn_quant);
 
     bgmmc.zp_a_comp_shift_n = bgmmc.wei_n_blk;
     bgmmc.zp_a_comp_elems_per_thr
@@ -1877,6 +2027,11 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer_a,
                 bgmmc.nthr * bgmmc.buffer_a_per_thread_sz, default_data_align);
 
+    // Per-row scales of the quantized A and their reciprocals.
+    if (bgmmc.with_src_dyn_quant)
+        scratchpad.book(key_brgemm_primitive_src_dyn_quant_scales,
+                2 * bgmmc.batch * bgmmc.M, sizeof(float), 64);
+
     if (bgmmc.use_buffer_b) {
         scratchpad.book(key_brgemm_primitive_buffer_b,
                 bgmmc.nthr * bgmmc.buffer_b_per_thread_sz, default_data_align);
@@ -1920,6 +2075,24 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
                 default_data_align);
 }
 
+bool is_packed_b_cache_applicable(
+        const brgemm_matmul_conf_t &bgmmc, const memory_desc_wrapper &wei_d) {
+    // Compensations, scales and zero points are computed in the copy routines
+    // using per-thread buffers or runtime values, so they are not cacheable.
+    // B partially broadcast over batch dimensions is not supported to keep
+    // the mapping between batches and packed buffers trivial. Paged B is
+    // located through a page table that may change between executions.
+    const auto &bcast_B = bgmmc.bcast_B_desc;
+    return bgmmc.use_buffer_b && !bgmmc.packed_sparse_weights
+            && !bgmmc.is_paged_B
+            && !bgmmc.s8s8_compensation_required && !bgmmc.has_zero_point_a
+            && !bgmmc.with_wei_decompression && !bgmmc.apply_scales_in_buffer_b
+            && !bgmmc.is_runtime_N && !bgmmc.is_runtime_K
+            && !wei_d.has_runtime_dims_or_strides()
+            && IMPLICATION(
+                    bcast_B.bcast_mask, bcast_B.bcast_across_all_batch_dims);
+}
+
 } // namespace matmul
 } // namespace x64
 } // namespace cpu
@@ -110,6 +110,15 @@ struct brgemm_matmul_conf_t {
     bool with_dst_scales;
     bool s8s8_compensation_required;
     bool packed_sparse_weights;
+    // B split into pages of `B_page_size` rows along K or N which are located
+    // at execution time with a page table, see `weights_paging_t`.
+    bool is_paged_B = false;
+    bool paged_B_by_K = false;
+    dim_t B_page_size = 0;
+    dim_t B_n_pages = 0;
+    // A is quantized to s8 with per-row scales computed at execution time
+    // while being copied into the A buffer, see `src_dyn_quant_t`.
+    bool with_src_dyn_quant = false;
     bool req_transpose_scales;
     bool with_wei_decompression;
     brgemm_broadcast_t src_zp_type;
@@ -179,6 +188,14 @@ struct brgemm_matmul_conf_t {
     dim_t buffer_b_chunk_sz;
     dim_t buffer_b_per_thread_sz;
 
+    // B packed as a whole into a buffer from the engine-level packed weights
+    // cache: the per-thread buffer layout repeated for every K chunk, N block
+    // and B batch.
+    bool use_packed_b_cache = false;
+    dim_t buffer_b_packed_n_blk_stride;
+    dim_t buffer_b_packed_batch_stride;
+    dim_t buffer_b_packed_sz;
+
     dim_t buffer_reduce_per_thread_sz;
 
     dim_t s8s8_comp_ithr_str;
@@ -420,6 +437,11 @@ int get_n_block_from_tag(format_tag_t matrix_b_tag);
 
 bool is_batch_layout_trivial(const memory_desc_wrapper &mdw, const dim_t batch);
 
+// Returns true if B can be packed once and shared through the engine-level
+// packed weights cache, i.e. the packed data depends on weights values only.
+bool is_packed_b_cache_applicable(
+        const brgemm_matmul_conf_t &bgmmc, const memory_desc_wrapper &wei_d);
+
 } // namespace matmul
 } // namespace x64
 } // namespace cpu
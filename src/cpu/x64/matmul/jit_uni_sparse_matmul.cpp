@@ -14,16 +14,24 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 
+#include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 #include "common/math_utils.hpp"
+#include "common/memory_tracking.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_q10n.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
 
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 
@@ -33,383 +41,846 @@ namespace cpu {
 namespace x64 {
 namespace matmul {
 
+namespace sparse_matmul_impl {
+
 using namespace dnnl::impl::data_type;
 using namespace Xbyak;
 
-struct sparse_matmul_kernel_t : public jit_generator_t {
-    DECLARE_CPU_JIT_AUX_FUNCTIONS(sparse_matmul_kernel_t);
-
-    struct call_params_t {
-        const int32_t *src_indices;
-        const float *src_values, *wei, *dst;
-        size_t block_size;
-        size_t nnz;
-    };
-
-    sparse_matmul_kernel_t(size_t vlen, const matmul_pd_t *pd)
-        : jit_generator_t(jit_name())
-        , N_(pd->dst_md()->dims[1])
-        , vlen_(vlen)
-        , simd_w_(vlen_ / data_type_size())
-        , tail_block_size_(N() % block_size())
-        , tail_size_(tail_block_size() % simd_w()) {}
+template <cpu_isa_t isa>
+struct jit_sparse_matmul_kernel_t : public sparse_matmul_kernel_t,
+                                    public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sparse_matmul_kernel_t)
 
-    ~sparse_matmul_kernel_t() override = default;
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    static constexpr auto vlen = cpu_isa_traits_t<isa>::vlen;
+    static constexpr dim_t simd_w_ = vlen / sizeof(float);
+    // Accumulators per set in a csr_rows kernel. Two sets of accumulators
+    // process two non-zero values at a time to hide the FMA latency.
+    static constexpr int max_acc_
+            = cpu_isa_traits_t<isa>::n_vregs == 32 ? 8 : 4;
+    // Vectors per column of the source block in a csr_cols kernel.
+    static constexpr int max_m_nv_
+            = cpu_isa_traits_t<isa>::n_vregs == 32 ? 4 : 2;
+
+    jit_sparse_matmul_kernel_t(const kernel_conf_t &conf)
+        : sparse_matmul_kernel_t(conf)
+        , jit_generator_t(jit_name(), isa)
+        , values_dt_size_(types::data_type_size(conf.values_dt))
+        , dense_dt_size_(types::data_type_size(conf.dense_dt))
+        , dst_dt_size_(types::data_type_size(conf.dst_dt))
+        , tail_(conf.kind == kernel_kind_t::csr_rows ? conf.N % simd_w_ : 0)
+        , m_vlen_(conf.kind == kernel_kind_t::csr_cols
+                          ? nstl::min<dim_t>(vlen, conf.m_blk * sizeof(float))
+                          : vlen)
+        , m_nv_(static_cast<int>(conf.m_blk * sizeof(float) / m_vlen_)) {
+        assert(IMPLICATION(conf.kind == kernel_kind_t::csr_cols,
+                math::is_pow2(conf.m_blk) && m_vlen_ >= 16
+                        && m_nv_ <= max_m_nv_));
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx_,
+                vtail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
+                bf16_emu_zmm_2_idx_, bf16_emu_zmm_3_idx_, reg_tmp,
+                bf16_emu_zmm_4_idx_);
+        io::io_saturation_conf_t io_saturation_conf(
+                vzero.getIdx(), vsaturation_ubound.getIdx(), reg_tmp);
+        typename io::jit_io_multi_dt_helper_t<Vmm>::data_types_t dts {
+                conf.values_dt};
+        if (conf.kind == kernel_kind_t::csr_rows) {
+            dts.insert(conf.dense_dt);
+            dts.insert(conf.dst_dt);
+        }
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa, dts, io_conf,
+                io_tail_conf, io_bf16_conf,
+                {{conf.dst_dt, io_saturation_conf}});
+    }
 
-    void operator()(const call_params_t *p) {
+    void operator()(const call_params_t *p) const override {
         return jit_generator_t::operator()(p);
     }
 
-    size_t simd_w() const { return simd_w_; }
-    size_t vlen() const { return vlen_; }
-    size_t tail_block_size() const { return tail_block_size_; }
-    size_t tail_size() const { return tail_size_; }
-
-    int data_type_size() const { return sizeof(float); }
-    int index_type_size() const { return sizeof(int32_t); }
-
-    int block_size() const { return vlen(); }
-
-    int unroll_factor() const { return 2; }
-
-    int N() const { return N_; }
-
-protected:
-    size_t N_;
-    size_t vlen_;
-    size_t simd_w_;
-    size_t tail_block_size_;
-    size_t tail_size_;
-};
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
 
-template <cpu_isa_t isa>
-struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
-    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_matmul_kernel_t)
+private:
+    const size_t values_dt_size_;
+    const size_t dense_dt_size_;
+    const size_t dst_dt_size_;
+    const dim_t tail_;
+    // csr_cols only: a column of the source block is `m_nv_` vectors of
+    // `m_vlen_` bytes. Blocks smaller than a vector use its lower part.
+    const dim_t m_vlen_;
+    const int m_nv_;
 
-    using sparse_matmul_kernel_t::data_type_size;
-    using sparse_matmul_kernel_t::simd_w;
-    using sparse_matmul_kernel_t::tail_block_size;
-    using sparse_matmul_kernel_t::tail_size;
-    using sparse_matmul_kernel_t::vlen;
-
-    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
 
     Reg64 reg_param = abi_param1;
-
-    Reg64 reg_nnz_count = rax;
-    Reg64 reg_blocks_count = rsi;
-    Reg64 reg_src_indices = rbx;
-    Reg64 reg_src_col_idx = rdx;
-
-    Reg64 reg_src_values = r8;
-    Reg64 reg_wei = r9;
-    Reg64 reg_dst = r10;
-    Reg64 reg_offset_n = r11;
-    Reg64 reg_nnz_divided_by_2 = r12;
-    Reg64 reg_block_offset = r13;
+    Reg64 reg_values = r8;
+    Reg64 reg_indices = r9;
+    Reg64 reg_pointers = r10;
+    Reg64 reg_dense = r11;
+    Reg64 reg_dst = r12;
+    Reg64 reg_nrows = r13;
     Reg64 reg_tmp = r14;
-    Reg64 reg_nnz = r15;
-
-    Opmask tail_opmask = Opmask(2);
-    Vmm tail_vmask = Vmm(0);
-
-    Vmm vreg_src_val = Vmm(isa == avx512_core ? 19 : 11);
-    Xmm xreg_src_val = Xmm(11);
-
-    void load_kernel_params() {
-#define PARAM_OFF(x) offsetof(call_params_t, x)
-        mov(reg_src_indices, ptr[reg_param + PARAM_OFF(src_indices)]);
-        mov(reg_src_values, ptr[reg_param + PARAM_OFF(src_values)]);
-        mov(reg_wei, ptr[reg_param + PARAM_OFF(wei)]);
-        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
-        mov(reg_nnz, ptr[reg_param + PARAM_OFF(nnz)]);
-#undef PARAM_OFF
+    Reg64 reg_n_off = r15;
+    Reg64 reg_j = rax;
+    Reg64 reg_end = rbx;
+    Reg64 reg_row_begin = rsi;
+    Reg64 reg_col[2] = {rdx, rbp};
+
+    Vmm vtail_mask = Vmm(0);
+    Vmm vzero = Vmm(3);
+    Vmm vsaturation_ubound = Vmm(4);
+
+    const int bf16_emu_zmm_1_idx_ = 28;
+    const int bf16_emu_zmm_2_idx_ = 29;
+    const int bf16_emu_zmm_3_idx_ = 30;
+    const int bf16_emu_zmm_4_idx_ = 31;
+    const int tail_opmask_idx_ = 2;
+
+    // Broadcast non-zero values of the two sets.
+    Vmm vval(int s) const { return Vmm(1 + s); }
+    Vmm vacc(int s, int v) const { return Vmm(5 + s * max_acc_ + v); }
+    Vmm vtmp(int s) const { return Vmm(5 + 2 * max_acc_ + s); }
+
+    // csr_cols only: registers of `m_vlen_` bytes. They reuse the indices of
+    // csr_rows accumulators.
+    Xmm vcol(int idx) const {
+        if (m_vlen_ == 16) return Xmm(idx);
+        if (m_vlen_ == 32) return Ymm(idx);
+        return Zmm(idx);
     }
-
-    Address wei_ptr(size_t offt = 0) {
-        if (N() == 1)
-            return ptr[reg_wei + reg_src_col_idx * data_type_size() + offt];
-
-        imul(reg_tmp, reg_src_col_idx, N());
-        add(reg_tmp, reg_block_offset);
-        return ptr[reg_wei + reg_tmp * data_type_size() + offt];
+    // The current column of the transposed source block.
+    Xmm vsrc(int v) const { return vcol(5 + v); }
+    Xmm vcol_tmp(int s, int v) const {
+        return vcol(5 + max_m_nv_ + s * max_m_nv_ + v);
     }
 
-    Address dst_ptr(size_t offt = 0) {
-        return ptr[reg_dst + reg_block_offset * data_type_size() + offt];
+    Address values_ptr(int off) {
+        return ptr[reg_values + reg_j * values_dt_size_
+                + off * values_dt_size_];
     }
-
-    Address src_values_ptr(size_t offt = 0) {
-        return ptr[reg_src_values + reg_nnz_count * data_type_size() + offt];
+    Address indices_ptr(int off) {
+        return dword[reg_indices + reg_j * sizeof(int32_t)
+                + off * sizeof(int32_t)];
     }
 
-    Address src_indices_ptr(size_t offt = 0) {
-        return dword[reg_src_indices + reg_nnz_count * index_type_size()
-                + offt];
+    // Iterates over non-zero values [reg_j, reg_end) of the current row two
+    // at a time. `body(s, off)` processes value `reg_j + off` using set `s`.
+    template <typename body_t>
+    void nnz_loop(const body_t &body) {
+        Label pair_loop, pair_loop_end, done;
+        L(pair_loop);
+        {
+            lea(reg_tmp, ptr[reg_j + 2]);
+            cmp(reg_tmp, reg_end);
+            jg(pair_loop_end, T_NEAR);
+            body(0, 0);
+            body(1, 1);
+            add(reg_j, 2);
+            jmp(pair_loop, T_NEAR);
+        }
+        L(pair_loop_end);
+        cmp(reg_j, reg_end);
+        jge(done, T_NEAR);
+        body(0, 0);
+        L(done);
     }
 
-    void load_tail(const Zmm &dst, const Address &src) {
-        uni_vmovups_tail(dst, tail_opmask, src);
+    // csr_rows: computes `nv` vectors of a destination row starting at the
+    // column `reg_n_off`.
+    void compute_rows_block(int nv, bool tail) {
+        for_(int s = 0; s < 2; s++)
+        for (int v = 0; v < nv; v++)
+            uni_vpxor(vacc(s, v), vacc(s, v), vacc(s, v));
+
+        mov(reg_j, reg_row_begin);
+        nnz_loop([&](int s, int off) {
+            const Reg64 &reg_col_s = reg_col[s];
+            io_[conf_.values_dt]->broadcast(values_ptr(off), vval(s));
+            movsxd(reg_col_s, indices_ptr(off));
+            imul(reg_col_s, reg_col_s, conf_.N);
+            add(reg_col_s, reg_n_off);
+            for (int v = 0; v < nv; v++) {
+                const bool is_tail = tail && v == nv - 1;
+                io_[conf_.dense_dt]->load(ptr[reg_dense
+                                                  + reg_col_s * dense_dt_size_
+                                                  + v * simd_w_
+                                                          * dense_dt_size_],
+                        vtmp(v % 2), is_tail);
+                uni_vfmadd231ps(vacc(s, v), vval(s), vtmp(v % 2));
+            }
+        });
+
+        for (int v = 0; v < nv; v++) {
+            uni_vaddps(vacc(0, v), vacc(0, v), vacc(1, v));
+            io_[conf_.dst_dt]->store(vacc(0, v),
+                    ptr[reg_dst + reg_n_off * dst_dt_size_
+                            + v * simd_w_ * dst_dt_size_],
+                    tail && v == nv - 1);
+        }
     }
 
-    void load_tail(const Ymm &dst, const Address &src) {
-        uni_vmovups_tail(dst, tail_vmask, src);
+    void compute_rows() {
+        const dim_t blk = max_acc_ * simd_w_;
+        const dim_t n_full_blks = conf_.N / blk;
+        const int nv_rem = static_cast<int>((conf_.N % blk) / simd_w_);
+
+        xor_(reg_n_off, reg_n_off);
+        if (n_full_blks > 0) {
+            Label blk_loop;
+            L(blk_loop);
+            {
+                compute_rows_block(max_acc_, false);
+                add(reg_n_off, blk);
+                cmp(reg_n_off, n_full_blks * blk);
+                jl(blk_loop, T_NEAR);
+            }
+        }
+        if (nv_rem > 0 || tail_ > 0)
+            compute_rows_block(nv_rem + (tail_ > 0), tail_ > 0);
     }
 
-    void store_tail(const Address &dst, const Zmm &src) {
-        uni_vmovups_tail(dst, tail_opmask, src);
+    // csr_cols: accumulates the products of the current source column and
+    // the row of weights into the transposed accumulator.
+    void compute_cols() {
+        const dim_t col_size = conf_.m_blk * sizeof(float);
+        for (int v = 0; v < m_nv_; v++)
+            uni_vmovups(vsrc(v), ptr[reg_dense + v * m_vlen_]);
+        mov(reg_j, reg_row_begin);
+        nnz_loop([&](int s, int off) {
+            const Reg64 &reg_col_s = reg_col[s];
+            io_[conf_.values_dt]->broadcast(values_ptr(off), vval(s));
+            movsxd(reg_col_s, indices_ptr(off));
+            shl(reg_col_s, math::ilog2q(col_size));
+            // Column indices within a row are unique, so the two sets never
+            // update the same accumulator.
+            for (int v = 0; v < m_nv_; v++) {
+                const auto acc_addr = ptr[reg_dst + reg_col_s + v * m_vlen_];
+                uni_vmovups(vcol_tmp(s, v), acc_addr);
+                uni_vfmadd231ps(
+                        vcol_tmp(s, v), vcol(vval(s).getIdx()), vsrc(v));
+                uni_vmovups(acc_addr, vcol_tmp(s, v));
+            }
+        });
     }
 
-    void store_tail(const Address &dst, const Ymm &src) {
-        uni_vmovups_tail(dst, tail_vmask, src);
-    }
+    void generate() override {
+        const bool is_rows = conf_.kind == kernel_kind_t::csr_rows;
 
-    void prepare_tail_mask();
+        preamble();
+        io_.init_bf16();
+        if (tail_ > 0) io_.prepare_tail_mask();
+        if (is_rows && types::is_integral_dt(conf_.dst_dt))
+            io_.init_saturate_f32({conf_.dst_dt});
 
-    Vmm get_dst_reg(int index) const {
-        // Vmm(0) is reserved for mask.
-        return Vmm(index + 1);
-    }
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_values, ptr[reg_param + PARAM_OFF(values)]);
+        mov(reg_indices, ptr[reg_param + PARAM_OFF(indices)]);
+        mov(reg_pointers, ptr[reg_param + PARAM_OFF(pointers)]);
+        mov(reg_dense, ptr[reg_param + PARAM_OFF(dense)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
 
-    Vmm get_wei_reg(int index, bool is_tail_block) {
-        // Vmm(0) is reserved for mask.
-        const int nloads = is_tail_block
-                ? utils::div_up(tail_block_size(), simd_w())
-                : block_size() / simd_w();
-        return Vmm(nloads + index + 1);
-    }
+        Label row_loop, row_loop_end;
+        L(row_loop);
+        {
+            test(reg_nrows, reg_nrows);
+            jz(row_loop_end, T_NEAR);
+
+            movsxd(reg_row_begin, dword[reg_pointers]);
+            movsxd(reg_end, dword[reg_pointers + sizeof(int32_t)]);
 
-    void loop_within_block_row(
-            Vmm vreg_src_val, Reg64 reg_src_col_idx, bool is_tail_block) {
-        const int nloads = is_tail_block
-                ? utils::div_up(tail_block_size(), simd_w())
-                : block_size() / simd_w();
-        for (int i_load = 0; i_load < nloads; i_load++) {
-            Vmm vreg_tmp_wei = get_wei_reg(i_load, is_tail_block);
-            // Load a row of weights.
-            if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                load_tail(vreg_tmp_wei, wei_ptr(vlen() * i_load));
+            if (is_rows) {
+                compute_rows();
+                add(reg_dst, conf_.N * dst_dt_size_);
             } else {
-                uni_vmovups(vreg_tmp_wei, wei_ptr(vlen() * i_load));
+                compute_cols();
+                add(reg_dense, conf_.m_blk * sizeof(float));
             }
-            // Multiply the broadcasted value with the row of weights
-            // and accumulate result in dst.
-            Vmm vreg_tmp_dst = get_dst_reg(i_load);
-            uni_vfmadd231ps(vreg_tmp_dst, vreg_src_val, vreg_tmp_wei);
+
+            add(reg_pointers, sizeof(int32_t));
+            dec(reg_nrows);
+            jmp(row_loop, T_NEAR);
         }
+        L(row_loop_end);
+
+        postamble();
     }
+};
 
-    void loop_within_block(int unroll_factor, bool is_tail_block) {
-        Label loop_within_block_begin, loop_within_block_end;
-        xor_(reg_nnz_count, reg_nnz_count);
-        L(loop_within_block_begin);
-        {
-            cmp(reg_nnz_count, reg_nnz_divided_by_2);
-            je(loop_within_block_end, T_NEAR);
-
-            for (int uf = 0; uf < unroll_factor; uf++) {
-                // Load src values to broadcast.
-                uni_vbroadcastss(
-                        vreg_src_val, src_values_ptr(uf * data_type_size()));
-                // Load an index.
-                movsxd(reg_src_col_idx,
-                        src_indices_ptr(uf * index_type_size()));
-                loop_within_block_row(
-                        vreg_src_val, reg_src_col_idx, is_tail_block);
-            }
-            add(reg_nnz_count, unroll_factor);
-            jmp(loop_within_block_begin, T_NEAR);
-        }
-        L(loop_within_block_end);
+sparse_matmul_kernel_t *sparse_matmul_kernel_t::create(
+        const kernel_conf_t &conf, const cpu_isa_t isa) {
+#define HANDLE_ISA(isa_) \
+    if ((isa_) == isa) return new jit_sparse_matmul_kernel_t<isa_>(conf);
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core_fp16));
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core_bf16));
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core));
+    REG_AVX2_ISA(HANDLE_ISA(avx2_vnni_2));
+    REG_AVX2_ISA(HANDLE_ISA(avx2));
+#undef HANDLE_ISA
+    assert(!"kernel is empty.");
+    return nullptr;
+}
 
-        // process tail over K (due to unrolling).
-        // Check if tail process is needed.
-        Label skip_row_tail;
-        test(reg_nnz, 1);
-        jz(skip_row_tail, T_NEAR);
+// Converts COO row indices into CSR pointers. Row indices are expected to be
+// sorted, as for the reference implementation.
+void cvt_coo_indices_to_csr_pointers(const int32_t *row_indices,
+        int32_t *pointers, dim_t nnz, dim_t nrows) {
+    // Each pointer is the number of row indices smaller than the row.
+    parallel_nd(nrows + 1, [&](dim_t r) {
+        pointers[r] = static_cast<int32_t>(
+                std::lower_bound(row_indices, row_indices + nnz, r)
+                - row_indices);
+    });
+}
 
-        // Load src values to broadcast.
-        uni_vbroadcastss(vreg_src_val, src_values_ptr());
-        // Load an index.
-        movsxd(reg_src_col_idx, src_indices_ptr());
-        loop_within_block_row(vreg_src_val, reg_src_col_idx, is_tail_block);
+// Work of a CSR matrix is measured in units: one unit per non-zero value and
+// one unit per row for the initialization and store of its results. Returns
+// the first unit of row `r`.
+dim_t row_unit(const int32_t *pointers, dim_t r) {
+    return pointers[r] - pointers[0] + r;
+}
 
-        L(skip_row_tail);
+// Returns the row the unit `u` belongs to.
+dim_t unit_row(const int32_t *pointers, dim_t nrows, dim_t u) {
+    dim_t lo = 0, hi = nrows;
+    // Find the last row starting at or before `u`.
+    while (hi - lo > 1) {
+        const dim_t mid = lo + (hi - lo) / 2;
+        if (row_unit(pointers, mid) <= u)
+            lo = mid;
+        else
+            hi = mid;
     }
+    return lo;
+}
 
-    void loop_over_blocks(bool is_tail_block) {
-        const size_t n_full_blocks = N() / block_size();
-        const size_t nblocks = n_full_blocks + is_tail_block;
-        // Divide number of non-zero elements in the row by 2 (unroll factor).
-        assert(unroll_factor() == 2);
-        mov(reg_nnz_divided_by_2, reg_nnz);
-        and_(reg_nnz_divided_by_2, -2);
-
-        if (is_tail_block) {
-            mov(reg_blocks_count, n_full_blocks);
-        } else {
-            xor_(reg_blocks_count, reg_blocks_count);
-        }
+// Source rows and destination rows are transposed through tiles of
+// `tile_size` columns, so that the conversions read and write contiguous
+// memory and the transposition itself stays in L1.
+constexpr dim_t tile_size = 16;
+
+// Converts `n` values to f32.
+template <data_type_t dt>
+void cvt_to_f32(float *out, const void *inp, dim_t n) {
+    using data_t = typename prec_traits_t<dt>::type;
+    const auto *in = static_cast<const data_t *>(inp);
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i] = static_cast<float>(in[i]);
+}
 
-        Label loop_over_blocks_begin, loop_over_blocks_end;
-        L(loop_over_blocks_begin);
-        {
-            cmp(reg_blocks_count, nblocks);
-            je(loop_over_blocks_end, T_NEAR);
-
-            mov(reg_block_offset, reg_blocks_count);
-            shl(reg_block_offset, math::ilog2q(block_size()));
-
-            const int nloads = is_tail_block
-                    ? utils::div_up(tail_block_size(), simd_w())
-                    : block_size() / simd_w();
-            std::vector<Vmm> vregs_dst(nloads);
-            for (int i_load = 0; i_load < nloads; i_load++) {
-                vregs_dst[i_load] = get_dst_reg(i_load);
-                uni_vpxor(vregs_dst[i_load], vregs_dst[i_load],
-                        vregs_dst[i_load]);
-            }
+template <>
+void cvt_to_f32<bf16>(float *out, const void *inp, dim_t n) {
+    cvt_bfloat16_to_float(out, static_cast<const bfloat16_t *>(inp), n);
+}
+
+template <>
+void cvt_to_f32<f16>(float *out, const void *inp, dim_t n) {
+    cvt_float16_to_float(out, static_cast<const float16_t *>(inp), n);
+}
 
-            loop_within_block(unroll_factor(), is_tail_block);
+// Converts `n` f32 values to the destination data type.
+template <data_type_t dt>
+void cvt_from_f32(void *outp, const float *in, dim_t n) {
+    using data_t = typename prec_traits_t<dt>::type;
+    auto *out = static_cast<data_t *>(outp);
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i] = cpu::q10n::saturate_and_round<data_t>(in[i]);
+}
 
-            for (int i_load = 0; i_load < nloads; i_load++) {
-                if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                    store_tail(dst_ptr(vlen() * i_load), vregs_dst[i_load]);
-                } else {
-                    uni_vmovups(dst_ptr(vlen() * i_load), vregs_dst[i_load]);
-                }
-            }
-            add(reg_blocks_count, 1);
-            jmp(loop_over_blocks_begin, T_NEAR);
+template <>
+void cvt_from_f32<bf16>(void *outp, const float *in, dim_t n) {
+    cvt_float_to_bfloat16(static_cast<bfloat16_t *>(outp), in, n);
+}
+
+template <>
+void cvt_from_f32<f16>(void *outp, const float *in, dim_t n) {
+    cvt_float_to_float16(static_cast<float16_t *>(outp), in, n);
+}
+
+// Transposes `cur_m` rows of `cur_k` source values with leading dimension
+// `ld` into the f32 block `src_trans` of `m_blk` values per column. Rows of
+// the block past `cur_m` are zeroed.
+template <data_type_t dt>
+void transpose_src_block(const void *src, dim_t ld, dim_t cur_m, dim_t cur_k,
+        dim_t m_blk, float *src_trans) {
+    const size_t dt_size = types::data_type_size(dt);
+    float tile[64 * tile_size];
+    assert(m_blk <= 64);
+    for (dim_t k0 = 0; k0 < cur_k; k0 += tile_size) {
+        const dim_t len = nstl::min(tile_size, cur_k - k0);
+        for (dim_t i = 0; i < cur_m; i++)
+            cvt_to_f32<dt>(&tile[i * tile_size],
+                    static_cast<const char *>(src) + (i * ld + k0) * dt_size,
+                    len);
+        for (dim_t k = 0; k < len; k++) {
+            float *col = src_trans + (k0 + k) * m_blk;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < cur_m; i++)
+                col[i] = tile[i * tile_size + k];
+            for (dim_t i = cur_m; i < m_blk; i++)
+                col[i] = 0.f;
         }
-        L(loop_over_blocks_end);
     }
+}
 
-    void compute() {
-        const size_t n_full_blocks = N() / block_size();
-        if (n_full_blocks != 0) { loop_over_blocks(/* is_tail_block */ false); }
-        if (tail_block_size() > 0) loop_over_blocks(/* is_tail_block */ true);
+// Transposes the first `cur_m` rows of the f32 block `acc` of `m_blk` values
+// per column back to destination rows of `N` values.
+template <data_type_t dt>
+void store_acc_block(const float *acc, dim_t N, dim_t cur_m, dim_t m_blk,
+        void *dst) {
+    const size_t dt_size = types::data_type_size(dt);
+    float tile[tile_size];
+    for (dim_t n0 = 0; n0 < N; n0 += tile_size) {
+        const dim_t len = nstl::min(tile_size, N - n0);
+        for (dim_t i = 0; i < cur_m; i++) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t n = 0; n < len; n++)
+                tile[n] = acc[(n0 + n) * m_blk + i];
+            cvt_from_f32<dt>(
+                    static_cast<char *>(dst) + (i * N + n0) * dt_size, tile,
+                    len);
+        }
     }
+}
 
-    void generate() override {
-        preamble();
-        prepare_tail_mask();
-        load_kernel_params();
-        compute();
-        postamble();
+} // namespace sparse_matmul_impl
+
+using namespace sparse_matmul_impl;
+
+status_t jit_uni_sparse_matmul_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+
+    VDISPATCH_MATMUL(src_d.is_sparse_desc() ^ wei_d.is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    is_wei_sparse_ = wei_d.is_sparse_desc();
+    const memory_desc_wrapper &sparse_d = is_wei_sparse_ ? wei_d : src_d;
+    encoding_ = sparse_d.encoding();
+    VDISPATCH_MATMUL(utils::one_of(encoding_, sparse_encoding::csr,
+                             sparse_encoding::coo),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(s32 == sparse_d.metadata_type(0)
+                    && IMPLICATION(encoding_ == sparse_encoding::csr,
+                            s32 == sparse_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const auto src_dt = src_md(0)->data_type;
+    const auto wei_dt = weights_md(0)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+    const bool is_fp = utils::one_of(src_dt, f32, bf16, f16) && src_dt == wei_dt
+            && utils::one_of(dst_dt, f32, src_dt);
+    const bool is_int8 = utils::one_of(src_dt, s8, u8) && wei_dt == s8
+            && utils::one_of(dst_dt, s32, f32);
+    VDISPATCH_MATMUL(is_fp || is_int8, VERBOSE_UNSUPPORTED_DT_CFG);
+
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    const auto dt_supported = [](cpu_isa_t isa, data_type_t dt) {
+        if (dt == bf16)
+            return is_superset(isa, avx512_core) || isa == avx2_vnni_2;
+        if (dt == f16)
+            return is_superset(isa, avx512_core_fp16) || isa == avx2_vnni_2;
+        return true;
+    };
+    for (const auto isa : {avx512_core_fp16, avx512_core_bf16, avx512_core,
+                 avx2_vnni_2, avx2}) {
+        if (mayiuse(isa) && dt_supported(isa, src_dt)) {
+            isa_ = isa;
+            break;
+        }
+    }
+    VDISPATCH_MATMUL(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    // Offsets are computed in 32-bit immediates by the kernels.
+    VDISPATCH_MATMUL(N() <= INT32_MAX / 4, VERBOSE_BAD_DIM, "N", 1);
+
+    nthr_ = dnnl_get_max_threads();
+    k_blk_ = 1024;
+    if (is_wei_sparse_) {
+        // A block of source rows takes up to 4 vectors (2 for Intel AVX2)
+        // per column, which amortizes the loads of the sparse weights over
+        // more rows. Small M takes the lower part of a vector instead of
+        // padding the block with zero rows.
+        const bool is_avx512 = is_superset(isa_, avx512_core);
+        const dim_t max_m_blk = (is_avx512 ? 4 * 64 : 2 * 32) / sizeof(float);
+        const dim_t min_m_blk = 16 / sizeof(float);
+        m_blk_ = min_m_blk;
+        while (m_blk_ < nstl::min(M(), max_m_blk))
+            m_blk_ *= 2;
+        // The transposed accumulator of a block of source rows has to stay
+        // in cache.
+        const size_t max_acc_size = (size_t)4 * 1024 * 1024;
+        while (m_blk_ > min_m_blk
+                && N() * m_blk_ * sizeof(float) > max_acc_size)
+            m_blk_ /= 2;
+        const size_t acc_size = N() * m_blk_ * sizeof(float);
+        VDISPATCH_MATMUL(acc_size <= max_acc_size, VERBOSE_LARGE_SHAPES);
     }
 
-    jit_uni_sparse_matmul_kernel_t(const matmul_pd_t *pd)
-        : sparse_matmul_kernel_t(cpu_isa_traits_t<isa>::vlen, pd) {}
-    ~jit_uni_sparse_matmul_kernel_t() override = default;
-};
-
-template <>
-void jit_uni_sparse_matmul_kernel_t<avx512_core>::prepare_tail_mask() {
-    if (tail_size() == 0) return;
-
-    const int mask_f32 = (1 << tail_size()) - 1;
-
-    Reg32 regw_tmp = reg_tmp.cvt32();
-    mov(regw_tmp, mask_f32);
-    kmovd(tail_opmask, regw_tmp);
+    init_scratchpad();
+    return status::success;
 }
 
-template <>
-void jit_uni_sparse_matmul_kernel_t<avx2>::prepare_tail_mask() {
-    if (tail_size() == 0) return;
-
-    static const uint32_t mask_f32[]
-            = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-                    0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0, 0};
+bool jit_uni_sparse_matmul_t::pd_t::formats_ok() const {
+    if (!memory_desc_wrapper(dst_md()).matches_one_of_tag(format_tag::ab))
+        return false;
+    const memory_desc_wrapper dense_d(is_wei_sparse_ ? src_md() : weights_md());
+    return dense_d.matches_one_of_tag(format_tag::ab);
+}
 
-    mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - tail_size()]));
-    vmovups(tail_vmask, ptr[reg_tmp]);
+kernel_conf_t jit_uni_sparse_matmul_t::pd_t::kernel_conf() const {
+    kernel_conf_t conf;
+    if (is_wei_sparse_) {
+        conf.kind = kernel_kind_t::csr_cols;
+        conf.values_dt = weights_md(0)->data_type;
+        // The source block is transposed to f32 by the driver code.
+        conf.dense_dt = data_type::f32;
+        conf.dst_dt = data_type::f32;
+    } else {
+        conf.kind = kernel_kind_t::csr_rows;
+        conf.values_dt = src_md(0)->data_type;
+        conf.dense_dt = weights_md(0)->data_type;
+        conf.dst_dt = dst_md(0)->data_type;
+    }
+    conf.N = N();
+    conf.m_blk = m_blk_;
+    return conf;
 }
 
-status_t jit_uni_sparse_matmul_t::init(engine_t *engine) {
-    if (mayiuse(avx512_core)) {
-        using kernel_t = jit_uni_sparse_matmul_kernel_t<avx512_core>;
-        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd())};
-    } else if (mayiuse(avx2)) {
-        using kernel_t = jit_uni_sparse_matmul_kernel_t<avx2>;
-        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd())};
+void jit_uni_sparse_matmul_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    if (encoding_ == sparse_encoding::coo)
+        scratchpad.template book<int32_t>(
+                key_matmul_sparse_tmp_ptr, (is_wei_sparse_ ? K() : M()) + 1);
+
+    if (is_wei_sparse_) {
+        scratchpad.template book<float>(
+                key_matmul_src_trans, (size_t)nthr_ * k_blk_ * m_blk_);
+        scratchpad.template book<float>(
+                key_matmul_dst_trans, (size_t)nthr_ * N() * m_blk_);
+    } else {
+        // Partial results of the first and the last rows of each thread.
+        scratchpad.template book<float>(
+                key_matmul_dst_in_acc_dt, (size_t)nthr_ * 2 * N());
     }
-    if (!kernel_) return status::runtime_error;
+}
 
+status_t jit_uni_sparse_matmul_t::init(engine_t *engine) {
+    const auto conf = pd()->kernel_conf();
+    CHECK(safe_ptr_assign(
+            kernel_, sparse_matmul_kernel_t::create(conf, pd()->isa_)));
     CHECK(kernel_->create_kernel());
+
+    if (conf.kind == kernel_kind_t::csr_rows && conf.dst_dt != data_type::f32) {
+        auto acc_conf = conf;
+        acc_conf.dst_dt = data_type::f32;
+        CHECK(safe_ptr_assign(acc_kernel_,
+                sparse_matmul_kernel_t::create(acc_conf, pd()->isa_)));
+        CHECK(acc_kernel_->create_kernel());
+    }
     return status::success;
 }
 
-jit_uni_sparse_matmul_t::jit_uni_sparse_matmul_t(const pd_t *apd)
-    : primitive_t(apd) {}
-jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
-
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
-    const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
-    const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
-    const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
-    const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+    if (pd()->has_zero_dim_memory()) return status::success;
+    return pd()->is_wei_sparse_ ? execute_sparse_wei(ctx)
+                                : execute_sparse_src(ctx);
+}
+
+status_t jit_uni_sparse_matmul_t::execute_sparse_src(
+        const exec_ctx_t &ctx) const {
+    const auto *weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *src_values = CTX_IN_MEM(const void *, DNNL_ARG_SRC, 0);
+    const auto *src_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *src_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
     status_t status = status::success;
-    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
     CHECK(status);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    const int32_t *indices = src_buffer_1;
+    const int32_t *pointers = src_buffer_2;
+    if (pd()->encoding_ == sparse_encoding::coo) {
+        int32_t *tmp_pointers = scratchpad.template get<int32_t>(
+                memory_tracking::names::key_matmul_sparse_tmp_ptr);
+        cvt_coo_indices_to_csr_pointers(
+                src_buffer_1, tmp_pointers, src_d.nnz(), M);
+        indices = src_buffer_2;
+        pointers = tmp_pointers;
+    }
 
-    const dim_t M = dst_d.dims()[0];
-    const dim_t N = dst_d.dims()[1];
-
-    // TODO: Implement a load balancing mechanism that would distribute
-    // rows between threads based on the number of non-zero elements in those
-    // rows.
+    const dim_t work_amount = row_unit(pointers, M);
+    int nthr = pd()->nthr_;
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // Empirical.
     const size_t threshold_in_kb = 1400;
     const size_t data_to_process_in_kb
             = (src_d.nnz() + M) * N * src_d.data_type_size() / 1024;
+    if (data_to_process_in_kb < threshold_in_kb) nthr = 1;
+#endif
+    // Threads are not re-balanced by the runtime, so the partitioning below
+    // is known up front.
+    nthr = adjust_num_threads(nthr, work_amount);
+
+    float *partial_base = scratchpad.template get<float>(
+            memory_tracking::names::key_matmul_dst_in_acc_dt);
+    const auto *acc_kernel = acc_kernel_ ? acc_kernel_.get() : kernel_.get();
+
+    // Threads get equal numbers of work units. A row split between threads
+    // is computed by each of them into a partial buffer: slot 0 for the first
+    // row of a thread, slot 1 for the last one.
+    const auto partial_slot = [&](int ithr, int slot) {
+        return partial_base + ((size_t)ithr * 2 + slot) * N;
+    };
+
+    parallel(nthr, [&](const int ithr, const int) {
+        dim_t u_start {0}, u_end {0};
+        balance211(work_amount, nthr, ithr, u_start, u_end);
+        if (u_start >= u_end) return;
 
-    // If not, use 0, which means all threads.
-    const int nthr = data_to_process_in_kb < threshold_in_kb;
-
-    parallel(nthr, [&](const int ithr, const int nthr) {
-        dim_t start = 0, end = 0;
-        balance211(M, nthr, ithr, start, end);
-        if (start >= end) return;
-
-        for (dim_t m = start; m < end; m++) {
-            const int row_begin = src_pointers[m];
-            const int row_end = src_pointers[m + 1];
-            const int nnz = row_end - row_begin;
-
-            sparse_matmul_kernel_t::call_params_t p;
-            p.nnz = nnz;
-            p.src_values = src_values + row_begin;
-            p.src_indices = src_indices + row_begin;
-            p.wei = weights;
-            p.dst = dst + (m * N);
-            p.block_size = kernel_->block_size();
+        const dim_t m_first = unit_row(pointers, M, u_start);
+        const dim_t m_last = unit_row(pointers, M, u_end - 1);
+
+        sparse_matmul_kernel_t::call_params_t p;
+        p.values = src_values;
+        p.indices = indices;
+        p.dense = weights;
+
+        const auto is_full = [&](dim_t m) {
+            return u_start <= row_unit(pointers, m)
+                    && row_unit(pointers, m + 1) <= u_end;
+        };
+        const auto compute_partial = [&](dim_t m, int slot) {
+            const dim_t row_start = row_unit(pointers, m);
+            const dim_t nnz = pointers[m + 1] - pointers[m];
+            // The last unit of a row is its store, it has no non-zeros.
+            const dim_t nz_start = nstl::max(u_start - row_start, dim_t(0));
+            const dim_t nz_end = nstl::min(u_end - row_start, nnz);
+            const int32_t row_pointers[2] = {
+                    static_cast<int32_t>(pointers[m] + nz_start),
+                    static_cast<int32_t>(
+                            pointers[m] + nstl::max(nz_start, nz_end))};
+            p.pointers = row_pointers;
+            p.dst = partial_slot(ithr, slot);
+            p.nrows = 1;
+            (*acc_kernel)(&p);
+        };
+
+        dim_t m_full_start = m_first, m_full_end = m_last + 1;
+        if (!is_full(m_first)) {
+            compute_partial(m_first, 0);
+            m_full_start++;
+        }
+        if (m_last >= m_full_start && !is_full(m_last)) {
+            compute_partial(m_last, 1);
+            m_full_end--;
+        }
+        if (m_full_start < m_full_end) {
+            p.pointers = pointers + m_full_start;
+            p.dst = dst + m_full_start * N * dst_dt_size;
+            p.nrows = m_full_end - m_full_start;
             (*kernel_)(&p);
         }
     });
-#else
 
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
+    // Reduce rows split between threads into the partial buffer of the
+    // thread owning the beginning of the row. Each split row is handled by
+    // the first thread starting inside of it.
+    if (nthr > 1) {
+        const auto thr_start = [&](int ithr) {
+            dim_t u_start {0}, u_end {0};
+            balance211(work_amount, nthr, ithr, u_start, u_end);
+            return u_start;
+        };
+        parallel_nd(nthr - 1, [&](dim_t t) {
+            const int ithr = static_cast<int>(t) + 1;
+            const dim_t u = thr_start(ithr);
+            const dim_t m = unit_row(pointers, M, u);
+            const dim_t row_start = row_unit(pointers, m);
+            const dim_t row_end = row_unit(pointers, m + 1);
+            if (row_start == u || thr_start(ithr - 1) > row_start) return;
+
+            const auto row_slot = [&](int i) {
+                const int slot
+                        = unit_row(pointers, M, thr_start(i)) == m ? 0 : 1;
+                return partial_slot(i, slot);
+            };
+            float *acc = row_slot(ithr - 1);
+            for (int i = ithr; i < nthr && thr_start(i) < row_end; i++) {
+                const float *part = row_slot(i);
+                for (dim_t n = 0; n < N; n++)
+                    acc[n] += part[n];
+            }
+            for (dim_t n = 0; n < N; n++)
+                cpu::io::store_float_value(
+                        dst_d.data_type(), acc[n], dst, m * N + n);
+        });
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_sparse_matmul_t::execute_sparse_wei(
+        const exec_ctx_t &ctx) const {
+    using namespace data_type;
+
+    const auto *src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto *wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+    const auto *wei_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto *wei_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t K = pd()->K();
+    const dim_t m_blk = pd()->m_blk_;
+    const dim_t k_blk = pd()->k_blk_;
+    const auto src_dt = src_d.data_type();
+
+    const int32_t *indices = wei_buffer_1;
+    const int32_t *pointers = wei_buffer_2;
+    if (pd()->encoding_ == sparse_encoding::coo) {
+        int32_t *tmp_pointers = scratchpad.template get<int32_t>(
+                memory_tracking::names::key_matmul_sparse_tmp_ptr);
+        cvt_coo_indices_to_csr_pointers(
+                wei_buffer_1, tmp_pointers, wei_d.nnz(), K);
+        indices = wei_buffer_2;
+        pointers = tmp_pointers;
+    }
+
+    float *src_trans_base = scratchpad.template get<float>(
+            memory_tracking::names::key_matmul_src_trans);
+    float *acc_base = scratchpad.template get<float>(
+            memory_tracking::names::key_matmul_dst_trans);
+
+    // Blocks of source rows are independent. If there are fewer blocks than
+    // threads, rows of weights are split between threads as well and the
+    // partial accumulators are reduced afterwards.
+    const int nthr = pd()->nthr_;
+    const dim_t n_mblk = utils::div_up(M, m_blk);
+    const dim_t nthr_k = n_mblk >= nthr ? 1 : nthr / n_mblk;
+    const dim_t work_amount = n_mblk * nthr_k;
+    const dim_t k_units = row_unit(pointers, K);
+
+    using transpose_src_f = void (*)(
+            const void *, dim_t, dim_t, dim_t, dim_t, float *);
+    using store_acc_f = void (*)(const float *, dim_t, dim_t, dim_t, void *);
+    transpose_src_f transpose_src = nullptr;
+    store_acc_f store_acc_rows = nullptr;
+    switch (src_dt) {
+        case f32: transpose_src = transpose_src_block<f32>; break;
+        case bf16: transpose_src = transpose_src_block<bf16>; break;
+        case f16: transpose_src = transpose_src_block<f16>; break;
+        case s8: transpose_src = transpose_src_block<s8>; break;
+        case u8: transpose_src = transpose_src_block<u8>; break;
+        default: assert(!"unsupported data type");
+    }
+    switch (dst_d.data_type()) {
+        case f32: store_acc_rows = store_acc_block<f32>; break;
+        case bf16: store_acc_rows = store_acc_block<bf16>; break;
+        case f16: store_acc_rows = store_acc_block<f16>; break;
+        case s32: store_acc_rows = store_acc_block<s32>; break;
+        default: assert(!"unsupported data type");
+    }
+    if (!transpose_src || !store_acc_rows) return status::runtime_error;
+    const size_t src_dt_size = types::data_type_size(src_dt);
+    const size_t dst_dt_size = types::data_type_size(dst_d.data_type());
+
+    const auto store_acc = [&](const float *acc, dim_t mb) {
+        const dim_t m_start = mb * m_blk;
+        const dim_t cur_m = nstl::min(m_blk, M - m_start);
+        store_acc_rows(acc, N, cur_m, m_blk,
+                static_cast<char *>(dst) + m_start * N * dst_dt_size);
+    };
+
+    parallel(adjust_num_threads(nthr, work_amount),
+            [&](const int ithr, const int nthr_work) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr_work, ithr, start, end);
 
+        float *src_trans = src_trans_base + (size_t)ithr * k_blk * m_blk;
         sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
+        p.values = wei_values;
+        p.indices = indices;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t mb = iwork / nthr_k;
+            const dim_t ik = iwork % nthr_k;
+            const dim_t m_start = mb * m_blk;
+            const dim_t cur_m = nstl::min(m_blk, M - m_start);
+            // With split rows of weights, every work item owns its
+            // accumulator for the reduction.
+            float *acc = acc_base
+                    + (size_t)(nthr_k > 1 ? iwork : ithr) * N * m_blk;
+            std::fill(acc, acc + N * m_blk, 0.f);
+
+            // Rows of weights are balanced by their number of non-zeros.
+            dim_t u_start {0}, u_end {0};
+            balance211(k_units, nthr_k, ik, u_start, u_end);
+            const dim_t k_start = u_start == 0
+                    ? 0
+                    : unit_row(pointers, K, u_start - 1) + 1;
+            const dim_t k_end
+                    = u_end == 0 ? 0 : unit_row(pointers, K, u_end - 1) + 1;
+
+            for (dim_t k0 = k_start; k0 < k_end; k0 += k_blk) {
+                const dim_t cur_k = nstl::min(k_blk, k_end - k0);
+                transpose_src(static_cast<const char *>(src)
+                                + (m_start * K + k0) * src_dt_size,
+                        K, cur_m, cur_k, m_blk, src_trans);
+
+                p.pointers = pointers + k0;
+                p.dense = src_trans;
+                p.dst = acc;
+                p.nrows = cur_k;
+                (*kernel_)(&p);
+            }
+
+            if (nthr_k == 1) store_acc(acc, mb);
+        }
     });
-#endif
+
+    if (nthr_k > 1) {
+        parallel_nd(n_mblk, [&](dim_t mb) {
+            float *acc = acc_base + (size_t)mb * nthr_k * N * m_blk;
+            for (dim_t ik = 1; ik < nthr_k; ik++) {
+                const float *part = acc + (size_t)ik * N * m_blk;
+                for (dim_t i = 0; i < N * m_blk; i++)
+                    acc[i] += part[i];
+            }
+            store_acc(acc, mb);
+        });
+    }
+
     return status::success;
 }
 
@@ -17,75 +17,127 @@
 #ifndef CPU_X64_MATMUL_JIT_UNI_SPARSE_MATMUL_HPP
 #define CPU_X64_MATMUL_JIT_UNI_SPARSE_MATMUL_HPP
 
+#include <memory>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
-#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
 
+#include "cpu/x64/cpu_isa_traits.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace x64 {
 namespace matmul {
 
-struct sparse_matmul_kernel_t;
+namespace sparse_matmul_impl {
+
+enum class kernel_kind_t {
+    // Multiplies CSR rows of the sparse source by the dense weights. Each
+    // non-zero value is broadcast and multiplied by a row of weights, the
+    // result is vectorized over N.
+    csr_rows,
+    // Multiplies a block of dense source rows by CSR rows of the sparse
+    // weights. The source block is transposed to f32 beforehand and the
+    // result is accumulated into a transposed f32 buffer, so the computation
+    // is vectorized over M.
+    csr_cols,
+};
+
+struct kernel_conf_t {
+    kernel_kind_t kind;
+    data_type_t values_dt, dense_dt, dst_dt;
+    dim_t N;
+    // csr_cols only: rows of the transposed source block, a power of two.
+    dim_t m_blk;
+};
+
+struct sparse_matmul_kernel_t {
+    static sparse_matmul_kernel_t *create(
+            const kernel_conf_t &conf, const cpu_isa_t isa);
+
+    virtual ~sparse_matmul_kernel_t() = default;
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *values;
+        const int32_t *indices, *pointers;
+        // csr_rows: dense weights; csr_cols: transposed source block.
+        const void *dense;
+        // csr_rows: destination rows; csr_cols: transposed accumulator.
+        void *dst;
+        // csr_rows: number of rows; csr_cols: number of rows of weights.
+        size_t nrows;
+    };
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+
+protected:
+    sparse_matmul_kernel_t(const kernel_conf_t &conf) : conf_(conf) {}
 
+    const kernel_conf_t conf_;
+};
+
+} // namespace sparse_matmul_impl
+
+// Sparse-dense matrix multiplication for CSR and COO encodings. COO indices
+// are compressed into CSR pointers on every execution.
+//
+// Work is distributed between threads by the number of non-zero elements
+// rather than by rows, so skewed distributions of non-zeros do not leave
+// threads idle. Rows of a sparse source may be split between threads, in
+// which case partial f32 results are reduced in a separate pass.
 struct jit_uni_sparse_matmul_t : public primitive_t {
     struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
         using cpu_matmul_pd_t::cpu_matmul_pd_t;
 
-        DECLARE_COMMON_PD_T("jit:uni", jit_uni_sparse_matmul_t);
+        const char *impl_name() const {
+            return JIT_IMPL_NAME_HELPER("jit:", isa_, "");
+        }
 
-        status_t init(engine_t *engine) {
-            using namespace data_type;
-            const auto src_type = src_md(0)->data_type;
-            const auto wei_type = weights_md(0)->data_type;
-            const auto dst_type = dst_md(0)->data_type;
+        DECLARE_COMMON_PD_T(impl_name(), jit_uni_sparse_matmul_t);
 
-            memory_desc_wrapper src_d(src_md());
-            memory_desc_wrapper wei_d(weights_md(0));
+        status_t init(engine_t *engine);
 
-            const bool problem_dt_correct
-                    = utils::everyone_is(f32, src_type, wei_type, dst_type)
-                    && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
-                    && utils::everyone_is(s32, src_d.metadata_type(0),
-                            src_d.metadata_type(1));
+        cpu_isa_t isa_ = isa_undef;
+        bool is_wei_sparse_ = false;
+        sparse_encoding_t encoding_ = sparse_encoding::undef;
+        int nthr_ = 0;
+        // Rows of the source block processed by a csr_cols kernel, chosen
+        // from M.
+        dim_t m_blk_ = 0;
+        // Rows of the sparse weights processed by a single csr_cols call.
+        dim_t k_blk_ = 0;
 
-            VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT_CFG);
-            VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
-            VDISPATCH_MATMUL(
-                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
-            VDISPATCH_MATMUL(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
-            VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
-            VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+        sparse_matmul_impl::kernel_conf_t kernel_conf() const;
 
-            return status::success;
-        }
-
-        bool formats_ok() const {
-            const bool is_dst_ab
-                    = memory_desc_wrapper(dst_md()).matches_one_of_tag(
-                            format_tag::ab);
-            const bool is_wei_ab = memory_desc_wrapper(weights_md())
-                                           .matches_one_of_tag(format_tag::ab);
-            return is_dst_ab && is_wei_ab;
-        }
+    private:
+        bool formats_ok() const;
+        void init_scratchpad();
     };
 
-    jit_uni_sparse_matmul_t(const pd_t *apd);
-    ~jit_uni_sparse_matmul_t() override;
+    jit_uni_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
 
     status_t init(engine_t *engine) override;
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
-    std::unique_ptr<sparse_matmul_kernel_t> kernel_;
+
+    status_t execute_sparse_src(const exec_ctx_t &ctx) const;
+    status_t execute_sparse_wei(const exec_ctx_t &ctx) const;
+
+    std::unique_ptr<sparse_matmul_impl::sparse_matmul_kernel_t> kernel_;
+    // csr_rows kernel writing f32 partial results of rows split between
+    // threads. Not created when the destination is f32 already.
+    std::unique_ptr<sparse_matmul_impl::sparse_matmul_kernel_t> acc_kernel_;
 };
 
 } // namespace matmul
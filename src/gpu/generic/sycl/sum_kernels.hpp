@@ -29,7 +29,6 @@ namespace gpu {
 namespace generic {
 namespace sycl {
 
-#define DNNL_ARG_SRC_4 5
 #define DNNL_ARG_SRC_5 6
 #define DNNL_ARG_SRC_6 7
 #define DNNL_ARG_SRC_7 8
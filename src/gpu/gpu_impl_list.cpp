@@ -49,6 +49,14 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(shuffle);
             CASE(softmax);
             CASE(zero_pad);
+            // Grouped matmul is implemented for CPU only.
+            case primitive_kind::grouped_matmul: return empty_list;
+            // RoPE is implemented for CPU only.
+            case primitive_kind::rope: return empty_list;
+            // Embedding bag is implemented for CPU only.
+            case primitive_kind::embedding_bag: return empty_list;
+            // Top-k is implemented for CPU only.
+            case primitive_kind::top_k: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
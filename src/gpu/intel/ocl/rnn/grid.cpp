@@ -603,6 +603,8 @@ status_t simple_rnn_common_t<aprop>::pd_t::init(impl::engine_t *engine) {
             VERBOSE_BAD_ALGORITHM);
     VDISPATCH_RNN(!this->is_lstm_peephole(), "is_lstm_peephole");
     VDISPATCH_RNN(!this->is_lstm_projection(), "is_lstm_projection");
+    VDISPATCH_RNN(!this->is_variable_length(), VERBOSE_UNSUPPORTED_FEATURE,
+            "variable-length sequences");
     VDISPATCH_RNN(IMPLICATION(aprop == prop_kind::forward,
                           one_of(this->desc()->prop_kind, forward_training,
                                   forward_inference)),
@@ -1039,6 +1039,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                 .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
                         (int64_t)-1)
                 // New added attributes
+                .set_attr(op_attr::is_rms_norm, false, attribute_kind::b,
+                        false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(infer_norm_output_shape)
@@ -1160,6 +1162,68 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_sdpa, 1,
                 .SET_EXECUTABLE_CREATOR(executable_creator<sdpa_executable_t>)
                 .SET_ARG_INDICES_GETTER(sdpa_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_rope, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(1)
+                .set_input(0, "src")
+                .set_input(1, "cos")
+                .set_input(2, "sin")
+                .set_input(3, "positions") // optional
+                .set_output(0, "dst")
+                // Attributes inherited from front RotaryEmbedding ops
+                .set_attr(op_attr::mode, false, attribute_kind::s, "half_split",
+                        {"half_split", "interleaved"})
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_identity_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_rope)
+                .SET_EXECUTABLE_CREATOR(executable_creator<rope_executable_t>)
+                .SET_ARG_INDICES_GETTER(rope_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_embedding_bag, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(1)
+                .set_input(0, "table")
+                .set_input(1, "indices")
+                .set_input(2, "offsets")
+                .set_input(3, "per_sample_weights") // optional
+                .set_output(0, "dst")
+                // Attributes inherited from front EmbeddingBag ops
+                .set_attr(op_attr::mode, false, attribute_kind::s, "sum",
+                        {"sum", "mean", "max"})
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_embedding_bag_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_embedding_bag)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<embedding_bag_executable_t>)
+                .SET_ARG_INDICES_GETTER(embedding_bag_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_top_k, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(3)
+                .set_input(0, "src")
+                .set_output(0, "values")
+                .set_output(1, "indices")
+                .set_output(2, "scratchpad")
+                // Attributes inherited from front TopK ops
+                .set_attr(op_attr::k, true, attribute_kind::i)
+                .set_attr(op_attr::axis, false, attribute_kind::i, (int64_t)-1)
+                .set_attr(op_attr::mode, false, attribute_kind::s, "max",
+                        {"max", "min"})
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_top_k_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_top_k)
+                .SET_EXECUTABLE_CREATOR(executable_creator<top_k_executable_t>)
+                .SET_ARG_INDICES_GETTER(top_k_executable_t))
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -109,10 +109,10 @@ status_t infer_dnnl_conv_output_shape(op_t *n,
         const size_t ow_offset
                 = (src_fmt == "NCX") ? output_dims.size() - 1 : 2;
         const dim_t stride = 2;
-        const dim_t new_oh = static_cast<dim_t>(
-                std::ceil(output_dims[oh_offset] / stride));
-        const dim_t new_ow = static_cast<dim_t>(
-                std::ceil(output_dims[ow_offset] / stride));
+        const dim_t new_oh
+                = dnnl::impl::utils::div_up(output_dims[oh_offset], stride);
+        const dim_t new_ow
+                = dnnl::impl::utils::div_up(output_dims[ow_offset], stride);
         output_dims[oh_offset] = new_oh;
         output_dims[ow_offset] = new_ow;
         set_shape_and_strides(*outputs[0], output_dims);
@@ -49,6 +49,7 @@ const op_attr_t with_scale = 0x10010;
 const op_attr_t is_invert_scale = 0x10011;
 const op_attr_t with_causal = 0x10012;
 const op_attr_t with_mask = 0x10013;
+const op_attr_t is_rms_norm = 0x10014;
 
 // int64_t
 const op_attr_t alg_kind = 0x10100;
@@ -94,6 +95,7 @@ static inline std::string internal_attr2str(op_attr_t attr) {
         CASE(is_invert_scale);
         CASE(with_causal);
         CASE(with_mask);
+        CASE(is_rms_norm);
         CASE(alg_kind);
         CASE(fusion_info_key);
         CASE(axis_row);
@@ -80,7 +80,10 @@ namespace op_kind {
     X(dnnl_groupnorm, Dnnl_groupnorm) \
     X(dnnl_gen_index, Dnnl_gen_index) \
     X(dnnl_mask, Dnnl_mask) \
-    X(dnnl_sdpa, Dnnl_sdpa)
+    X(dnnl_sdpa, Dnnl_sdpa) \
+    X(dnnl_rope, Dnnl_rope) \
+    X(dnnl_embedding_bag, Dnnl_embedding_bag) \
+    X(dnnl_top_k, Dnnl_top_k)
 
 enum kind_t {
     kDNNL_INTERNAL_OP_STARTER = 0x1234,
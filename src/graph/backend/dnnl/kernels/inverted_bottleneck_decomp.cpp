@@ -0,0 +1,636 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <future>
+#include <unordered_set>
+
+#include "graph/backend/dnnl/kernels/inverted_bottleneck_decomp.hpp"
+
+#include "cpu/platform.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+#define VCHECK_IB_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, inverted_bottleneck_decomp_kernel_t, \
+            (cond), status, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+using ltw = logical_tensor_wrapper_t;
+
+// Size of a buffer in the scratchpad, buffers are aligned to a cache line.
+size_t buf_size(size_t size) {
+    return dnnl::impl::utils::rnd_up(size, 64);
+}
+
+size_t get_l2_size() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return dnnl::impl::cpu::platform::get_per_core_cache_size(2);
+#else
+    return 1024 * 1024;
+#endif
+}
+
+// Checks that the tensor has plain strides in the order of its dimensions.
+bool is_dense(const logical_tensor_t &lt) {
+    const ltw w(lt);
+    if (!w.is_strided() || w.ndims() <= 0) return false;
+    const auto dims = w.vdims();
+    const auto strides = w.vstrides();
+    dim_t stride = 1;
+    for (int i = w.ndims() - 1; i >= 0; i--) {
+        if (dims[i] != 1 && strides[i] != stride) return false;
+        stride *= dims[i];
+    }
+    return true;
+}
+
+std::string get_str_attr(
+        const op_t *op, op_attr_t name, const std::string &def) {
+    return op->has_attr(name) ? op->get_attr<std::string>(name) : def;
+}
+
+} // namespace
+
+status_t inverted_bottleneck_decomp_kernel_t::init_block(
+        const dnnl_partition_impl_t *part,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    VCHECK_IB_DECOMP(outputs.size() == 1, status::unimplemented,
+            "unexpected number of outputs %zu", outputs.size());
+
+    const auto &ops = part->get_ops();
+    std::unordered_set<const op_t *> op_set;
+    for (const auto &op : ops)
+        op_set.insert(op.get());
+
+    const auto input_idx = [&](const std::shared_ptr<value_t> &val) -> int {
+        const size_t id = val->get_logical_tensor().id;
+        for (size_t i = 0; i < inputs.size(); i++)
+            if (inputs[i].id == id) return static_cast<int>(i);
+        return -1;
+    };
+    const auto next_op = [&](const op_t *op) -> op_t * {
+        const auto &consumers = op->get_output_value(0)->get_consumers();
+        if (consumers.size() != 1) return nullptr;
+        op_t *next = &consumers[0].get_op();
+        return op_set.count(next) ? next : nullptr;
+    };
+
+    // The block starts with the only convolution reading a partition input.
+    op_t *op = nullptr;
+    for (const auto &cur : ops) {
+        if (cur->get_kind() == graph::op_kind::Convolution
+                && input_idx(cur->get_input_value(0)) != -1) {
+            op = cur.get();
+            break;
+        }
+    }
+    VCHECK_IB_DECOMP(op != nullptr, status::unimplemented,
+            "no convolution reads the block input");
+    src_idx_ = input_idx(op->get_input_value(0));
+
+    std::array<const op_t *, n_stages> convs {};
+    const op_t *last = nullptr;
+    size_t n_block_ops = 0;
+    const auto append = [&](op_t *cur) {
+        last = cur;
+        n_block_ops++;
+        return next_op(cur);
+    };
+    for (int s = 0; s < n_stages; s++) {
+        VCHECK_IB_DECOMP(op && op->get_kind() == graph::op_kind::Convolution,
+                status::unimplemented, "convolution %d is not found", s);
+        auto &stage = stages_[s];
+        convs[s] = op;
+        stage.wei_idx = input_idx(op->get_input_value(1));
+        if (op->num_inputs() > 2)
+            stage.bias_idx = input_idx(op->get_input_value(2));
+        VCHECK_IB_DECOMP(stage.wei_idx != -1
+                        && (op->num_inputs() == 2 || stage.bias_idx != -1),
+                status::unimplemented,
+                "weights and bias should be partition inputs");
+        op = append(op);
+
+        if (op && op->get_kind() == graph::op_kind::BiasAdd
+                && stage.bias_idx == -1) {
+            stage.bias_idx = input_idx(op->get_input_value(1));
+            VCHECK_IB_DECOMP(stage.bias_idx != -1, status::unimplemented,
+                    "bias should be a partition input");
+            op = append(op);
+        }
+
+        if (!op) continue;
+        if (op->get_kind() == graph::op_kind::ReLU) {
+            stage.eltwise_alg = algorithm::eltwise_relu;
+        } else if (op->get_kind() == graph::op_kind::Clamp) {
+            stage.eltwise_alg = algorithm::eltwise_clip;
+            stage.alpha = op->get_attr<float>(op_attr::min);
+            stage.beta = op->get_attr<float>(op_attr::max);
+        } else if (op->get_kind() == graph::op_kind::HardSwish) {
+            stage.eltwise_alg = algorithm::eltwise_hardswish;
+            stage.alpha = 1.f / 6.f;
+            stage.beta = 1.f / 2.f;
+        }
+        if (stage.eltwise_alg != algorithm::undef) op = append(op);
+    }
+
+    if (op && op->get_kind() == graph::op_kind::Add) {
+        // The other input of the add should be the block input.
+        const size_t last_id
+                = last->get_output_value(0)->get_logical_tensor().id;
+        const bool is_in0_last
+                = op->get_input_value(0)->get_logical_tensor().id == last_id;
+        const int res_idx = input_idx(op->get_input_value(is_in0_last ? 1 : 0));
+        with_residual_ = res_idx == src_idx_;
+        VCHECK_IB_DECOMP(with_residual_, status::unimplemented,
+                "add is not a residual connection of the block");
+        append(op);
+    }
+
+    VCHECK_IB_DECOMP(n_block_ops == ops.size(), status::unimplemented,
+            "partition has %zu ops, but only %zu are recognized", ops.size(),
+            n_block_ops);
+    VCHECK_IB_DECOMP(last->get_output_value(0)->get_logical_tensor().id
+                    == outputs[0].id,
+            status::unimplemented,
+            "partition output is not produced by the last op of the block");
+
+    // Source and data type checks.
+    const logical_tensor_t &src_lt = inputs[src_idx_];
+    VCHECK_IB_DECOMP(ltw(src_lt).ndims() == 4 && is_dense(src_lt),
+            status::unimplemented, "only dense 4D source is supported");
+    dt_ = static_cast<memory::data_type>(ltw(src_lt).data_type());
+    VCHECK_IB_DECOMP(dt_ == data_type::f32 || dt_ == data_type::bf16
+                    || dt_ == data_type::f16,
+            status::unimplemented, "unsupported data type");
+    for (const auto &cur : ops) {
+        const auto out_dt
+                = cur->get_output_value(0)->get_logical_tensor().data_type;
+        VCHECK_IB_DECOMP(out_dt == dnnl_data_type_undef
+                        || static_cast<memory::data_type>(out_dt) == dt_,
+                status::unimplemented,
+                "intermediate data types should match the source one");
+    }
+
+    const auto src_dims = ltw(src_lt).vdims();
+    mb_ = src_dims[0];
+    ih_ = src_dims[1];
+    iw_ = src_dims[2];
+    ic_ = src_dims[3];
+
+    // Convolution checks.
+    for (int s = 0; s < n_stages; s++) {
+        const op_t *conv = convs[s];
+        auto &stage = stages_[s];
+        const bool is_dw = s == depthwise;
+
+        VCHECK_IB_DECOMP(
+                get_str_attr(conv, op_attr::data_format, "NXC") == "NXC",
+                status::unimplemented, "only NXC data format is supported");
+        VCHECK_IB_DECOMP(
+                get_str_attr(conv, op_attr::auto_pad, "None") == "None",
+                status::unimplemented, "auto padding is not supported");
+        const auto dilations
+                = conv->get_attr<std::vector<int64_t>>(op_attr::dilations);
+        VCHECK_IB_DECOMP(std::all_of(dilations.begin(), dilations.end(),
+                                 [](int64_t d) { return d == 1; }),
+                status::unimplemented, "dilated convolution is not supported");
+        const auto strides
+                = conv->get_attr<std::vector<int64_t>>(op_attr::strides);
+        const auto pads_begin
+                = conv->get_attr<std::vector<int64_t>>(op_attr::pads_begin);
+        const auto pads_end
+                = conv->get_attr<std::vector<int64_t>>(op_attr::pads_end);
+        VCHECK_IB_DECOMP(strides.size() == 2 && pads_begin.size() == 2
+                        && pads_end.size() == 2,
+                status::unimplemented, "only 2D convolution is supported");
+        const int64_t groups = conv->has_attr(op_attr::groups)
+                ? conv->get_attr<int64_t>(op_attr::groups)
+                : 1;
+
+        const logical_tensor_t &wei_lt = inputs[stage.wei_idx];
+        VCHECK_IB_DECOMP(ltw(wei_lt).ndims() == 4 && is_dense(wei_lt)
+                        && ltw(wei_lt).data_type() == src_lt.data_type,
+                status::unimplemented,
+                "weights should be dense 4D tensor of the source data type");
+        const bool is_xio
+                = get_str_attr(conv, op_attr::weights_format, "XIO") == "XIO";
+        const auto wei_dims = ltw(wei_lt).vdims();
+        const dim_t wkh = is_xio ? wei_dims[0] : wei_dims[2];
+        const dim_t wkw = is_xio ? wei_dims[1] : wei_dims[3];
+        const dim_t wic = is_xio ? wei_dims[2] : wei_dims[1];
+        const dim_t woc = is_xio ? wei_dims[3] : wei_dims[0];
+        const dim_t conv_ic = s == expand ? ic_ : c_;
+
+        if (is_dw) {
+            VCHECK_IB_DECOMP(groups == c_ && wic == 1 && woc == c_,
+                    status::unimplemented,
+                    "second convolution should be depthwise");
+            kh_ = wkh;
+            kw_ = wkw;
+            sh_ = strides[0];
+            sw_ = strides[1];
+            t_pad_ = pads_begin[0];
+            l_pad_ = pads_begin[1];
+            b_pad_ = pads_end[0];
+            r_pad_ = pads_end[1];
+            stage.user_wei_md = memory::desc({c_, 1, 1, kh_, kw_}, dt_,
+                    is_xio ? tag::hwigo : tag::goihw);
+        } else {
+            const bool is_1x1 = wkh == 1 && wkw == 1 && strides[0] == 1
+                    && strides[1] == 1 && pads_begin[0] == 0
+                    && pads_begin[1] == 0 && pads_end[0] == 0
+                    && pads_end[1] == 0;
+            VCHECK_IB_DECOMP(groups == 1 && is_1x1 && wic == conv_ic,
+                    status::unimplemented,
+                    "convolution %d should be pointwise", s);
+            if (s == expand)
+                c_ = woc;
+            else
+                oc_ = woc;
+            stage.user_wei_md = memory::desc({woc, wic, 1, 1}, dt_,
+                    is_xio ? tag::hwio : tag::oihw);
+        }
+
+        if (stage.bias_idx != -1) {
+            const logical_tensor_t &bias_lt = inputs[stage.bias_idx];
+            VCHECK_IB_DECOMP(ltw(bias_lt).ndims() == 1
+                            && ltw(bias_lt).vdims()[0] == woc
+                            && is_dense(bias_lt),
+                    status::unimplemented, "unsupported bias");
+            stage.bias_md = memory::desc({woc},
+                    static_cast<memory::data_type>(ltw(bias_lt).data_type()),
+                    tag::a);
+        }
+    }
+
+    oh_ = (ih_ + t_pad_ + b_pad_ - kh_) / sh_ + 1;
+    ow_ = (iw_ + l_pad_ + r_pad_ - kw_) / sw_ + 1;
+    VCHECK_IB_DECOMP(oh_ > 0 && ow_ > 0, status::unimplemented,
+            "empty destination is not supported");
+    VCHECK_IB_DECOMP(
+            IMPLICATION(with_residual_,
+                    oh_ == ih_ && ow_ == iw_ && oc_ == ic_),
+            status::unimplemented,
+            "residual connection requires equal source and destination "
+            "shapes");
+
+    // The destination may be not fully defined, the known part of it should
+    // describe a dense NXC tensor.
+    const ltw dst_w(outputs[0]);
+    VCHECK_IB_DECOMP(IMPLICATION(!dst_w.is_shape_unknown(),
+                             dst_w.vdims() == dims({mb_, oh_, ow_, oc_})),
+            status::unimplemented, "unexpected destination shape");
+    VCHECK_IB_DECOMP(!dst_w.is_opaque()
+                    && IMPLICATION(dst_w.is_strided()
+                                    && !dst_w.is_stride_unknown(),
+                            is_dense(outputs[0])),
+            status::unimplemented, "only dense destination is supported");
+
+    return status::success;
+}
+
+status_t inverted_bottleneck_decomp_kernel_t::init_tiles() {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    const int nthr = dnnl_get_current_num_threads();
+#else
+    const int nthr = dnnl_get_max_threads();
+#endif
+    const size_t dt_size = memory::data_type_size(dt_);
+    const size_t row0_size = iw_ * c_ * dt_size;
+    const size_t row1_size = ow_ * c_ * dt_size;
+
+    // Both intermediate buffers should take at most a half of L2, the rest is
+    // left for the weights and the rows of the source and destination.
+    const size_t budget = get_l2_size() / 2;
+    const auto footprint = [&](dim_t blk) {
+        return ((blk - 1) * sh_ + kh_) * row0_size + blk * row1_size;
+    };
+    dim_t blk = 1;
+    while (blk < oh_ && footprint(blk + 1) <= budget)
+        blk++;
+    // The expansion conv recomputes (kh - sh) halo rows for every tile, keep
+    // this overhead within 25%.
+    const dim_t min_blk
+            = kh_ > sh_ ? dnnl::impl::utils::div_up(4 * (kh_ - sh_), sh_) : 1;
+    oh_blk_ = std::min(oh_, std::max(blk, min_blk));
+    // Tiles of the images are the only source of parallelism. When they are
+    // not enough for all the threads, split the rows further as long as the
+    // recomputed halo rows do not exceed the rows of the tile.
+    if (mb_ * dnnl::impl::utils::div_up(oh_, oh_blk_) < nthr) {
+        const dim_t par_blk = dnnl::impl::utils::div_up(
+                oh_, dnnl::impl::utils::div_up(nthr, mb_));
+        const dim_t min_par_blk
+                = kh_ > sh_ ? dnnl::impl::utils::div_up(kh_ - sh_, sh_) : 1;
+        oh_blk_ = std::min(oh_blk_, std::max(par_blk, min_par_blk));
+    }
+    n_tiles_ = dnnl::impl::utils::div_up(oh_, oh_blk_);
+
+    for (dim_t t = 0; t < n_tiles_; t++) {
+        const dim_t oh_s = t * oh_blk_;
+        const dim_t oh_rows = std::min(oh_blk_, oh_ - oh_s);
+        const dim_t ih_s = oh_s * sh_ - t_pad_;
+        const dim_t ih_e = (oh_s + oh_rows - 1) * sh_ - t_pad_ + kh_;
+        const dim_t t_pad = std::max<dim_t>(0, -ih_s);
+        const dim_t b_pad = std::max<dim_t>(0, ih_e - ih_);
+        const dim_t ih_rows = std::min(ih_e, ih_) - std::max<dim_t>(ih_s, 0);
+        VCHECK_IB_DECOMP(ih_rows > 0, status::unimplemented,
+                "tile %lld has no source rows", (long long)t);
+
+        size_t k = 0;
+        for (; k < tile_kinds_.size(); k++) {
+            const auto &kind = tile_kinds_[k];
+            if (kind.ih_rows == ih_rows && kind.oh_rows == oh_rows
+                    && kind.t_pad == t_pad && kind.b_pad == b_pad)
+                break;
+        }
+        if (k == tile_kinds_.size()) {
+            tile_kind_t kind;
+            kind.ih_rows = ih_rows;
+            kind.oh_rows = oh_rows;
+            kind.t_pad = t_pad;
+            kind.b_pad = b_pad;
+            tile_kinds_.push_back(std::move(kind));
+            buf0_size_ = std::max(buf0_size_, ih_rows * row0_size);
+            buf1_size_ = std::max(buf1_size_, oh_rows * row1_size);
+        }
+        tile_kind_idx_.push_back(k);
+    }
+
+    // The remaining threads are left idle if the tiles are still not enough.
+    nthr_ = static_cast<int>(std::min<dim_t>(nthr, mb_ * n_tiles_));
+    return status::success;
+}
+
+status_t inverted_bottleneck_decomp_kernel_t::create_tile_kind(
+        tile_kind_t &kind, const primitive_attr &attr, bool any_weights) {
+    const auto data_md = [&](dim_t c, dim_t h, dim_t w) {
+        return memory::desc({1, c, h, w}, dt_, tag::nhwc);
+    };
+    const std::array<memory::desc, n_stages + 1> data_mds
+            = {data_md(ic_, kind.ih_rows, iw_), data_md(c_, kind.ih_rows, iw_),
+                    data_md(c_, kind.oh_rows, ow_),
+                    data_md(oc_, kind.oh_rows, ow_)};
+
+    try {
+        for (int s = 0; s < n_stages; s++) {
+            auto &stage = stages_[s];
+            const bool is_dw = s == depthwise;
+
+            post_ops pops;
+            if (stage.eltwise_alg != algorithm::undef)
+                pops.append_eltwise(stage.eltwise_alg, stage.alpha, stage.beta);
+            const bool with_residual = s == project && with_residual_;
+            if (with_residual) {
+                // The residual rows have the shape of the destination tile.
+                pops.append_binary(algorithm::binary_add, data_mds[n_stages]);
+                residual_arg_ = DNNL_ARG_ATTR_MULTIPLE_POST_OP(pops.len() - 1)
+                        | DNNL_ARG_SRC_1;
+            }
+            primitive_attr stage_attr = attr;
+            stage_attr.set_post_ops(pops);
+
+            const memory::desc wei_md = any_weights
+                    ? memory::desc(stage.user_wei_md.get_dims(), dt_, tag::any)
+                    : stage.wei_md;
+            const dims strides = is_dw ? dims {sh_, sw_} : dims {1, 1};
+            const dims pad_l = is_dw ? dims {kind.t_pad, l_pad_} : dims {0, 0};
+            const dims pad_r = is_dw ? dims {kind.b_pad, r_pad_} : dims {0, 0};
+
+            auto pd = convolution_forward::primitive_desc(p_engine_,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, data_mds[s], wei_md,
+                    stage.bias_md, data_mds[s + 1], strides, pad_l, pad_r,
+                    stage_attr);
+            if (any_weights) stage.wei_md = pd.weights_desc();
+            kind.prims[s] = convolution_forward(pd);
+
+            auto &args_md = kind.args_md[s];
+            args_md[DNNL_ARG_SRC] = pd.src_desc();
+            args_md[DNNL_ARG_WEIGHTS] = pd.weights_desc();
+            if (stage.bias_idx != -1) args_md[DNNL_ARG_BIAS] = pd.bias_desc();
+            args_md[DNNL_ARG_DST] = pd.dst_desc();
+            args_md[DNNL_ARG_SCRATCHPAD] = pd.scratchpad_desc();
+            if (with_residual) args_md[residual_arg_] = data_mds[n_stages];
+
+            prim_scratch_size_ = std::max(
+                    prim_scratch_size_, pd.scratchpad_desc().get_size());
+        }
+    } catch (const dnnl::error &e) {
+        VCHECK_IB_DECOMP(false, status::unimplemented,
+                "failed to create convolution: %s", e.what());
+    }
+    return status::success;
+}
+
+status_t inverted_bottleneck_decomp_kernel_t::create_primitives(
+        const dnnl_partition_impl_t *part,
+        const std::vector<logical_tensor_t> &inputs) {
+    primitive_attr attr;
+    attr.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(part->get_fpmath_mode().mode_));
+    // must use user mode to support concurrent execution
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    // The weights layout is chosen by the primitives of the most frequent tile
+    // kind, the other tile kinds use the same weights.
+    std::vector<dim_t> n_kind_tiles(tile_kinds_.size(), 0);
+    for (size_t k : tile_kind_idx_)
+        n_kind_tiles[k]++;
+    const size_t main_kind = std::max_element(n_kind_tiles.begin(),
+                                     n_kind_tiles.end())
+            - n_kind_tiles.begin();
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // The primitives are executed inside the parallel region.
+    const int omp_nthr = dnnl_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    status_t status = create_tile_kind(tile_kinds_[main_kind], attr, true);
+    for (size_t k = 0; k < tile_kinds_.size() && status == status::success;
+            k++) {
+        if (k == main_kind) continue;
+        status = create_tile_kind(tile_kinds_[k], attr, false);
+    }
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(omp_nthr);
+#endif
+    CHECK(status);
+
+    std::vector<memory::desc> const_wei_mds;
+    for (auto &stage : stages_) {
+        if (stage.wei_md == stage.user_wei_md) continue;
+        stage.wei_reorder = reorder(reorder::primitive_desc(
+                p_engine_, stage.user_wei_md, p_engine_, stage.wei_md));
+        stage.is_constant = ltw(inputs[stage.wei_idx]).is_constant();
+        size_t &size = stage.is_constant ? const_wei_size_ : wei_size_;
+        stage.wei_offset = size;
+        size += buf_size(stage.wei_md.get_size());
+        if (stage.is_constant) const_wei_mds.push_back(stage.wei_md);
+    }
+    const_md_hash_ = generate_constant_md_hash(part->id(), const_wei_mds);
+    thr_size_ = buf_size(buf0_size_) + buf_size(buf1_size_)
+            + buf_size(prim_scratch_size_);
+    return status::success;
+}
+
+status_t inverted_bottleneck_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    CHECK(init_block(part, inputs, outputs));
+    CHECK(init_tiles());
+    CHECK(create_primitives(part, inputs));
+
+    // fill information for outputs logical tensors
+    auto &out = const_cast<logical_tensor_t &>(outputs[0]);
+    const dims dst_dims = {mb_, oh_, ow_, oc_};
+    const dims dst_strides = {oh_ * ow_ * oc_, ow_ * oc_, oc_, 1};
+    out.ndims = 4;
+    for (int d = 0; d < 4; d++) {
+        out.dims[d] = dst_dims[d];
+        out.layout.strides[d] = dst_strides[d];
+    }
+    out.layout_type = layout_type::strided;
+
+    resource_ctor_ = [this]() { return std::make_shared<args_set_t>(this); };
+
+    return status::success;
+}
+
+status_t inverted_bottleneck_decomp_kernel_t::execute_impl(
+        const stream_t *g_stream, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+#endif
+
+    thread_local_cache_t<args_set_t> res_cache;
+    args_set_t *res = res_cache.get_or_add(
+            reinterpret_cast<size_t>(this), resource_ctor_);
+
+    temporary_scratchpad_t scratchpad(
+            wei_size_ + thr_size_ * nthr_, p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= wei_size_ + thr_size_ * nthr_,
+            "no enough scratchpad memory");
+    char *scratch_ptr = scratchpad.get_buffer();
+
+    // Convert the weights once for all the tiles. The constant weights are
+    // converted only when they are not found in the constant cache.
+    constant_cache_t::cached_t c_buffer;
+    std::promise<constant_cache_t::cached_t> c_promise;
+    bool use_cache = false, convert_const_wei = false;
+    if (const_wei_size_ > 0) {
+        use_cache = enabled_constant_cache();
+        if (use_cache) {
+            const size_t encoded_key
+                    = encode_constant_cache_key(inputs, const_md_hash_);
+            constant_cache_t::value_t cached_value
+                    = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                            const_wei_size_, c_promise.get_future());
+            if (cached_value.valid()) c_buffer = cached_value.get();
+        }
+        if (!c_buffer) {
+            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
+                    const_wei_size_, p_engine_, g_alloc_);
+            convert_const_wei = true;
+        }
+    }
+
+    std::array<void *, n_stages> wei_ptrs {}, bias_ptrs {};
+    for (int s = 0; s < n_stages; s++) {
+        auto &stage = stages_[s];
+        wei_ptrs[s] = inputs[stage.wei_idx].get_data_handle();
+        if (stage.bias_idx != -1)
+            bias_ptrs[s] = inputs[stage.bias_idx].get_data_handle();
+        if (!stage.wei_reorder) continue;
+
+        memory user_wei(stage.user_wei_md, p_engine_, wei_ptrs[s]);
+        wei_ptrs[s] = (stage.is_constant ? c_buffer->data<char>() : scratch_ptr)
+                + stage.wei_offset;
+        if (stage.is_constant && !convert_const_wei) continue;
+        memory wei(stage.wei_md, p_engine_, wei_ptrs[s]);
+        stage.wei_reorder.execute(strm, user_wei, wei);
+    }
+    if (use_cache && convert_const_wei) c_promise.set_value(c_buffer);
+
+    const size_t dt_size = memory::data_type_size(dt_);
+    char *src = static_cast<char *>(inputs[src_idx_].get_data_handle());
+    char *dst = static_cast<char *>(outputs[0].get_data_handle());
+    const size_t buf1_offset = buf_size(buf0_size_);
+    const size_t prim_scratch_offset = buf1_offset + buf_size(buf1_size_);
+
+    const auto loop = [&](int tid, int nthr, dim_t n, dim_t t) {
+        const size_t k = tile_kind_idx_[t];
+        auto &args = res->args[tid][k];
+        char *thr_ptr = scratch_ptr + wei_size_ + tid * thr_size_;
+
+        const dim_t oh_s = t * oh_blk_;
+        const dim_t ih_s = std::max<dim_t>(0, oh_s * sh_ - t_pad_);
+        const std::array<void *, n_stages + 1> data_ptrs
+                = {src + (n * ih_ + ih_s) * iw_ * ic_ * dt_size, thr_ptr,
+                        thr_ptr + buf1_offset,
+                        dst + (n * oh_ + oh_s) * ow_ * oc_ * dt_size};
+
+        for (int s = 0; s < n_stages; s++) {
+            auto &stage_args = args[s];
+            stage_args.at(DNNL_ARG_SRC).set_data_handle(data_ptrs[s]);
+            stage_args.at(DNNL_ARG_WEIGHTS).set_data_handle(wei_ptrs[s]);
+            if (bias_ptrs[s])
+                stage_args.at(DNNL_ARG_BIAS).set_data_handle(bias_ptrs[s]);
+            stage_args.at(DNNL_ARG_DST).set_data_handle(data_ptrs[s + 1]);
+            stage_args.at(DNNL_ARG_SCRATCHPAD)
+                    .set_data_handle(thr_ptr + prim_scratch_offset);
+            if (s == project && with_residual_) {
+                stage_args.at(residual_arg_)
+                        .set_data_handle(
+                                src + (n * ih_ + oh_s) * iw_ * ic_ * dt_size);
+            }
+            // in parallel region - these primitives should use single thread.
+            tile_kinds_[k].prims[s].execute(strm, stage_args);
+        }
+    };
+    parallel_nd_ext(nthr_, mb_, n_tiles_, loop);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,214 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_INVERTED_BOTTLENECK_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_INVERTED_BOTTLENECK_DECOMP_HPP
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/thread_local_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Inverted bottleneck block of MobileNet-like models:
+//   1x1 expansion conv -> depthwise conv -> 1x1 projection conv [-> add src]
+// with optional bias and an activation after every convolution.
+//
+// Executing the block op by op writes the expanded tensors, which are several
+// times larger than the block input and output, to memory and reads them back.
+// Instead, the output rows are split into tiles and every thread runs the
+// three convolutions on a tile of a single image: the expansion conv produces
+// only the input rows the depthwise conv needs for the tile (including the
+// halo rows), so both expanded intermediates fit in the per-core L2 cache. The
+// halo rows are recomputed by the neighbouring tiles, so the tile height is
+// chosen to keep this overhead small.
+//
+// The convolutions are regular single-threaded primitives created for every
+// distinct tile shape (top, middle, bottom and tail tiles differ in the number
+// of rows and padding).
+//
+// The weights converted to the layout of the primitives are kept in the
+// constant cache when they are constant, otherwise they are converted on every
+// execution.
+struct inverted_bottleneck_decomp_kernel_t : public kernel_base_t {
+private:
+    enum { expand = 0, depthwise, project, n_stages };
+
+    // Parameters of a convolution of the block.
+    struct stage_t {
+        // Indices of the partition inputs, bias_idx is -1 when there is no
+        // bias.
+        int wei_idx = -1;
+        int bias_idx = -1;
+        algorithm eltwise_alg = algorithm::undef;
+        float alpha = 0.f, beta = 0.f;
+
+        memory::desc user_wei_md, wei_md, bias_md;
+        // Converts the user weights to wei_md, empty if they are the same.
+        reorder wei_reorder;
+        // The converted weights are kept in the constant buffer at
+        // wei_offset, otherwise they are placed in the scratchpad.
+        bool is_constant = false;
+        size_t wei_offset = 0;
+    };
+
+    // Primitives and execution args computing one tile of output rows.
+    struct tile_kind_t {
+        dim_t ih_rows = 0, oh_rows = 0, t_pad = 0, b_pad = 0;
+        std::array<primitive, n_stages> prims;
+        std::array<std::unordered_map<int, memory::desc>, n_stages> args_md;
+    };
+
+    allocator_t *g_alloc_ = nullptr;
+    int nthr_ = 1;
+
+    int src_idx_ = -1;
+    memory::data_type dt_ = memory::data_type::undef;
+    dim_t mb_ = 0, ih_ = 0, iw_ = 0, ic_ = 0, c_ = 0, oh_ = 0, ow_ = 0,
+          oc_ = 0;
+    dim_t kh_ = 0, kw_ = 0, sh_ = 0, sw_ = 0;
+    dim_t t_pad_ = 0, b_pad_ = 0, l_pad_ = 0, r_pad_ = 0;
+    bool with_residual_ = false;
+    // Execution arg of the residual post-op of the projection conv.
+    int residual_arg_ = 0;
+    std::array<stage_t, n_stages> stages_;
+
+    dim_t oh_blk_ = 0, n_tiles_ = 0;
+    std::vector<tile_kind_t> tile_kinds_;
+    // Index of the tile kind for every tile of an image.
+    std::vector<size_t> tile_kind_idx_;
+
+    // Scratchpad layout: converted non-constant weights followed by nthr_
+    // blocks of thr_size_ bytes with the intermediate buffers and the
+    // scratchpad of the primitives.
+    size_t wei_size_ = 0, thr_size_ = 0;
+    size_t buf0_size_ = 0, buf1_size_ = 0, prim_scratch_size_ = 0;
+    // Size of the converted constant weights.
+    size_t const_wei_size_ = 0;
+    size_t const_md_hash_ = 0;
+
+    status_t init_block(const dnnl_partition_impl_t *part,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs);
+    status_t init_tiles();
+    status_t create_primitives(const dnnl_partition_impl_t *part,
+            const std::vector<logical_tensor_t> &inputs);
+    status_t create_tile_kind(tile_kind_t &kind, const primitive_attr &attr,
+            bool any_weights);
+
+public:
+    inverted_bottleneck_decomp_kernel_t() {
+        thread_local_cache_t<args_set_t> res_cache;
+        res_cache.retain();
+    }
+
+    ~inverted_bottleneck_decomp_kernel_t() override {
+        thread_local_cache_t<args_set_t> res_cache;
+        res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
+        res_cache.release();
+    }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+    // Execution args of every thread, the data handles are set right before
+    // the execution of a tile.
+    class args_set_t {
+    public:
+        args_set_t(const inverted_bottleneck_decomp_kernel_t *kernel) {
+            args.resize(kernel->nthr_);
+            for (auto &thr_args : args) {
+                thr_args.resize(kernel->tile_kinds_.size());
+                for (size_t k = 0; k < kernel->tile_kinds_.size(); k++) {
+                    const auto &kind = kernel->tile_kinds_[k];
+                    for (int s = 0; s < n_stages; s++)
+                        for (const auto &arg : kind.args_md[s])
+                            thr_args[k][s].insert({arg.first,
+                                    memory(arg.second, kernel->p_engine_,
+                                            nullptr)});
+                }
+            }
+        }
+        // [thread][tile kind][stage]
+        std::vector<std::vector<
+                std::array<std::unordered_map<int, memory>, n_stages>>>
+                args;
+    };
+
+    std::function<std::shared_ptr<args_set_t>()> resource_ctor_;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(inverted_bottleneck_decomp_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(inverted_bottleneck_decomp_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -17,6 +17,8 @@
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 
+#include "cpu/cpu_stream.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace graph {
@@ -33,7 +35,19 @@ status_t kernel_base_t::compile(const dnnl_partition_impl_t *part,
 status_t kernel_base_t::execute(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs) {
-    return execute_impl(astream, inputs, outputs);
+    if (astream->engine()->kind() != engine_kind::cpu)
+        return execute_impl(astream, inputs, outputs);
+
+    // Kernels release temporary buffers and read intermediate results right
+    // after submitting the primitives, so the internal executions are kept
+    // synchronous on an out-of-order CPU stream.
+    auto *cpu_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(astream));
+    CHECK(cpu_stream->begin_sync_scope());
+    const status_t status = execute_impl(astream, inputs, outputs);
+    cpu_stream->end_sync_scope();
+    return status;
 }
 
 bool kernel_base_t::enabled_constant_cache() const {
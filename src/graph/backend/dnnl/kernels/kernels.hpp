@@ -26,6 +26,7 @@
 #include "graph/backend/dnnl/kernels/eltwise.hpp"
 #include "graph/backend/dnnl/kernels/gen_index.hpp"
 #include "graph/backend/dnnl/kernels/group_norm.hpp"
+#include "graph/backend/dnnl/kernels/inverted_bottleneck.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/kernels/layer_norm.hpp"
 #include "graph/backend/dnnl/kernels/log_softmax.hpp"
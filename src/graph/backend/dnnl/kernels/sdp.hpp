@@ -54,8 +54,10 @@ public:
         const engine_kind_t ekind = g_engine->kind();
         bool enable_decomp = false;
         bool enable_ukernel = false;
+        bool enable_cpu_prim = false;
 
         if (ekind == engine_kind::cpu) {
+            enable_cpu_prim = enable_cpu_primitive_kernel();
             enable_decomp = enable_decomp_kernel();
         } else if (ekind == engine_kind::gpu) {
             enable_ukernel = !force_primitive();
@@ -74,7 +76,7 @@ public:
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
 
-        if (ret != status::success && enable_ukernel) {
+        if (ret != status::success && (enable_ukernel || enable_cpu_prim)) {
             kernel = std::make_shared<sdp_primitive_kernel_t<quantized>>();
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
@@ -96,6 +98,23 @@ public:
         return ret;
     }
 
+    // It is used to check if enable the fused sdpa primitive on CPU. The
+    // primitive kernel is tried first and is used only if the sdpa primitive
+    // descriptor can be created for the partition, otherwise the
+    // decomposition kernel or the larger partition kernel is used. It is
+    // enabled when:
+    // - CPU runtime is not SYCL.
+    // - Primitive based implementation is not forced by the internal env var.
+    // - The pattern is not quantized, as the CPU sdpa primitive doesn't
+    //   support quantized keys and values.
+    bool enable_cpu_primitive_kernel() const {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+        return !quantized && !force_primitive();
+#else
+        return false;
+#endif
+    }
+
     // It is used to check if enable the decomposition kernel based on user's
     // env and params. Decomposition kernel is enabled when:
     // - CPU runtime is OMP or THREADPOOl.
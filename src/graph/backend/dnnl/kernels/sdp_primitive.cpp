@@ -182,28 +182,28 @@ status_t sdp_primitive_kernel_t<quantized>::get_prim_exec_args(
             status::runtime_error,
             "sdp_primitive_kernel get_prim_exec_args failed");
 
-    memory_arg_t mem_arg_q = {mem_storage[0].get(), true};
-    memory_arg_t mem_arg_k = {mem_storage[1].get(), true};
-    memory_arg_t mem_arg_v = {mem_storage[2].get(), true};
-    memory_arg_t mem_arg_dst = {mem_storage[3].get(), false};
-    memory_arg_t mem_arg_scale = {mem_storage[4].get(true), true};
-    memory_arg_t mem_arg_mask = {mem_storage[5].get(true), true};
-    memory_arg_t mem_arg_k_scale = {mem_storage[6].get(true), true};
-    memory_arg_t mem_arg_v_scale = {mem_storage[7].get(true), true};
-    memory_arg_t mem_arg_k_zero_points = {mem_storage[8].get(true), true};
-    memory_arg_t mem_arg_v_zero_points = {mem_storage[9].get(true), true};
-
+    // Optional arguments are passed only when they exist: CPU
+    // implementations access the memory of every passed argument.
     args.clear();
-    args[DNNL_ARG_QUERIES] = mem_arg_q;
-    args[DNNL_ARG_KEYS] = mem_arg_k;
-    args[DNNL_ARG_VALUES] = mem_arg_v;
-    args[DNNL_ARG_DST] = mem_arg_dst;
-    args[DNNL_ARG_SCALE] = mem_arg_scale;
-    args[DNNL_ARG_ATTN_MASK] = mem_arg_mask;
-    args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS] = mem_arg_k_scale;
-    args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES] = mem_arg_v_scale;
-    args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS] = mem_arg_k_zero_points;
-    args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES] = mem_arg_v_zero_points;
+    args[DNNL_ARG_QUERIES] = {mem_storage[0].get(), true};
+    args[DNNL_ARG_KEYS] = {mem_storage[1].get(), true};
+    args[DNNL_ARG_VALUES] = {mem_storage[2].get(), true};
+    args[DNNL_ARG_DST] = {mem_storage[3].get(), false};
+    if (cfg_.scale_) args[DNNL_ARG_SCALE] = {mem_storage[4].get(), true};
+    if (cfg_.attn_mask_)
+        args[DNNL_ARG_ATTN_MASK] = {mem_storage[5].get(), true};
+    if (cfg_.k_scale_)
+        args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS]
+                = {mem_storage[6].get(), true};
+    if (cfg_.v_scale_)
+        args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES]
+                = {mem_storage[7].get(), true};
+    if (cfg_.k_zero_points_)
+        args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS]
+                = {mem_storage[8].get(), true};
+    if (cfg_.v_zero_points_)
+        args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
+                = {mem_storage[9].get(), true};
 
     return status::success;
 }
@@ -218,9 +218,16 @@ status_t sdp_primitive_kernel_t<quantized>::execute_impl(
     execution_args_set_t *res = res_cache.get_or_add(
             reinterpret_cast<size_t>(this), resource_ctor_);
 
-    // Micro kernel doesn't use scratchpad memory, here we force-set size as
-    // zero to avoid redundant memory allocation and deallocation.
-    temporary_scratchpad_t scratchpad(0, p_engine_, *g_alloc_);
+    // Micro kernel doesn't use scratchpad memory while the CPU implementation
+    // keeps its per-thread buffers there. The primitive is executed directly,
+    // bypassing the primitive interface, so the scratchpad grantor is set up
+    // here.
+    const size_t scratchpad_size = static_cast<size_t>(
+            cfg_.sdpa_pd_->scratchpad_size(scratchpad_mode::user));
+    temporary_scratchpad_t scratchpad(scratchpad_size, p_engine_, *g_alloc_);
+    VCONDCHECK(graph, exec, check, sdp_primitive_kernel,
+            scratchpad.size() == scratchpad_size, status::out_of_memory,
+            "sdp_primitive_kernel failed to allocate scratchpad");
     prepare_args_set(res, inputs, outputs, scratchpad);
 
     memory mem_storage[10];
@@ -228,6 +235,19 @@ status_t sdp_primitive_kernel_t<quantized>::execute_impl(
     CHECK(get_prim_exec_args(args, mem_storage, res));
     exec_ctx_t ctx(p_stream.get(), std::move(args));
 
+    memory scratchpad_mem;
+    if (scratchpad_size > 0) {
+        scratchpad_mem = memory(
+                memory::desc({static_cast<memory::dim>(scratchpad_size)},
+                        memory::data_type::u8, memory::format_tag::a),
+                p_engine_, scratchpad.get_buffer());
+    }
+    auto grantor = cfg_.sdpa_pd_->scratchpad_registry().grantor(
+            scratchpad_size > 0 ? scratchpad_mem.get()->memory_storage()
+                                : nullptr,
+            ctx);
+    ctx.set_scratchpad_grantor(&grantor);
+
     return cfg_.sdpa_prim_->execute(ctx);
 }
 
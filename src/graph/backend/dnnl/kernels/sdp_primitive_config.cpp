@@ -126,10 +126,13 @@ status_t sdp_primitive_config_t::locate_io(std::shared_ptr<subgraph_t> &sg,
         if (k_follow->get_logical_tensor().id == t.id) {
             kv_head_number_ = t.dims[1];
         }
-    dst_ = (final_op->get_kind() == op_kind::dnnl_transpose)
-            ? final_op->get_input_value(0)
-            : final_op->get_output_value(
-                    0); /* for some reason final transpose is not fused into mm2 */
+    // Trailing transpose and reshape ops are not fused into mm2, but they
+    // alias its output, so the primitive writes to it directly.
+    dst_ = final_op->get_output_value(0);
+    while (dst_->has_producer()
+            && one_of(dst_->get_producer().get_kind(), op_kind::dnnl_transpose,
+                    op_kind::dnnl_reshape))
+        dst_ = dst_->get_producer().get_input_value(0);
 
     if (scale) {
         auto s0 = follow_back(scale->get_input_value(0));
@@ -172,7 +175,9 @@ status_t sdp_primitive_config_t::initial_check(
             "At least 3 inputs are required");
 
     // Ukernel doesn't support f32 datatype now
-    VCHECK_SDP_PRIMITIVE(inputs[0].data_type != dnnl_data_type_t::dnnl_f32,
+    VCHECK_SDP_PRIMITIVE(
+            sg->p_engine_->get_kind() != dnnl::engine::kind::gpu
+                    || inputs[0].data_type != dnnl_data_type_t::dnnl_f32,
             status::invalid_arguments,
             "SDPA ukernel doesn't support f32 datatype now");
 
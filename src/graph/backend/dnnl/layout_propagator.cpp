@@ -1757,6 +1757,69 @@ status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_rope(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    UNUSED(p_engine);
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    UNUSED(rewriter);
+    // The rotation is element-wise, so the destination follows the layout of
+    // the source.
+    auto src_md = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    value_ptr dst_val = op->get_output_value(0);
+    status_t status = fill_layout_info(dst_val, src_md);
+    return status;
+}
+
+status_t layout_propagator_for_embedding_bag(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    UNUSED(p_engine);
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    UNUSED(rewriter);
+    // The pooled rows are written as a plain {batch, dim} matrix.
+    value_ptr dst_val = op->get_output_value(0);
+    auto dst_md = make_dnnl_memory_desc(dst_val->get_logical_tensor());
+    if (dst_md.get_format_kind() == dnnl::memory::format_kind::any)
+        dst_md = dnnl::memory::desc(dst_md.get_dims(),
+                dst_md.get_data_type(), dnnl::memory::format_tag::ab);
+    status_t status = fill_layout_info(dst_val, dst_md);
+    return status;
+}
+
+status_t layout_propagator_for_top_k(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    UNUSED(rewriter);
+    // Values and indices are written in the plain layout.
+    for (size_t i = 0; i < 2; i++) {
+        value_ptr dst_val = op->get_output_value(i);
+        auto dst_md = make_dnnl_memory_desc(dst_val->get_logical_tensor());
+        if (dst_md.get_format_kind() == dnnl::memory::format_kind::any)
+            dst_md = to_ncx_format(dst_md);
+        status_t status = fill_layout_info(dst_val, dst_md);
+        if (status != status::success) return status;
+    }
+
+    // The scratchpad of the internal primitive is managed by the graph.
+    std::shared_ptr<primitive_desc_t> pd;
+    status_t status = top_k_executable_t::create_desc(op, p_engine, pd);
+    if (status != status::success) return status;
+    const dim_t scratchpad_size = pd->scratchpad_size(scratchpad_mode::user);
+    dnnl::memory::desc scratchpad_md;
+    if (scratchpad_size > 0)
+        scratchpad_md = dnnl::memory::desc({scratchpad_size},
+                dnnl::memory::data_type::u8, dnnl::memory::format_tag::a);
+    value_ptr scratchpad_val = op->get_output_value(2);
+    status = fill_layout_info(scratchpad_val, scratchpad_md);
+    return status;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
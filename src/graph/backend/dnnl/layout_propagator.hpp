@@ -94,6 +94,9 @@ DECLARE_LAYOUT_PROPAGATOR(groupnorm);
 DECLARE_LAYOUT_PROPAGATOR(gen_index);
 DECLARE_LAYOUT_PROPAGATOR(mask);
 DECLARE_LAYOUT_PROPAGATOR(sdpa);
+DECLARE_LAYOUT_PROPAGATOR(rope);
+DECLARE_LAYOUT_PROPAGATOR(embedding_bag);
+DECLARE_LAYOUT_PROPAGATOR(top_k);
 
 #undef DECLARE_LAYOUT_PROPAGATOR
 
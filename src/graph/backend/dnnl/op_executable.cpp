@@ -104,6 +104,17 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
                 = dw_conv->get_op()->get_input_value(0)->get_logical_tensor();
     }
     auto dst = make_dnnl_memory_desc(base_conv_dst_lt);
+    if (fusion_info.has_post_dw_conv()) {
+        // the fused away intermediate is not permuted together with the base
+        // conv, so convert it to ncx here if the data format is nxc
+        const auto dw_op = fusion_info.get_post_dw_conv()->get_op();
+        if (dw_op->has_attr(op_attr::data_format)
+                && dw_op->get_attr<std::string>(op_attr::data_format)
+                        == "NXC") {
+            const auto perm = get_permutation(dst.get_ndims(), "NXC", "NCX");
+            dst = dst.permute_axes(dnnl_impl::utils::cast_to_int32(perm));
+        }
+    }
     auto create_pd = [&](const dnnl::memory::desc &src_md,
                              const dnnl::memory::desc &dst_md) {
         if (op->has_attr(op_attr::with_bias)
@@ -758,11 +769,18 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     bool use_affine = true;
     if (op->has_attr(op_attr::use_affine))
         use_affine = op->get_attr<bool>(op_attr::use_affine);
+    const bool is_rms_norm = op->has_attr(op_attr::is_rms_norm)
+            && op->get_attr<bool>(op_attr::is_rms_norm);
 
     auto flags = dnnl::normalization_flags::none;
-    if (use_affine)
+    if (is_rms_norm) {
+        // RMS normalization has scale only
+        flags |= dnnl::normalization_flags::rms_norm;
+        if (use_affine) flags |= dnnl::normalization_flags::use_scale;
+    } else if (use_affine) {
         flags |= (dnnl::normalization_flags::use_scale
                 | dnnl::normalization_flags::use_shift);
+    }
 
     prop_kind pkind = keep_stats ? prop_kind::forward_training
                                  : prop_kind::forward_inference;
@@ -2275,7 +2293,11 @@ static arg_indices_t get_arg_indices_for_lnorm_and_gnorm(
     if (!op->has_attr(op_attr::use_affine)
             || op->get_attr<bool>(op_attr::use_affine)) {
         arg_indices.insert({DNNL_ARG_SCALE, indices_t {input, in_index++}});
-        arg_indices.insert({DNNL_ARG_SHIFT, indices_t {input, in_index++}});
+        const bool is_rms_norm = op->has_attr(op_attr::is_rms_norm)
+                && op->get_attr<bool>(op_attr::is_rms_norm);
+        if (!is_rms_norm)
+            arg_indices.insert(
+                    {DNNL_ARG_SHIFT, indices_t {input, in_index++}});
     }
 
     const fusion_info_t &fusion_info
@@ -2475,6 +2497,48 @@ arg_indices_t sdpa_executable_t::get_arg_indices(
     return arg_indices;
 }
 
+arg_indices_t rope_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_ROPE_COS, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_ROPE_SIN, indices_t {input, 2}});
+    if (op->num_inputs() > 3)
+        arg_indices.insert({DNNL_ARG_ROPE_POSITIONS, indices_t {input, 3}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    return arg_indices;
+}
+
+arg_indices_t embedding_bag_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_WEIGHTS, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_EMB_OFFSETS, indices_t {input, 2}});
+    if (op->num_inputs() > 3)
+        arg_indices.insert(
+                {DNNL_ARG_EMB_SAMPLE_WEIGHTS, indices_t {input, 3}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    return arg_indices;
+}
+
+arg_indices_t top_k_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_TOP_K_INDICES, indices_t {output, 1}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 2}});
+    return arg_indices;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
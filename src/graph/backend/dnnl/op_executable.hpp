@@ -25,7 +25,10 @@
 #include <unordered_map>
 
 #include "common/primitive.hpp"
+#include "common/embedding_bag_utils.hpp"
+#include "common/rope_utils.hpp"
 #include "common/sdpa_utils.hpp"
+#include "common/top_k_utils.hpp"
 
 #include "oneapi/dnnl/dnnl.hpp"
 #ifdef DNNL_WITH_SYCL
@@ -2883,6 +2886,309 @@ private:
     bool is_initialized_;
 };
 
+struct rope_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    rope_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache)
+        : with_positions_(op->num_inputs() > 3) {
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+
+        auto md_src = make_dnnl_memory_desc(
+                op->get_input_value(0)->get_logical_tensor());
+        auto md_cos = make_dnnl_memory_desc(
+                op->get_input_value(1)->get_logical_tensor());
+        auto md_sin = make_dnnl_memory_desc(
+                op->get_input_value(2)->get_logical_tensor());
+        dnnl::memory::desc md_positions;
+        if (with_positions_)
+            md_positions = make_dnnl_memory_desc(
+                    op->get_input_value(3)->get_logical_tensor());
+        auto md_dst = make_dnnl_memory_desc(
+                op->get_output_value(0)->get_logical_tensor());
+
+        const auto layout
+                = op->get_attr<std::string>(op_attr::mode) == "interleaved"
+                ? rope_layout_t::interleaved
+                : rope_layout_t::half_split;
+        status_t s = create_rope_pd(rope_pd_, p_engine.get(), md_src.get(),
+                md_cos.get(), md_sin.get(), md_positions.get(), md_dst.get(),
+                layout, nullptr);
+        if (s == status::success)
+            s = rope_pd_->create_primitive(rope_prim_, p_engine.get());
+        is_initialized_ = s == status::success;
+    }
+
+    bool is_initialized() const { return is_initialized_; }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        exec_ctx_t ctx(stream.get(), make_exec_args(args));
+        rope_prim_->execute(ctx);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto strm_t = stream.get();
+        exec_ctx_t ctx(strm_t, make_exec_args(args));
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+
+        if (!deps.empty()) sycl_stream_impl->sycl_ctx().set_deps(deps);
+
+        rope_prim_->execute(ctx);
+
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "rope opexecutable is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+private:
+    exec_args_t make_exec_args(
+            const std::unordered_map<int, memory> &args) const {
+        exec_args_t exec_args;
+        exec_args[DNNL_ARG_SRC] = {args.at(DNNL_ARG_SRC).get(), true};
+        exec_args[DNNL_ARG_ROPE_COS] = {args.at(DNNL_ARG_ROPE_COS).get(), true};
+        exec_args[DNNL_ARG_ROPE_SIN] = {args.at(DNNL_ARG_ROPE_SIN).get(), true};
+        if (with_positions_)
+            exec_args[DNNL_ARG_ROPE_POSITIONS]
+                    = {args.at(DNNL_ARG_ROPE_POSITIONS).get(), true};
+        exec_args[DNNL_ARG_DST] = {args.at(DNNL_ARG_DST).get(), false};
+        return exec_args;
+    }
+
+    std::shared_ptr<primitive_desc_t> rope_pd_;
+    std::shared_ptr<primitive_t> rope_prim_;
+    bool with_positions_;
+    bool is_initialized_;
+};
+
+struct embedding_bag_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    embedding_bag_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache)
+        : with_sample_weights_(op->num_inputs() > 3) {
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+
+        auto md_table = make_dnnl_memory_desc(
+                op->get_input_value(0)->get_logical_tensor());
+        auto md_indices = make_dnnl_memory_desc(
+                op->get_input_value(1)->get_logical_tensor());
+        auto md_offsets = make_dnnl_memory_desc(
+                op->get_input_value(2)->get_logical_tensor());
+        dnnl::memory::desc md_sample_weights;
+        if (with_sample_weights_)
+            md_sample_weights = make_dnnl_memory_desc(
+                    op->get_input_value(3)->get_logical_tensor());
+        auto md_dst = make_dnnl_memory_desc(
+                op->get_output_value(0)->get_logical_tensor());
+
+        const auto mode = op->get_attr<std::string>(op_attr::mode);
+        const auto alg = mode == "max" ? alg_kind::reduction_max
+                : mode == "mean"       ? alg_kind::reduction_mean
+                                       : alg_kind::reduction_sum;
+        status_t s = create_embedding_bag_pd(embedding_bag_pd_, p_engine.get(),
+                alg, md_indices.get(), md_offsets.get(), md_table.get(),
+                md_sample_weights.get(), md_dst.get(), nullptr);
+        if (s == status::success)
+            s = embedding_bag_pd_->create_primitive(
+                    embedding_bag_prim_, p_engine.get());
+        is_initialized_ = s == status::success;
+    }
+
+    bool is_initialized() const { return is_initialized_; }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        exec_ctx_t ctx(stream.get(), make_exec_args(args));
+        embedding_bag_prim_->execute(ctx);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto strm_t = stream.get();
+        exec_ctx_t ctx(strm_t, make_exec_args(args));
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+
+        if (!deps.empty()) sycl_stream_impl->sycl_ctx().set_deps(deps);
+
+        embedding_bag_prim_->execute(ctx);
+
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false,
+                "embedding bag opexecutable is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+private:
+    exec_args_t make_exec_args(
+            const std::unordered_map<int, memory> &args) const {
+        exec_args_t exec_args;
+        exec_args[DNNL_ARG_SRC] = {args.at(DNNL_ARG_SRC).get(), true};
+        exec_args[DNNL_ARG_EMB_OFFSETS]
+                = {args.at(DNNL_ARG_EMB_OFFSETS).get(), true};
+        exec_args[DNNL_ARG_WEIGHTS] = {args.at(DNNL_ARG_WEIGHTS).get(), true};
+        if (with_sample_weights_)
+            exec_args[DNNL_ARG_EMB_SAMPLE_WEIGHTS]
+                    = {args.at(DNNL_ARG_EMB_SAMPLE_WEIGHTS).get(), true};
+        exec_args[DNNL_ARG_DST] = {args.at(DNNL_ARG_DST).get(), false};
+        return exec_args;
+    }
+
+    std::shared_ptr<primitive_desc_t> embedding_bag_pd_;
+    std::shared_ptr<primitive_t> embedding_bag_prim_;
+    bool with_sample_weights_;
+    bool is_initialized_;
+};
+
+struct top_k_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    top_k_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+
+        status_t s = create_desc(op, p_engine, top_k_pd_);
+        if (s == status::success)
+            s = top_k_pd_->create_primitive(top_k_prim_, p_engine.get());
+        is_initialized_ = s == status::success;
+    }
+
+    // The scratchpad is provided by the graph, so the layout propagator uses
+    // the same descriptor to query its size.
+    static status_t create_desc(const std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine,
+            std::shared_ptr<primitive_desc_t> &top_k_pd) {
+        auto md_src = make_dnnl_memory_desc(
+                op->get_input_value(0)->get_logical_tensor());
+        auto md_values = make_dnnl_memory_desc(
+                op->get_output_value(0)->get_logical_tensor());
+        auto md_indices = make_dnnl_memory_desc(
+                op->get_output_value(1)->get_logical_tensor());
+
+        const auto axis = op->get_attr<int64_t>(op_attr::axis);
+        const auto k = op->get_attr<int64_t>(op_attr::k);
+        const auto alg = op->get_attr<std::string>(op_attr::mode) == "min"
+                ? alg_kind::reduction_min
+                : alg_kind::reduction_max;
+        dnnl::primitive_attr attr;
+        attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+        return create_top_k_pd(top_k_pd, p_engine.get(), alg, md_src.get(),
+                md_values.get(), md_indices.get(), static_cast<int>(axis), k,
+                attr.get());
+    }
+
+    bool is_initialized() const { return is_initialized_; }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        exec_ctx_t ctx(stream.get(), make_exec_args(args));
+        execute_impl(ctx, args);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto strm_t = stream.get();
+        exec_ctx_t ctx(strm_t, make_exec_args(args));
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+
+        if (!deps.empty()) sycl_stream_impl->sycl_ctx().set_deps(deps);
+
+        execute_impl(ctx, args);
+
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "top-k opexecutable is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+private:
+    exec_args_t make_exec_args(
+            const std::unordered_map<int, memory> &args) const {
+        exec_args_t exec_args;
+        exec_args[DNNL_ARG_SRC] = {args.at(DNNL_ARG_SRC).get(), true};
+        exec_args[DNNL_ARG_DST] = {args.at(DNNL_ARG_DST).get(), false};
+        exec_args[DNNL_ARG_TOP_K_INDICES]
+                = {args.at(DNNL_ARG_TOP_K_INDICES).get(), false};
+        return exec_args;
+    }
+
+    // The internal primitive is executed directly, bypassing the primitive
+    // interface, so the scratchpad grantor is set up here.
+    void execute_impl(exec_ctx_t &ctx,
+            const std::unordered_map<int, memory> &args) const {
+        auto it = args.find(DNNL_ARG_SCRATCHPAD);
+        const memory_storage_t *mem_storage = it != args.end()
+                ? it->second.get()->memory_storage()
+                : nullptr;
+        auto grantor = top_k_pd_->scratchpad_registry().grantor(
+                mem_storage, ctx);
+        ctx.set_scratchpad_grantor(&grantor);
+        top_k_prim_->execute(ctx);
+    }
+
+    std::shared_ptr<primitive_desc_t> top_k_pd_;
+    std::shared_ptr<primitive_t> top_k_prim_;
+    bool is_initialized_;
+};
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -71,6 +71,26 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
                     status::unimplemented,
                     "failed to create executable for op %s",
                     op->get_name().c_str());
+        } else if (cur_op->get_kind() == op_kind::dnnl_rope) {
+            auto rope_exec = std::dynamic_pointer_cast<rope_executable_t>(exec);
+            VCHECK_COMPILE_OPS(rope_exec->is_initialized(),
+                    status::unimplemented,
+                    "failed to create executable for op %s",
+                    op->get_name().c_str());
+        } else if (cur_op->get_kind() == op_kind::dnnl_embedding_bag) {
+            auto eb_exec = std::dynamic_pointer_cast<
+                    embedding_bag_executable_t>(exec);
+            VCHECK_COMPILE_OPS(eb_exec->is_initialized(),
+                    status::unimplemented,
+                    "failed to create executable for op %s",
+                    op->get_name().c_str());
+        } else if (cur_op->get_kind() == op_kind::dnnl_top_k) {
+            auto top_k_exec
+                    = std::dynamic_pointer_cast<top_k_executable_t>(exec);
+            VCHECK_COMPILE_OPS(top_k_exec->is_initialized(),
+                    status::unimplemented,
+                    "failed to create executable for op %s",
+                    op->get_name().c_str());
         }
         sg->execs_.emplace_back(exec);
 
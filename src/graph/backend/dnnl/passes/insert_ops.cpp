@@ -73,6 +73,10 @@ status_t insert_permute_for_conv_or_deconv(std::shared_ptr<subgraph_t> &sg) {
 
         size_t num_post_binary_ops = 0;
         size_t dw_conv_index = 2;
+        if (op->has_attr(op_attr::with_bias)
+                && op->get_attr<bool>(op_attr::with_bias)) {
+            dw_conv_index += 1;
+        }
         bool with_runtime_dst_scales = false;
         bool with_runtime_dst_points = false;
         const auto &pops = fusion_info.get_post_ops();
@@ -185,6 +185,20 @@ static status_t batchnorm_fwd_handler(
     return status::success;
 }
 
+static status_t rms_norm_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_layernorm);
+    new_op->set_attr<bool>(op_attr::is_rms_norm, true);
+    new_op->set_attr<bool>(op_attr::keep_stats, false);
+    // gamma is optional, there is no beta in RMS normalization
+    new_op->set_attr<bool>(op_attr::use_affine, op->num_inputs() > 1);
+    new_op->merge_attributes(op->get_attributes());
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 static status_t reduction_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     auto new_op = std::make_shared<op_t>(op_kind::dnnl_reduction);
@@ -713,6 +727,46 @@ static status_t gen_index_handler(
     return status::success;
 }
 
+static status_t rope_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_rope);
+    new_op->merge_attributes(op->get_attributes());
+    if (!new_op->has_attr(op_attr::mode))
+        new_op->set_attr<std::string>(op_attr::mode, "half_split");
+    rewriter.replace_op(op, new_op);
+    return status::success;
+}
+
+static status_t embedding_bag_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_embedding_bag);
+    new_op->merge_attributes(op->get_attributes());
+    if (!new_op->has_attr(op_attr::mode))
+        new_op->set_attr<std::string>(op_attr::mode, "sum");
+    rewriter.replace_op(op, new_op);
+    return status::success;
+}
+
+static status_t top_k_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_top_k);
+    new_op->merge_attributes(op->get_attributes());
+    if (!new_op->has_attr(op_attr::mode))
+        new_op->set_attr<std::string>(op_attr::mode, "max");
+    const int64_t ndims = static_cast<int64_t>(
+            ltw(op->get_input_value(0)->get_logical_tensor()).ndims());
+    const int64_t axis = new_op->has_attr(op_attr::axis)
+            ? new_op->get_attr<int64_t>(op_attr::axis)
+            : -1;
+    VCHECK_INVALID_ARGUMENT(axis >= -ndims && axis < ndims,
+            "TopK axis should be in range [-ndims, ndims) but got %d",
+            static_cast<int>(axis));
+    new_op->set_attr<int64_t>(op_attr::axis, axis < 0 ? axis + ndims : axis);
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 #define ITEM(kind, func) \
     { \
         graph::op_kind::kind, handler_func { (func) } \
@@ -806,8 +860,15 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // layernorm
         ITEM(LayerNorm, common_handler<op_kind::kDnnl_layernorm>),
         ITEM(LayerNormBackward, common_handler<op_kind::kDnnl_layernorm_bwd>),
+        ITEM(RMSNorm, rms_norm_handler),
         // groupnorm
         ITEM(GroupNorm, common_handler<op_kind::kDnnl_groupnorm>),
+        // rope
+        ITEM(RotaryEmbedding, rope_handler),
+        // embedding bag
+        ITEM(EmbeddingBag, embedding_bag_handler),
+        // top-k
+        ITEM(TopK, top_k_handler),
         // quantization
         ITEM(Quantize, static_quant_handler),
         ITEM(Dequantize, static_dequant_handler),
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "graph/backend/dnnl/kernels/inverted_bottleneck.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
@@ -352,6 +353,55 @@ pm::pb_op_t *identical_bottleneck_resblock(
     return dst2;
 };
 
+// Checks that the add takes the source of the inverted bottleneck block,
+// i.e. the source of the third convolution up the chain, as a residual.
+bool check_inverted_bottleneck_residual(op_t *op) {
+    for (size_t i = 0; i < 2; i++) {
+        const auto &residual = op->get_input_value(1 - i);
+        const value_t *val = op->get_input_value(i).get();
+        int n_convs = 0;
+        while (val->has_producer()) {
+            const op_t &producer = val->get_producer();
+            if (producer.get_kind() == graph::op_kind::Convolution
+                    && ++n_convs == 3) {
+                if (producer.get_input_value(0) == residual) return true;
+                break;
+            }
+            val = producer.get_input_value(0).get();
+        }
+    }
+
+    VCHECK_PATTERN_UTILS(false, false, "add is not a block residual");
+    return false;
+}
+
+// 1x1 expansion conv -> depthwise conv -> 1x1 projection conv. The
+// expansion and depthwise convolutions are followed by an activation.
+pm::pb_node_t *inverted_bottleneck(const std::shared_ptr<pb_graph_t> &pgraph) {
+    const std::vector<op_kind_t> activations = {graph::op_kind::ReLU,
+            graph::op_kind::Clamp, graph::op_kind::HardSwish};
+
+    pm::pb_op_t *expand = pgraph->append_op(graph::op_kind::Convolution);
+    expand->append_decision_function(check_grouped<false>);
+    expand->append_decision_function(check_conv_weight_size<1>);
+    auto expand_bias = optional_bias_add(pgraph, expand, false);
+    pm::pb_op_t *expand_act = pgraph->append_alternation(
+            activations, in_edges_t {in_edge(0, expand_bias, 0)});
+
+    pm::pb_op_t *depthwise = pgraph->append_op(graph::op_kind::Convolution,
+            in_edges_t {in_edge(0, expand_act, 0)});
+    depthwise->append_decision_function(check_grouped<true>);
+    auto depthwise_bias = optional_bias_add(pgraph, depthwise, false);
+    pm::pb_op_t *depthwise_act = pgraph->append_alternation(
+            activations, in_edges_t {in_edge(0, depthwise_bias, 0)});
+
+    pm::pb_op_t *project = pgraph->append_op(graph::op_kind::Convolution,
+            in_edges_t {in_edge(0, depthwise_act, 0)});
+    project->append_decision_function(check_grouped<false>);
+    project->append_decision_function(check_conv_weight_size<1>);
+    return optional_bias_add(pgraph, project, false);
+};
+
 } // namespace
 
 /*!
@@ -710,6 +760,31 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
             return std::make_shared<larger_partition_kernel_t>();
         });
 
+// Inverted bottleneck block of MobileNetV2-like models. The block is executed
+// by tiles of output rows, so that the expanded intermediate tensors stay in
+// cache.
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_inverted_bottleneck_fusion)
+        .set_priority(21.5f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::residual_conv_blocks)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_node_t *block = inverted_bottleneck(pgraph);
+                    pm::pb_op_t *add = pgraph->append_op(graph::op_kind::Add,
+                            in_edges_t {in_edge(0, block, 0)});
+                    add->append_decision_function(
+                            check_inverted_bottleneck_residual);
+                })
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    inverted_bottleneck(pgraph);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<inverted_bottleneck_base_t>();
+        });
+#endif
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022-2024 Intel Corporation
+* Copyright 2022-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -31,13 +31,49 @@ using in_edges_t = pm::in_edges_t;
 using pb_graph_t = pm::pb_graph_t;
 using FCreatePattern = graph::pass::FCreatePattern;
 
-//             LayerNorm
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+//        LayerNorm | RMSNorm
 //                 |
 //            [TypeCast]*
 //                 |
 // [unary/binary]*[0,MAX_REPETITION)
 //                 |
 //            [Quantize]*
+static void create_norm_post_ops_pattern(
+        const std::shared_ptr<pb_graph_t> &pgraph, graph::op_kind_t norm_kind) {
+    pm::pb_op_t *norm_base = pgraph->append_op(norm_kind);
+    norm_base->append_decision_function(
+            check_input_dtype_from_offset<impl::data_type::f32, 1>);
+    norm_base->append_decision_function(check_begin_norm_axis_attr);
+    // primitive only support 2-5D data tensor for layernorm
+    norm_base->append_decision_function(check_input_ndim_from_offset<0, 2, 5>);
+
+    // optional typecast
+    auto tc_graph = std::make_shared<pb_graph_t>();
+    pm::pb_op_t *ptypecast = tc_graph->append_op(graph::op_kind::TypeCast);
+    tc_graph->create_input_port(0, ptypecast, 0);
+    tc_graph->create_output_port(0, ptypecast, 0);
+    auto pre_tc = pgraph->append_optional(
+            tc_graph, in_edges_t {in_edge(0, norm_base, 0)});
+
+    // repetition(alternation(unary | binary))
+    auto alt_unary_binary = std::make_shared<pb_graph_t>();
+    auto palt = alt_unary_binary->append_alternation(get_unary_binary_ops());
+    palt->allow_internal_inputs();
+    alt_unary_binary->create_input_port(0, palt, 0);
+    alt_unary_binary->create_output_port(0, palt, 0);
+    auto prep = pgraph->append_repetition(alt_unary_binary, {0, 0}, 0,
+            MAX_REPETITION, in_edges_t {in_edge(0, pre_tc, 0)});
+
+    // optional quantize
+    auto q_graph = std::make_shared<pb_graph_t>();
+    pm::pb_op_t *pquantize = q_graph->append_op(graph::op_kind::Quantize);
+    q_graph->create_input_port(0, pquantize, 0);
+    q_graph->create_output_port(0, pquantize, 0);
+    pgraph->append_optional(q_graph, in_edges_t {in_edge(0, prep, 0)});
+}
+#endif
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(layernorm_fusion)
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -47,45 +83,21 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
         .set_engine_kind(engine_kind::cpu)
         .set_attr<FCreatePattern>("FCreatePattern",
                 [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
-                    pm::pb_op_t *layernorm_base
-                            = pgraph->append_op(graph::op_kind::LayerNorm);
-                    layernorm_base->append_decision_function(
-                            check_input_dtype_from_offset<impl::data_type::f32,
-                                    1>);
-                    layernorm_base->append_decision_function(
-                            check_begin_norm_axis_attr);
-                    // primitive only support 2-5D data tensor for layernorm
-                    layernorm_base->append_decision_function(
-                            check_input_ndim_from_offset<0, 2, 5>);
-
-                    // optional typecast
-                    auto tc_graph = std::make_shared<pb_graph_t>();
-                    pm::pb_op_t *ptypecast
-                            = tc_graph->append_op(graph::op_kind::TypeCast);
-                    tc_graph->create_input_port(0, ptypecast, 0);
-                    tc_graph->create_output_port(0, ptypecast, 0);
-                    auto pre_tc = pgraph->append_optional(tc_graph,
-                            in_edges_t {in_edge(0, layernorm_base, 0)});
-
-                    // repetition(alternation(unary | binary))
-                    auto alt_unary_binary = std::make_shared<pb_graph_t>();
-                    auto palt = alt_unary_binary->append_alternation(
-                            get_unary_binary_ops());
-                    palt->allow_internal_inputs();
-                    alt_unary_binary->create_input_port(0, palt, 0);
-                    alt_unary_binary->create_output_port(0, palt, 0);
-                    auto prep = pgraph->append_repetition(alt_unary_binary,
-                            {0, 0}, 0, MAX_REPETITION,
-                            in_edges_t {in_edge(0, pre_tc, 0)});
+                    create_norm_post_ops_pattern(
+                            pgraph, graph::op_kind::LayerNorm);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<layer_norm_fwd_t>();
+        });
 
-                    // optional quantize
-                    auto q_graph = std::make_shared<pb_graph_t>();
-                    pm::pb_op_t *pquantize
-                            = q_graph->append_op(graph::op_kind::Quantize);
-                    q_graph->create_input_port(0, pquantize, 0);
-                    q_graph->create_output_port(0, pquantize, 0);
-                    pgraph->append_optional(
-                            q_graph, in_edges_t {in_edge(0, prep, 0)});
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, rmsnorm_post_ops_fusion_cpu)
+        .set_priority(8.2f)
+        .set_kind(graph::partition_kind_t::misc_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    create_norm_post_ops_pattern(
+                            pgraph, graph::op_kind::RMSNorm);
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
             return std::make_shared<layer_norm_fwd_t>();
@@ -37,6 +37,57 @@
 
 using namespace dnnl::impl::graph;
 
+status_t temporary_arena_t::reset(void *base, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!blocks_.empty()) return status::invalid_arguments;
+    base_ = static_cast<char *>(base);
+    size_ = base ? size : 0;
+    return status::success;
+}
+
+void *temporary_arena_t::allocate(size_t size, size_t alignment) {
+    if (size == 0) return nullptr;
+    if (alignment == 0) alignment = 1;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!base_) return nullptr;
+
+    const auto base = reinterpret_cast<uintptr_t>(base_);
+    // Offset of the first properly aligned address at or after `offset`.
+    const auto align = [&](size_t offset) {
+        return utils::rnd_up(base + offset, alignment) - base;
+    };
+
+    size_t gap_begin = 0;
+    for (auto it = blocks_.begin();; ++it) {
+        const size_t gap_end = it == blocks_.end() ? size_ : it->begin;
+        const size_t begin = align(gap_begin);
+        if (begin <= gap_end && gap_end - begin >= size) {
+            blocks_.insert(it, {begin, begin + size});
+            return base_ + begin;
+        }
+        if (it == blocks_.end()) return nullptr;
+        gap_begin = it->end;
+    }
+}
+
+bool temporary_arena_t::deallocate(void *ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!base_) return false;
+
+    const auto p = static_cast<char *>(ptr);
+    if (p < base_ || p >= base_ + size_) return false;
+
+    const size_t offset = p - base_;
+    for (auto it = blocks_.begin(); it != blocks_.end(); ++it) {
+        if (it->begin != offset) continue;
+        blocks_.erase(it);
+        return true;
+    }
+    assert(!"buffer is not allocated from the arena");
+    return true;
+}
+
 status_t DNNL_API dnnl_graph_allocator_create(allocator_t **allocator,
         host_allocate_f host_malloc, host_deallocate_f host_free) {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
@@ -78,6 +129,12 @@ status_t DNNL_API dnnl_graph_allocator_destroy(allocator_t *allocator) {
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_allocator_set_temporary_arena(
+        allocator_t *allocator, void *arena, size_t size) {
+    if (allocator == nullptr) return status::invalid_arguments;
+    return allocator->temp_arena().reset(arena, size);
+}
+
 status_t DNNL_API dnnl_graph_make_engine_with_allocator(engine_t **engine,
         engine_kind_t kind, size_t index, const allocator_t *alloc) {
     auto ret = dnnl_engine_create(engine, kind, index);
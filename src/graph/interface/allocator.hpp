@@ -17,6 +17,10 @@
 #ifndef GRAPH_INTERFACE_ALLOCATOR_HPP
 #define GRAPH_INTERFACE_ALLOCATOR_HPP
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_graph.h"
 
 #include "graph/interface/c_types_map.hpp"
@@ -33,6 +37,40 @@
 #include "oneapi/dnnl/dnnl_graph_ocl.h"
 #endif
 
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+// A user-provided memory arena for temporary buffers. Buffers are placed at
+// the first gap between live buffers that fits them, so a buffer released by
+// one compiled partition is reused by the next one at the same offset.
+class temporary_arena_t {
+public:
+    // Returns `status::invalid_arguments` if the current arena is in use.
+    status_t reset(void *base, size_t size);
+
+    // Returns nullptr if the buffer does not fit into the arena.
+    void *allocate(size_t size, size_t alignment);
+    // Returns false if `ptr` does not belong to the arena.
+    bool deallocate(void *ptr);
+
+private:
+    struct block_t {
+        size_t begin;
+        size_t end;
+    };
+
+    char *base_ = nullptr;
+    size_t size_ = 0;
+    // Live buffers sorted by offset.
+    std::vector<block_t> blocks_;
+    std::mutex mutex_;
+};
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
 struct dnnl_graph_allocator {
 public:
     dnnl_graph_allocator() = default;
@@ -72,6 +110,10 @@ public:
     };
 
     void *allocate(size_t size, mem_attr_t attr = {}) const {
+        if (attr.type_ == mem_type_t::temp) {
+            void *buffer = temp_arena_->allocate(size, attr.alignment_);
+            if (buffer) return buffer;
+        }
         void *buffer = host_malloc_(size, attr.alignment_);
         return buffer;
     }
@@ -122,7 +164,11 @@ public:
 #endif
 
     void deallocate(void *buffer) const {
-        if (buffer) { host_free_(buffer); }
+        if (buffer && !temp_arena_->deallocate(buffer)) { host_free_(buffer); }
+    }
+
+    dnnl::impl::graph::temporary_arena_t &temp_arena() const {
+        return *temp_arena_;
     }
 
 #ifdef DNNL_WITH_SYCL
@@ -147,6 +193,10 @@ public:
 #endif
 
 private:
+    // Engines keep copies of the allocator, the arena is shared by them.
+    std::shared_ptr<dnnl::impl::graph::temporary_arena_t> temp_arena_ {
+            std::make_shared<dnnl::impl::graph::temporary_arena_t>()};
+
     dnnl_graph_host_allocate_f host_malloc_ {
             dnnl::impl::graph::utils::cpu_allocator_t::malloc};
     dnnl_graph_host_deallocate_f host_free_ {
@@ -399,6 +399,25 @@ DNNL_GRAPH_OP_SCHEMA(EluBackward, 1,
                         "T", {data_type::f32, data_type::bf16, data_type::f16})
                 .set_shape_inference_function(infer_identity_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(EmbeddingBag, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(1)
+                .set_input(0, "table", "T1")
+                .set_input(1, "indices", "T2")
+                .set_input(2, "offsets", "T2")
+                .set_input(3, "per_sample_weights", "T3")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::mode, false, attribute_kind::s, "sum",
+                        {"sum", "mean", "max"})
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::s32})
+                .set_type_constraints("T3", {data_type::f32})
+                .set_shape_inference_function(
+                        infer_embedding_bag_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(End, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -982,6 +1001,40 @@ DNNL_GRAPH_OP_SCHEMA(ReLUBackward, 1,
                         "T", {data_type::f32, data_type::bf16, data_type::f16})
                 .set_shape_inference_function(infer_identity_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(RMSNorm, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({1, 2}))
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "gamma", "T2")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::begin_norm_axis, false, attribute_kind::i,
+                        int64_t(-1))
+                .set_attr(op_attr::epsilon, false, attribute_kind::f, 1e-5f)
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::f32, data_type::bf16})
+                .set_shape_inference_function(infer_identity_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(RotaryEmbedding, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "cos", "T2")
+                .set_input(2, "sin", "T2")
+                .set_input(3, "positions", "T3")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::mode, false, attribute_kind::s, "half_split",
+                        {"half_split", "interleaved"})
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::f32})
+                .set_type_constraints("T3", {data_type::s32})
+                .set_shape_inference_function(infer_identity_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(Round, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -1164,6 +1217,22 @@ DNNL_GRAPH_OP_SCHEMA(TanhBackward, 1,
                         "T", {data_type::f32, data_type::bf16, data_type::f16})
                 .set_shape_inference_function(infer_identity_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(TopK, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(2)
+                .set_input(0, "src", "T1")
+                .set_output(0, "values", "T1")
+                .set_output(1, "indices", "T2")
+                .set_attr(op_attr::k, true, attribute_kind::i)
+                .set_attr(op_attr::axis, false, attribute_kind::i, (int64_t)-1)
+                .set_attr(op_attr::mode, false, attribute_kind::s, "max",
+                        {"max", "min"})
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::s32})
+                .set_shape_inference_function(infer_top_k_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(Wildcard, 1,
         op_schema_t()
                 .set_inputs_option(op_schema_t::param_num_option::variadic)
@@ -1735,6 +1735,73 @@ status_t infer_groupnorm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_embedding_bag_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto table = logical_tensor_wrapper_t(inputs[0]);
+    auto offsets = logical_tensor_wrapper_t(inputs[2]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    VCHECK_INVALID_SHAPE(table.ndims() == 2 && offsets.ndims() == 1,
+            "%s, table should be 2D and offsets should be 1D, got %d and %d",
+            op_t::kind2str(n->get_kind()).c_str(), table.ndims(),
+            offsets.ndims());
+
+    // The offsets hold the start of every bag and the end of the last one.
+    const dims table_dims = table.vdims();
+    const dims offsets_dims = offsets.vdims();
+    dims output_dims = {offsets_dims[0] - 1, table_dims[1]};
+
+    // check if output shape is already known
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(output_dims, out0.vdims()),
+                "%s, inferred output shape and shape from logical tensor are "
+                "not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
+status_t infer_top_k_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    const auto ndims = in0.ndims();
+    int64_t axis = n->get_attr<int64_t>(op_attr::axis);
+    const int64_t k = n->get_attr<int64_t>(op_attr::k);
+
+    VCHECK_INVALID_SHAPE(axis >= -ndims && axis < ndims,
+            "%s, axis %d is out of range [%d, %d)",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<int>(axis),
+            -ndims, ndims);
+    if (axis < 0) axis += ndims;
+
+    dims output_dims = in0.vdims();
+    const dim_t axis_dim = output_dims[static_cast<size_t>(axis)];
+    VCHECK_INVALID_SHAPE(k > 0 && (axis_dim < 0 || k <= axis_dim),
+            "%s, k (%d) should be in [1, %d]",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<int>(k),
+            static_cast<int>(axis_dim));
+    output_dims[static_cast<size_t>(axis)] = k;
+
+    // Values and indices have the same shape. Internal ops may have one more
+    // output for the scratchpad.
+    for (size_t i = 0; i < 2; i++) {
+        auto *out = outputs[i];
+        auto out_lt = logical_tensor_wrapper_t(out);
+        if (!out_lt.is_shape_unknown()) {
+            VCHECK_INVALID_SHAPE(validate(output_dims, out_lt.vdims()),
+                    "%s, inferred output shape and shape from logical tensor "
+                    "are not compatible",
+                    op_t::kind2str(n->get_kind()).c_str());
+        }
+        set_shape_and_strides(*out, output_dims);
+    }
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
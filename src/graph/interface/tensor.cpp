@@ -115,8 +115,8 @@ dnnl_graph_tensor::dnnl_graph_tensor(
     if (handle == DNNL_MEMORY_ALLOCATE) {
         size_t num_bytes = logical_tensor_wrapper_t(lt).size();
 
-        void *data
-                = tensor_malloc(num_bytes, eng, allocator_t::mem_type_t::temp);
+        void *data = tensor_malloc(
+                num_bytes, eng, allocator_t::mem_type_t::persistent);
         assertm(data, "Can't allocate memory for a tensor!");
         handle_.reset(data, [eng](void *p) { tensor_free(p, eng); });
     } else {
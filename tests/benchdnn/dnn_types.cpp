@@ -609,7 +609,7 @@ bool attr_t::is_def(bool skip_fpmath, bool skip_acc_mode) const {
             && IMPLICATION(
                     !skip_acc_mode, acc_mode == dnnl_accumulation_mode_strict)
             && rounding_mode.is_def() && deterministic.is_def()
-            && dropout.is_def();
+            && dropout.is_def() && src_dyn_quant.is_def();
 }
 
 int attr_t::post_ops_t::find(pk_t kind, int start, int stop) const {
@@ -810,6 +810,12 @@ std::ostream &operator<<(std::ostream &s, const attr_t::dropout_t &drop) {
     return s;
 }
 
+std::ostream &operator<<(
+        std::ostream &s, const attr_t::src_dyn_quant_t &sdq) {
+    s << sdq.dt;
+    return s;
+}
+
 std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
     if (!attr.is_def()) {
         if (!attr.scales.is_def()) s << "--attr-scales=" << attr.scales << " ";
@@ -829,6 +835,8 @@ std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
             s << "--attr-deterministic=" << attr.deterministic << " ";
         if (!attr.dropout.is_def())
             s << "--attr-dropout=" << attr.dropout << " ";
+        if (!attr.src_dyn_quant.is_def())
+            s << "--attr-src-dyn-quant=" << attr.src_dyn_quant << " ";
     }
     return s;
 }
@@ -1200,6 +1208,11 @@ dnnl_primitive_attr_t create_dnnl_attr(
         const auto &drop_mask_md = attr_args.get_md(DNNL_ARG_ATTR_DROPOUT_MASK);
         DNN_SAFE_V(dnnl_primitive_attr_set_dropout(dnnl_attr, drop_mask_md));
     }
+
+    if (!attr.src_dyn_quant.is_def()) {
+        DNN_SAFE_V(dnnl_primitive_attr_set_src_dynamic_quantization(
+                dnnl_attr, attr.src_dyn_quant.dt));
+    }
     return dnnl_attr;
 }
 
@@ -397,6 +397,11 @@ struct attr_t {
         bool is_def() const { return p == 0.f; }
     };
 
+    struct src_dyn_quant_t {
+        dnnl_data_type_t dt = dnnl_data_type_undef;
+        bool is_def() const { return dt == dnnl_data_type_undef; }
+    };
+
     attr_t()
         : scratchpad_mode(get_default_scratchpad_mode())
         , acc_mode(dnnl_accumulation_mode_strict) {}
@@ -416,6 +421,7 @@ struct attr_t {
     void insert(const deterministic_t &d) { this->deterministic = d; }
     void insert(const dropout_t &d) { this->dropout = d; }
     void insert(const rounding_mode_t &rm) { this->rounding_mode = rm; }
+    void insert(const src_dyn_quant_t &sdq) { this->src_dyn_quant = sdq; }
 
     // When parallel creation modifier is enabled, the library scratchpad mode
     // can't be used unless "-DDNNL_ENABLE_CONCURRENT_EXEC=ON" is enabled at the
@@ -437,6 +443,7 @@ struct attr_t {
     deterministic_t deterministic;
     dropout_t dropout;
     rounding_mode_t rounding_mode;
+    src_dyn_quant_t src_dyn_quant;
 
     bool is_def(bool skip_fpmath = false, bool skip_acc_mode = false) const;
 };
@@ -562,6 +569,8 @@ std::ostream &operator<<(std::ostream &s, const attr_t::fpmath_mode_t &fm);
 std::ostream &operator<<(std::ostream &s, dnnl_accumulation_mode_t am);
 std::ostream &operator<<(std::ostream &s, dnnl_rounding_mode_t rm);
 std::ostream &operator<<(std::ostream &s, const attr_t::dropout_t &drop);
+std::ostream &operator<<(
+        std::ostream &s, const attr_t::src_dyn_quant_t &sdq);
 std::ostream &operator<<(std::ostream &s, const attr_t &attr);
 
 // A container for additional data and info, not available from user's input at
@@ -19,11 +19,17 @@
 #include <list>
 #include <numeric>
 #include <string> // for std::string
+#include <thread> // for std::thread
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "oneapi/dnnl/dnnl_ocl.hpp"
@@ -269,6 +275,8 @@ memory_kind_ext_t memory_kind {default_memory_kind};
 
 int default_num_streams = 1;
 int num_streams = default_num_streams;
+int default_cores_per_stream = 0;
+int cores_per_stream = default_cores_per_stream;
 
 void init_isa_settings() {
     if (hints.get() == isa_hints_t::no_hints) {
@@ -606,6 +614,145 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     return OK;
 }
 
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
+// Pins the calling thread to `ncores` logical cores starting from `first`.
+// Threads spawned by the calling thread afterwards inherit the affinity.
+// The caller guarantees that the cores exist, so instances never share cores.
+static void bind_thread_to_cores(int first, int ncores) {
+#if defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int i = 0; i < ncores; i++)
+        CPU_SET(first + i, &cpu_set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set))
+        BENCHDNN_PRINT(0, "%s\n",
+                "WARNING: failed to bind a throughput instance to its cores.");
+#endif
+}
+
+// Returns the `q`-th quantile of `v` using the nearest-rank method.
+static double get_quantile(std::vector<double> v, double q) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    const size_t rank = (size_t)std::ceil(q * v.size());
+    return v[rank > 0 ? rank - 1 : 0];
+}
+
+// Runs a single instance of a throughput measurement. Latencies of every
+// execution are collected into `v_ms` to find their distribution.
+static int measure_perf_instance(timer::timer_t &t, std::vector<double> &v_ms,
+        dnnl_stream_t stream, perf_function_t &perf_func,
+        std::vector<dnnl_exec_arg_t> &dnnl_args) {
+    cold_cache_t cold_cache(dnnl_args, stream);
+
+    t.reset();
+    while (true) {
+        if (!cold_cache.update_dnnl_args(dnnl_args)) break;
+        const double ms_before = t.ms_[timer::timer_t::sum];
+        t.start();
+        DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+        t.stamp();
+        v_ms.push_back(t.ms_[timer::timer_t::sum] - ms_before);
+        if (should_stop(t)) break;
+    }
+    return OK;
+}
+#endif
+
+// Throughput mode: `num_streams` instances of a test object run concurrently,
+// each in its own thread, on its own stream and memory, and on its own subset
+// of `cores_per_stream` cores. It emulates serving scenarios in which several
+// independent instances share a machine.
+static int measure_perf_throughput(const thr_ctx_t &ctx, res_t *res,
+        const std::vector<stream_t> &v_stream, perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // The testing threadpool can't be shared by concurrent submissions.
+    BENCHDNN_PRINT(0, "%s\n",
+            "WARNING: throughput mode is not supported for threadpool "
+            "runtime, a single stream is used.");
+    return execute_in_thr_ctx(ctx, measure_perf_individual,
+            res->timer_map.perf_timer(), v_stream[0], perf_func, dnnl_args[0]);
+#else
+    const int nprocs = ctx.max_concurrency > 0
+            ? ctx.max_concurrency
+            : (int)std::thread::hardware_concurrency();
+    const int ncores = cores_per_stream > 0
+            ? cores_per_stream
+            : MAX2(1, nprocs / num_streams);
+    // Instances sharing cores would measure the oversubscription rather than
+    // the contention for shared resources.
+    if (nprocs > 0 && num_streams * ncores > nprocs) {
+        BENCHDNN_PRINT(0,
+                "Error: throughput mode requires %d cores (%d streams by %d "
+                "cores), but only %d are available.\n",
+                num_streams * ncores, num_streams, ncores, nprocs);
+        return FAIL;
+    }
+
+    thr_ctx_t inst_ctx = ctx;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_TBB_THREADING_WITH_CONSTRAINTS
+    inst_ctx.max_concurrency = ncores;
+#endif
+
+    auto &stats = res->throughput;
+    stats = throughput_stats_t();
+    stats.instances = num_streams;
+    stats.cores_per_instance = ncores;
+
+    // A single instance running alone on the same number of cores is the
+    // baseline to estimate the slowdown due to shared resources contention.
+    {
+        timer::timer_t t_solo;
+        std::vector<double> v_ms;
+        int st = OK;
+        std::thread solo([&]() {
+            bind_thread_to_cores(0, ncores);
+            st = execute_in_thr_ctx(inst_ctx, measure_perf_instance, t_solo,
+                    v_ms, v_stream[0], perf_func, dnnl_args[0]);
+        });
+        solo.join();
+        if (st != OK) return st;
+        stats.solo_p50_ms = get_quantile(v_ms, 0.5);
+    }
+
+    std::vector<timer::timer_t> v_t(num_streams);
+    std::vector<std::vector<double>> v_ms(num_streams);
+    std::vector<int> v_st(num_streams, OK);
+    std::vector<std::thread> v_thr;
+    for (int j = 0; j < num_streams; j++) {
+        v_thr.emplace_back([&, j]() {
+            bind_thread_to_cores(j * ncores, ncores);
+            v_st[j] = execute_in_thr_ctx(inst_ctx, measure_perf_instance,
+                    v_t[j], v_ms[j], v_stream[j], perf_func, dnnl_args[j]);
+        });
+    }
+    for (auto &thr : v_thr)
+        thr.join();
+
+    auto &t = res->timer_map.perf_timer();
+    t.reset();
+    for (int j = 0; j < num_streams; j++) {
+        if (v_st[j] != OK) return v_st[j];
+        for (double ms : v_ms[j])
+            t.stop(1, 0, ms);
+        stats.p50_ms.push_back(get_quantile(v_ms[j], 0.5));
+        stats.p99_ms.push_back(get_quantile(v_ms[j], 0.99));
+        const double sec = v_t[j].sec(timer::timer_t::sum);
+        if (sec > 0) stats.execs_per_sec += v_t[j].times() / sec;
+
+        BENCHDNN_PRINT(1,
+                "[THROUGHPUT] instance %d: cores=%d execs=%d p50=%gms "
+                "p99=%gms\n",
+                j, ncores, v_t[j].times(), stats.p50_ms.back(),
+                stats.p99_ms.back());
+    }
+
+    return OK;
+#endif
+}
+
 int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
         args_t &args) {
     if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
@@ -636,7 +783,10 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     // For DPCPP CPU and GPU: measure iterations in batches to hide driver
     // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     int ret = OK;
-    if (is_cpu() && !is_sycl_engine(engine)) {
+    if (is_cpu() && !is_sycl_engine(engine) && num_streams > 1) {
+        ret = measure_perf_throughput(
+                ctx, res, v_stream, perf_func, dnnl_args);
+    } else if (is_cpu() && !is_sycl_engine(engine)) {
         ret = execute_in_thr_ctx(ctx, measure_perf_individual, t, v_stream[0],
                 perf_func, dnnl_args[0]);
     } else {
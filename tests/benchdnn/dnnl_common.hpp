@@ -94,6 +94,8 @@ extern size_t engine_index;
 extern isa_hints_t hints;
 extern int default_num_streams;
 extern int num_streams;
+extern int default_cores_per_stream;
+extern int cores_per_stream;
 
 struct engine_t {
     engine_t(dnnl_engine_kind_t engine_kind);
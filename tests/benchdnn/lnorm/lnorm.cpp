@@ -56,7 +56,8 @@ int fill_mean(const prb_t *prb, const cfg_t &cfg, dnn_mem_t &mem_fp,
         const float val_coeff = is_integral_dt(prb->dt[0]) ? 1.f : 0.25f;
         float val = 0.f;
         // For zero channels the logic relies on memory filled with zeros.
-        if (prb->c > 0
+        // RMS normalization does not use the mean, it is zero by definition.
+        if (prb->c > 0 && !prb->skip_mean()
                 && (cfg.check_alg_ != ALG_0 || (prb->flags & GLOB_STATS))) {
             int64_t mean_val_shift = n % 7;
             // Bump mean for u8 to keep src values in non-negative range
@@ -462,6 +463,13 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
         res->reason = skip_reason::case_not_supported;
         return;
     }
+
+    if (is_gpu() && prb->skip_mean()) {
+        // GPU does not support RMS normalization
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
@@ -640,7 +648,7 @@ std::vector<data_kind_t> get_kinds_to_check(const prb_t *prb) {
 // even if the normalization layer worked correctly
 #if !(DNNL_AARCH64_USE_ACL)
         if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
-            check_kinds.push_back(MEAN);
+            if (!prb->skip_mean()) check_kinds.push_back(MEAN);
             check_kinds.push_back(VAR);
         }
 #endif
@@ -48,7 +48,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
             prb->ndims, dnnl_layer_normalization);
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
-        float smean = mean.get_elem(n);
+        float smean = prb->skip_mean() ? 0.f : mean.get_elem(n);
         float svar = var.get_elem(n);
         float sqrt_var = sqrtf(svar + prb->eps);
 
@@ -86,7 +86,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             float d_beta = 0;
 
             for (int64_t n = 0; n < prb->n; ++n) {
-                float smean = mean.get_elem(n);
+                float smean = prb->skip_mean() ? 0.f : mean.get_elem(n);
                 float svar = var.get_elem(n);
                 float rcp_denom = 1.f / sqrtf(svar + prb->eps);
                 auto off = n * prb->c + c;
@@ -101,7 +101,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
     }
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
-        float smean = mean.get_elem(n);
+        float smean = prb->skip_mean() ? 0.f : mean.get_elem(n);
         float svar = var.get_elem(n);
         float rcp_denom = 1.f / sqrtf(svar + prb->eps);
         float dd_gamma = 0, dd_gamma_x = 0;
@@ -111,7 +111,8 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
                 float ds = d_dst.get_elem(off);
                 const float x = src.get_elem(off) - smean;
                 float gamma = use_sc ? sc.get_elem(c) : 1;
-                dd_gamma += gamma * ds;
+                // The mean does not contribute to the gradient in RMS mode.
+                if (!prb->skip_mean()) dd_gamma += gamma * ds;
                 dd_gamma_x += gamma * ds * x;
             }
             dd_gamma_x *= rcp_denom;
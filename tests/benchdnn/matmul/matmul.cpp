@@ -523,6 +523,22 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
         return;
     }
 
+    if (!prb->attr.src_dyn_quant.is_def()) {
+        // The attribute is not supported on GPU and on processors with
+        // Intel AMX.
+        const auto amx = static_cast<unsigned>(dnnl_cpu_isa_avx512_core_amx);
+        const auto isa = static_cast<unsigned>(dnnl_get_effective_cpu_isa());
+        if (is_gpu() || (isa & amx) == amx) {
+            BENCHDNN_PRINT(2,
+                    "[SKIP][%s:%d]: Source dynamic quantization is supported "
+                    "on CPU without Intel AMX only.\n",
+                    __FILE__, __LINE__);
+            res->state = SKIPPED;
+            res->reason = skip_reason::case_not_supported;
+            return;
+        }
+    }
+
     if (is_cpu()) {
         const bool is_x8s8f16
                 = prb->wei_dt() == dnnl_s8 && prb->dst_dt() == dnnl_f16;
@@ -538,7 +554,8 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
             return dnnl::impl::utils::one_of(
                     t, dnnl_s4, dnnl_u4, dnnl_s8, dnnl_u8, dnnl_s32);
         };
-        if (is_int(prb->src_dt()) != is_int(prb->wei_dt())) {
+        if (is_int(prb->src_dt()) != is_int(prb->wei_dt())
+                && prb->attr.src_dyn_quant.is_def()) {
             BENCHDNN_PRINT(2,
                     "[SKIP][%s:%d]: CPU doesn't support mixed integer and "
                     "floating point source and weights.\n",
@@ -647,6 +664,28 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
+    if (!prb->attr.src_dyn_quant.is_def()) {
+        auto is_float = [](dnnl_data_type_t t) {
+            return dnnl::impl::utils::one_of(t, dnnl_f32, dnnl_bf16, dnnl_f16);
+        };
+        const bool wei_scales_ok = prb->attr.scales.is_def(DNNL_ARG_WEIGHTS)
+                || prb->attr.scales.get(DNNL_ARG_WEIGHTS).groups.empty();
+        if (!is_float(prb->src_dt()) || prb->wei_dt() != dnnl_s8
+                || !is_float(prb->dst_dt())
+                || !prb->attr.scales.is_def(DNNL_ARG_SRC)
+                || !prb->attr.zero_points.is_def() || !wei_scales_ok) {
+            BENCHDNN_PRINT(2,
+                    "[INVALID][%s:%d]: Source dynamic quantization requires "
+                    "floating-point source and destination, s8 weights, no "
+                    "zero-points, no source scales and no grouped weights "
+                    "scales.\n",
+                    __FILE__, __LINE__);
+            res->state = SKIPPED;
+            res->reason = skip_reason::invalid_case;
+            return;
+        }
+    }
+
     if (!prb->attr.zero_points.is_def()
             && (prb->wei_dt() != dnnl_s8 && prb->wei_dt() != dnnl_u8
                     && prb->wei_dt() != dnnl_s4 && prb->wei_dt() != dnnl_u4)) {
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cmath>
 
 #include "utils/parallel.hpp"
 
@@ -65,6 +66,10 @@ void compute_ref_matmul(const prb_t *prb, const args_t &args) {
     const int dst_scale_mask = prb->attr.scales.get_mask(
             DNNL_ARG_DST, dnnl_matmul, dst_m.ndims());
 
+    // With source dynamic quantization, every row of the source is quantized
+    // into s8 with its own scale and the integer result is scaled back.
+    const bool has_src_dyn_quant = !prb->attr.src_dyn_quant.is_def();
+
     const bool has_src_single_scale = has_src_scale && src_scale_mask == 0;
     const bool has_wei_single_scale = has_wei_scale && wei_scale_mask == 0;
 
@@ -134,7 +139,33 @@ void compute_ref_matmul(const prb_t *prb, const args_t &args) {
         float src_scale = has_src_single_scale ? src_scales.get_elem(0) : 1.f;
         float wei_scale = has_wei_single_scale ? wei_scales.get_elem(0) : 1.f;
 
-        for (int64_t gK = 0; gK < n_k_groups; gK++) {
+        if (has_src_dyn_quant) {
+            float abs_max = 0.f;
+            for (int64_t k = 0; k < K; ++k) {
+                const auto src_off = src_off_f(prb, src_mb, m, k);
+                abs_max = std::max(abs_max, std::fabs(src_m.get_elem(src_off)));
+            }
+            float scale = abs_max / 127.f, inv_scale = 127.f / abs_max;
+            if (!(abs_max > 0.f) || std::isinf(inv_scale))
+                scale = inv_scale = 1.f;
+
+            for (int64_t k = 0; k < K; ++k) {
+                const auto src_off = src_off_f(prb, src_mb, m, k);
+                const auto wei_off = wei_ba_off_f(prb, wei_mb, k, n);
+                const float s = std::nearbyint(std::min(127.f,
+                        std::max(-128.f, src_m.get_elem(src_off) * inv_scale)));
+                dst += s * wei_m.get_elem(wei_off);
+            }
+            if (has_wei_scale && !has_wei_single_scale) {
+                const auto wei_scale_idx
+                        = wei_m.get_idx(wei_ab_off_f(prb, wei_mb, 0, n),
+                                wei_scale_mask, wei_m.ndims());
+                wei_scale = wei_scales.get_elem(wei_scale_idx);
+            }
+            dst *= scale * wei_scale;
+        }
+
+        for (int64_t gK = 0; gK < n_k_groups && !has_src_dyn_quant; gK++) {
             const auto src_gK_off
                     = src_off_f(prb, src_mb, m, gK * smallest_k_group);
             // Note: scales/zero-points are still always in `tag::abx` format.
@@ -131,7 +131,8 @@ static const std::string help_with_projection
 
 static const std::string help_flags
         = "FLAGS    (Default: not specified)\n    Specifies rnn flags. `FLAGS` "
-          "values are:\n    * `O` for diff_weights_overwrite.\n";
+          "values are:\n    * `O` for diff_weights_overwrite.\n    * `V` for "
+          "variable_length.\n";
 
 int bench(int argc, char **argv) {
     driver_name = "rnn";
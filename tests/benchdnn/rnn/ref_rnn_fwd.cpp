@@ -17,6 +17,7 @@
 #include <stdlib.h>
 
 #include <cmath>
+#include <vector>
 
 #include "rnn/rnn.hpp"
 #include "rnn/rnn_aux.hpp"
@@ -122,8 +123,9 @@ void prepare_bias(
 
 void copy_init_fwd(const prb_t &prb, const AOC<float> &ws_src_layer,
         const AOC<float> &ws_src_iter, const AOC<float> &ws_src_iter_c,
-        const args_t &args, rnn_iter_direction_t iter_dir,
-        rnn_layer_direction_t lay_dir, int64_t dir_val) {
+        const args_t &args, const std::vector<int64_t> &seq_lengths,
+        rnn_iter_direction_t iter_dir, rnn_layer_direction_t lay_dir,
+        int64_t dir_val) {
     const dnn_mem_t &src_layer_ = args.find(DNNL_ARG_SRC_LAYER);
     const dnn_mem_t &src_iter_ = args.find(DNNL_ARG_SRC_ITER);
     const dnn_mem_t &src_iter_c_ = args.find(DNNL_ARG_SRC_ITER_C);
@@ -137,13 +139,21 @@ void copy_init_fwd(const prb_t &prb, const AOC<float> &ws_src_layer,
     int64_t lay_dest = (lay_dir == bottom2top) ? 0 : prb.n_layer + 1;
     int64_t it_dest = (iter_dir == left2right) ? 0 : prb.n_iter + 1;
 
-    // Copy src_layer
-    for (int64_t it = 0; it < prb.n_iter; it++) {
-        copy(prb.mb, prb.slc, prb.slc, prb.wc, &src_layer(it, 0),
-                &ws_src_layer(lay_dest, dir_val, it + 1, 0, 0));
+    // Copy src_layer. Variable-length sequences are aligned to the end of
+    // the workspace for right-to-left direction, so that every sequence
+    // starts from its last element.
+    for_(int64_t it = 0; it < prb.n_iter; it++)
+    for (int64_t nb = 0; nb < prb.mb; nb++) {
+        const int64_t len = seq_lengths[nb];
+        if (it >= len) continue;
+        const int64_t ws_it = iter_dir == right2left
+                ? it + 1 + prb.n_iter - len
+                : it + 1;
+        copy(1, prb.slc, prb.slc, prb.wc, &src_layer(it, nb * prb.slc),
+                &ws_src_layer(lay_dest, dir_val, ws_it, nb, 0));
         if (prb.is_int8())
-            data_q10n(prb.mb, prb.slc, prb.wc,
-                    &ws_src_layer(lay_dest, dir_val, it + 1, 0, 0),
+            data_q10n(1, prb.slc, prb.wc,
+                    &ws_src_layer(lay_dest, dir_val, ws_it, nb, 0),
                     prb.data_scale, prb.data_shift);
     }
 
@@ -165,7 +175,8 @@ void copy_init_fwd(const prb_t &prb, const AOC<float> &ws_src_layer,
 void copy_res_fwd(const prb_t &prb, const args_t &args,
         const AOC<const float> &ws_src_layer,
         const AOC<const float> &ws_src_iter,
-        const AOC<const float> &ws_src_iter_c, rnn_iter_direction_t iter_dir,
+        const AOC<const float> &ws_src_iter_c,
+        const std::vector<int64_t> &seq_lengths, rnn_iter_direction_t iter_dir,
         rnn_layer_direction_t lay_dir, int64_t dir_val, rnn_action_t action) {
     const dnn_mem_t &dst_layer_ = args.find(DNNL_ARG_DST_LAYER);
     const dnn_mem_t &dst_iter_ = args.find(DNNL_ARG_DST_ITER);
@@ -179,12 +190,26 @@ void copy_res_fwd(const prb_t &prb, const args_t &args,
             || (prb.is_s8() && prb.cfg[DST_LAYER].dt != dnnl_s8);
     const bool is_iter_deq = (prb.is_u8() && prb.cfg[DST_ITER].dt != dnnl_u8)
             || (prb.is_s8() && prb.cfg[DST_ITER].dt != dnnl_s8);
+    // Outputs past the end of a variable-length sequence are zeros.
+    const float pad_val = prb.is_int8() && !is_layer_deq
+            ? maybe_saturate(prb.cfg[DST_LAYER].dt, prb.data_shift)
+            : 0.f;
+
     // Copy dst_layer
     for (int64_t it = 0; it < prb.n_iter; it++) {
         for (int64_t nb = 0; nb < prb.mb; nb++) {
-            auto from = &ws_src_layer(prb.n_layer, dir_val, it + 1, nb, 0);
+            const int64_t len = seq_lengths[nb];
             auto to = &dst_layer(
                     it, nb, action == action_concat ? prb.dlc(CELL) : 0);
+            if (it >= len) {
+                for (int64_t c = 0; c < prb.dlc(CELL); c++)
+                    to[c] = pad_val;
+                continue;
+            }
+            const int64_t ws_it = iter_dir == right2left
+                    ? it + 1 + prb.n_iter - len
+                    : it + 1;
+            auto from = &ws_src_layer(prb.n_layer, dir_val, ws_it, nb, 0);
             copy(1, prb.dlc(CELL), prb.wc, prb.dlc(PRIMITIVE), from, to, action,
                     prb.is_int8());
 
@@ -207,19 +232,23 @@ void copy_res_fwd(const prb_t &prb, const args_t &args,
         }
     }
 
-    int64_t it_source = (iter_dir == left2right) ? prb.n_iter : 1;
-
     // Copy dst_iter (and dst_iter_c)
-    for (int64_t lay = 0; lay < prb.n_layer; lay++) {
+    for_(int64_t lay = 0; lay < prb.n_layer; lay++)
+    for (int64_t nb = 0; nb < prb.mb; nb++) {
+        const int64_t it_source = (iter_dir == left2right)
+                ? seq_lengths[nb]
+                : prb.n_iter - seq_lengths[nb] + 1;
         if (prb.alg == VANILLA_LSTM) {
-            copy(prb.mb, prb.dhc, prb.wc, prb.dhc,
-                    &ws_src_iter_c(lay + 1, dir_val, it_source, 0, 0),
-                    &dst_iter_c(lay, dir_val, 0, 0));
+            copy(1, prb.dhc, prb.wc, prb.dhc,
+                    &ws_src_iter_c(lay + 1, dir_val, it_source, nb, 0),
+                    &dst_iter_c(lay, dir_val, nb, 0));
         }
 
-        copy(prb.mb, prb.dic, prb.wc, prb.dic,
-                &ws_src_iter(lay + 1, dir_val, it_source, 0, 0),
-                &dst_iter(lay, dir_val, 0, 0));
+        copy(1, prb.dic, prb.wc, prb.dic,
+                &ws_src_iter(lay + 1, dir_val, it_source, nb, 0),
+                &dst_iter(lay, dir_val, nb, 0));
+    }
+    for (int64_t lay = 0; lay < prb.n_layer; lay++) {
         if (is_iter_deq)
             data_deq10n(prb.mb, prb.dic, prb.dic, &dst_iter(lay, dir_val, 0, 0),
                     prb.data_scale, prb.data_shift);
@@ -322,6 +351,13 @@ void rnn_linear_fwd(const prb_t &prb, const args_t &args,
         cell_scratchpad_[i] = NAN;
     }
 
+    const dnn_mem_t &seq_lengths_ = args.find(DNNL_ARG_SRC_LAYER_LENGTHS);
+    std::vector<int64_t> seq_lengths(prb.mb, prb.n_iter);
+    if (prb.flags & VARIABLE_LENGTH) {
+        for (int64_t nb = 0; nb < prb.mb; nb++)
+            seq_lengths[nb] = static_cast<int64_t>(seq_lengths_.get_elem(nb));
+    }
+
     auto process_direction = [&](rnn_iter_direction_t iter_dir,
                                      rnn_layer_direction_t lay_dir,
                                      int64_t dir_val, rnn_action_t action) {
@@ -330,7 +366,7 @@ void rnn_linear_fwd(const prb_t &prb, const args_t &args,
         BENCHDNN_PRINT(80,
                 "rnn_linear_fwd: call copy_init dir_val = " IFMT "\n", dir_val);
         copy_init_fwd(prb, ws_src_layer, ws_src_iter, ws_src_iter_c, args,
-                iter_dir, lay_dir, dir_val);
+                seq_lengths, iter_dir, lay_dir, dir_val);
 
         // We run the grid of computation
         for (int64_t il = 0; il < prb.n_layer; il++) {
@@ -366,7 +402,7 @@ void rnn_linear_fwd(const prb_t &prb, const args_t &args,
 
         // Finally we copy the results to the result buffers
         copy_res_fwd(prb, args, ws_src_layer, ws_src_iter, ws_src_iter_c,
-                iter_dir, lay_dir, dir_val, action);
+                seq_lengths, iter_dir, lay_dir, dir_val, action);
     };
 
     switch (prb.direction) {
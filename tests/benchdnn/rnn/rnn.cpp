@@ -481,6 +481,20 @@ int fill_weights(const prb_t &prb, rnn_data_kind_t kind, dnn_mem_t &mem_dt,
     return OK;
 }
 
+// Lengths of variable-length sequences. They are not sorted to check that the
+// library handles an arbitrary order; the first sequence is always full.
+int fill_seq_lengths(const prb_t &prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    const auto nelems = mem_dt.nelems();
+    if (nelems == 0) return OK;
+
+    for (int64_t b = 0; b < nelems; b++)
+        mem_fp.set_elem(b, prb.n_iter - (b * 3) % prb.n_iter);
+
+    SAFE(mem_dt.reorder(mem_fp), WARN);
+
+    return OK;
+}
+
 // To reduce likelihood of cancellation happening in bwd by bias,
 // (especially for GRU), we want diff_bias to be sparse
 int fill_bias(const prb_t &prb, rnn_data_kind_t kind, dnn_mem_t &mem_dt,
@@ -949,6 +963,13 @@ void skip_invalid_prb(const prb_t *prb_, res_t *res) {
         return;
     }
 
+    // Variable-length sequences are supported for forward propagation only.
+    if ((prb.flags & VARIABLE_LENGTH) && prb.prop == dnnl_backward) {
+        res->state = SKIPPED;
+        res->reason = skip_reason::invalid_case;
+        return;
+    }
+
     // Non-trivial strides modify existing strides, when the tag is defined.
     // With tag::any, strides are not defined.
     if (!prb.trivial_strides
@@ -1032,6 +1053,7 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
 std::vector<int> supported_exec_args(dir_t dir) {
     static const std::vector<int> exec_fwd_args = {
             DNNL_ARG_SRC_LAYER,
+            DNNL_ARG_SRC_LAYER_LENGTHS,
             DNNL_ARG_AUGRU_ATTENTION,
             DNNL_ARG_SRC_ITER,
             DNNL_ARG_SRC_ITER_C,
@@ -1110,6 +1132,9 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
                 SAFE(fill_activation(prb, SRC_LAYER, mem, ref_mem, rnn_attr),
                         WARN);
                 break;
+            case DNNL_ARG_SRC_LAYER_LENGTHS:
+                SAFE(fill_seq_lengths(prb, mem, ref_mem), WARN);
+                break;
             case DNNL_ARG_AUGRU_ATTENTION:
                 SAFE(fill_activation(
                              prb, AUGRU_ATTENTION, mem, ref_mem, rnn_attr),
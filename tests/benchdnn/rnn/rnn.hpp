@@ -98,6 +98,7 @@ using flags_t = unsigned;
 // XXX: UNDEF is used in activation_t
 const flags_t NONE = dnnl_rnn_flags_undef;
 const flags_t DIFF_WEIGHTS_OVERWRITE = dnnl_rnn_flags_diff_weights_overwrite;
+const flags_t VARIABLE_LENGTH = dnnl_rnn_flags_variable_length;
 flags_t str2flags(const char *str);
 std::string flags2str(flags_t flags);
 
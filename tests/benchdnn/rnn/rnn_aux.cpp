@@ -117,6 +117,8 @@ flags_t str2flags(const char *str) {
     while (str && *str) {
         if (*str == 'O')
             flags |= DIFF_WEIGHTS_OVERWRITE;
+        else if (*str == 'V')
+            flags |= VARIABLE_LENGTH;
         else {
             BENCHDNN_PRINT(0, "%s\n", "Error: unsupported flags value.");
         }
@@ -128,6 +130,7 @@ flags_t str2flags(const char *str) {
 std::string flags2str(flags_t flags) {
     std::string str;
     if (flags & DIFF_WEIGHTS_OVERWRITE) str += "O";
+    if (flags & VARIABLE_LENGTH) str += "V";
     return str;
 }
 
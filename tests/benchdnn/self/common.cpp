@@ -301,6 +301,15 @@ static int check_attr() {
         SELF_CHECK_CASE_STR_EQ(d[0].tag.c_str(), tag::any);
     }
 
+    {
+        base_settings_t s;
+        std::vector<attr_t::src_dyn_quant_t> &sdq = s.src_dyn_quant;
+        std::string content_to_parse("--attr-src-dyn-quant=s8");
+        auto st = parse_attributes(s, def, content_to_parse.c_str());
+        SELF_CHECK_EQ(st, true);
+        SELF_CHECK_EQ(sdq[0].dt, dnnl_s8);
+    }
+
     {
         base_settings_t s;
         std::vector<attr_t::rounding_mode_t> &rm = s.rounding_mode;
@@ -340,6 +340,20 @@ attr_t::dropout_t parse_attr_dropout_func(const std::string &s) {
     return v;
 }
 
+attr_t::src_dyn_quant_t parse_attr_src_dyn_quant_func(const std::string &s) {
+    attr_t::src_dyn_quant_t v;
+    if (s.empty()) return v;
+
+    v.dt = str2dt(s.c_str());
+    if (v.dt != dnnl_s8) {
+        BENCHDNN_PRINT(0, "%s \'%s\' %s\n",
+                "Error: source dynamic quantization data type", s.c_str(),
+                "is not supported.");
+        SAFE_V(FAIL);
+    }
+    return v;
+}
+
 bool parse_impl_filter(impl_filter_t &impl_filter,
         const impl_filter_t &def_impl_filter, bool use_impl, const char *str,
         const std::string &option_name, const std::string &help) {
@@ -669,6 +683,21 @@ bool parse_attr_dropout(std::vector<attr_t::dropout_t> &dropout,
             parser_utils::parse_attr_dropout_func, str, option_name, help);
 }
 
+bool parse_attr_src_dyn_quant(
+        std::vector<attr_t::src_dyn_quant_t> &src_dyn_quant,
+        const std::vector<attr_t::src_dyn_quant_t> &def_src_dyn_quant,
+        const char *str,
+        const std::string &option_name = "attr-src-dyn-quant") {
+    static const std::string help
+            = "DT    (Default: not specified)\n    Specifies source dynamic "
+              "quantization attribute. `DT` value can be `s8`.\n    More "
+              "details at "
+            + doc_url + "knobs_attr.md\n";
+    return parse_vector_option(src_dyn_quant, def_src_dyn_quant,
+            parser_utils::parse_attr_src_dyn_quant_func, str, option_name,
+            help);
+}
+
 bool parse_attr_acc_mode(std::vector<dnnl_accumulation_mode_t> &acc_mode,
         const std::vector<dnnl_accumulation_mode_t> &def_acc_mode,
         const char *str, const std::string &option_name = "attr-acc-mode") {
@@ -704,7 +733,9 @@ bool parse_attributes(
             || parse_attr_fpmath_mode(s.fpmath_mode, def.fpmath_mode, str)
             || parse_attr_acc_mode(s.acc_mode, def.acc_mode, str)
             || parse_attr_deterministic(s.deterministic, def.deterministic, str)
-            || parse_attr_rounding_mode(s.rounding_mode, str);
+            || parse_attr_rounding_mode(s.rounding_mode, str)
+            || parse_attr_src_dyn_quant(
+                    s.src_dyn_quant, def.src_dyn_quant, str);
     return parsed_attrs;
 }
 
@@ -1002,6 +1033,25 @@ static bool parse_cold_cache(
             option_name, help);
 }
 
+static bool parse_cores_per_stream(
+        const char *str, const std::string &option_name = "cores-per-stream") {
+    static const std::string help
+            = "N    (Default: `0`)\n    Specifies the number `N` of cores "
+              "used by every stream in CPU throughput mode.\n    `0` splits "
+              "all available cores evenly between the streams.\n";
+    bool parsed = parse_single_value_option(cores_per_stream,
+            default_cores_per_stream, parser_utils::stoll_safe, str,
+            option_name, help);
+    if (parsed) {
+        if (cores_per_stream < 0) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "Error: number of cores per stream must be non-negative.");
+            SAFE_V(FAIL);
+        }
+    }
+    return parsed;
+}
+
 static bool parse_cpu_isa_hints(
         const char *str, const std::string &option_name = "cpu-isa-hints") {
     static const std::string help
@@ -1191,7 +1241,7 @@ static bool parse_num_streams(
     static const std::string help
             = "N    (Default: `1`)\n    Specifies the number `N` of streams "
               "used for performance benchmarking.\n    `N` is a positive "
-              "integer.\n";
+              "integer. On CPU, `N > 1` enables throughput mode.\n";
     bool parsed = parse_single_value_option(num_streams, default_num_streams,
             parser_utils::stoll_safe, str, option_name, help);
     if (parsed) {
@@ -1467,7 +1517,8 @@ bool parse_bench_settings(const char *str) {
     bool parsed = parse_allow_enum_tags_only(str)
             || parse_attr_same_pd_check(str) || parse_canonical(str)
             || parse_check_ref_impl(str) || parse_cold_cache(str)
-            || parse_cpu_isa_hints(str) || parse_engine(str)
+            || parse_cores_per_stream(str) || parse_cpu_isa_hints(str)
+            || parse_engine(str)
             || parse_fast_ref(str) || parse_fix_times_per_prb(str)
             || parse_global_impl(str) || parse_global_skip_impl(str)
             || parse_max_ms_per_prb(str) || parse_num_streams(str)
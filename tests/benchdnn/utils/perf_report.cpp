@@ -92,6 +92,24 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return t.ms(create_mode) / unit;
     };
 
+    // Throughput mode statistics. Latencies are reported for the slowest
+    // instance.
+    const auto &tput = res->throughput;
+    auto get_worst_ms = [&](const std::vector<double> &v_ms) -> double {
+        double worst = 0;
+        for (double ms : v_ms)
+            worst = MAX2(worst, ms);
+        return worst / unit;
+    };
+
+    auto get_contention = [&]() -> double {
+        if (tput.p50_ms.empty() || !tput.solo_p50_ms) return 0;
+        double sum = 0;
+        for (double ms : tput.p50_ms)
+            sum += ms;
+        return sum / tput.p50_ms.size() / tput.solo_p50_ms;
+    };
+
     // Please update doc/knobs_perf_report.md in case of any new options!
 
 #define HANDLE(opt, ...) \
@@ -147,6 +165,12 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
                             + get_create_time(res->timer_map.cpd_timer()));
     HANDLE("cptime", s << get_create_time(res->timer_map.cp_timer()));
     HANDLE("cpdtime", s << get_create_time(res->timer_map.cpd_timer()));
+    HANDLE("tput", s << tput.execs_per_sec / unit);
+    HANDLE("tflops", s << ops() * tput.execs_per_sec / unit);
+    HANDLE("tbw", s << (res->ibytes + res->obytes) * tput.execs_per_sec / unit);
+    HANDLE("p50", s << get_worst_ms(tput.p50_ms));
+    HANDLE("p99", s << get_worst_ms(tput.p99_ms));
+    HANDLE("contention", s << get_contention());
 
 #undef HANDLE
 
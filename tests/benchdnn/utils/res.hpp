@@ -94,6 +94,19 @@ struct check_mem_size_args_t {
     size_t scratchpad_size = 0;
 };
 
+// Statistics of the throughput mode, when several instances of a test object
+// run concurrently on separate streams and cores (see `--num-streams`).
+struct throughput_stats_t {
+    int instances = 0;
+    int cores_per_instance = 0;
+    // Aggregated number of executions per second over all instances.
+    double execs_per_sec = 0;
+    // Latency percentiles of every instance in milliseconds.
+    std::vector<double> p50_ms, p99_ms;
+    // Median latency of a single instance running alone in milliseconds.
+    double solo_p50_ms = 0;
+};
+
 struct res_t {
     res_state_t state;
     size_t errors, total;
@@ -104,6 +117,7 @@ struct res_t {
     // TODO: fuse `ibytes` and `obytes` into `mem_size_args`.
     size_t ibytes, obytes;
     check_mem_size_args_t mem_size_args;
+    throughput_stats_t throughput;
 };
 
 #endif
@@ -31,7 +31,8 @@ struct base_settings_t {
                 const std::vector<dnnl_accumulation_mode_t> &acc_mode,
                 const std::vector<attr_t::deterministic_t> &deterministic,
                 const std::vector<attr_t::dropout_t> &dropout,
-                const std::vector<attr_t::rounding_mode_t> &rounding_mode) {
+                const std::vector<attr_t::rounding_mode_t> &rounding_mode,
+                const std::vector<attr_t::src_dyn_quant_t> &src_dyn_quant) {
             for_(const auto &s : scales)
             for_(const auto &zp : zero_points)
             for_(const auto &po : post_ops)
@@ -40,8 +41,10 @@ struct base_settings_t {
             for_(const auto &am : acc_mode)
             for_(const auto &d : deterministic)
             for_(const auto &dr : dropout)
-            for (const auto &rm : rounding_mode)
-                attrs_.push_back(get_attr(s, zp, po, sm, fm, am, d, dr, rm));
+            for_(const auto &rm : rounding_mode)
+            for (const auto &sdq : src_dyn_quant)
+                attrs_.push_back(
+                        get_attr(s, zp, po, sm, fm, am, d, dr, rm, sdq));
         }
 
         using vector_type = std::vector<attr_t>;
@@ -92,6 +95,8 @@ struct base_settings_t {
     std::vector<attr_t::dropout_t> dropout {attr_t::dropout_t()};
     std::vector<attr_t::rounding_mode_t> rounding_mode {
             attr_t::rounding_mode_t()};
+    std::vector<attr_t::src_dyn_quant_t> src_dyn_quant {
+            attr_t::src_dyn_quant_t()};
     std::vector<thr_ctx_t> ctx_init {default_thr_ctx};
     std::vector<thr_ctx_t> ctx_exe {default_thr_ctx};
     impl_filter_t impl_filter;
@@ -126,7 +131,8 @@ struct base_settings_t {
     virtual void finalize() {
         attributes.clear();
         attributes.init(scales, zero_points, post_ops, scratchpad_mode,
-                fpmath_mode, acc_mode, deterministic, dropout, rounding_mode);
+                fpmath_mode, acc_mode, deterministic, dropout, rounding_mode,
+                src_dyn_quant);
     }
 };
 
@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <thread>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class exec_stats_test_t : public ::testing::Test {
+protected:
+    void TearDown() override { set_exec_stats(false); }
+
+    static const exec_stats_entry *find_entry(
+            const std::vector<exec_stats_entry> &entries,
+            primitive::kind kind) {
+        for (const auto &e : entries)
+            if (e.kind == kind) return &e;
+        return nullptr;
+    }
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(exec_stats_test_t, TestCounters) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "CPU engine is not found.");
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    memory::desc md({2, 3, 4, 5}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+    fill_data<float>(md.get_size() / sizeof(float), src);
+
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward eltwise(pd);
+    auto execute = [&]() {
+        eltwise.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        s.wait();
+    };
+
+    execute();
+    ASSERT_EQ(find_entry(get_exec_stats(), primitive::kind::eltwise), nullptr);
+
+    set_exec_stats(true);
+    ASSERT_TRUE(get_exec_stats_enabled());
+    int enabled = 0;
+    ASSERT_EQ(dnnl_get_exec_stats_enabled(&enabled), dnnl_success);
+    ASSERT_EQ(enabled, 1);
+    ASSERT_EQ(dnnl_get_exec_stats_enabled(nullptr), dnnl_invalid_arguments);
+    get_exec_stats(/* reset = */ true);
+
+    // Executions of exited threads must not be lost.
+    for (int i = 0; i < 3; i++)
+        execute();
+    std::thread t([&]() {
+        for (int i = 0; i < 2; i++)
+            execute();
+    });
+    t.join();
+
+    const size_t nbytes = 2 * md.get_size();
+    for (bool reset : {false, true}) {
+        auto entries = get_exec_stats(reset);
+        auto *e = find_entry(entries, primitive::kind::eltwise);
+        ASSERT_NE(e, nullptr);
+        EXPECT_EQ(e->count, 5u);
+        EXPECT_EQ(e->bytes, 5 * nbytes);
+        EXPECT_EQ(e->impl_name, std::string(pd.impl_info_str()));
+        EXPECT_NE(e->info.find(e->impl_name), std::string::npos);
+        EXPECT_LE(e->min_ms, e->max_ms);
+        EXPECT_LE(e->max_ms, e->total_ms);
+    }
+    ASSERT_EQ(find_entry(get_exec_stats(), primitive::kind::eltwise), nullptr);
+
+    set_exec_stats(false);
+    execute();
+    ASSERT_EQ(find_entry(get_exec_stats(), primitive::kind::eltwise), nullptr);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(exec_stats_test_t, TestDestroyedPrimitives) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "CPU engine is not found.");
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    memory::desc md({2, 3, 4, 5}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+    fill_data<float>(md.get_size() / sizeof(float), src);
+
+    set_exec_stats(true);
+    get_exec_stats(/* reset = */ true);
+
+    // The counters of destroyed primitives must be kept.
+    for (int i = 0; i < 3; i++) {
+        auto pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f);
+        eltwise_forward(pd).execute(
+                s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        s.wait();
+    }
+
+    auto entries = get_exec_stats(/* reset = */ true);
+    auto *e = find_entry(entries, primitive::kind::eltwise);
+    ASSERT_NE(e, nullptr);
+    EXPECT_EQ(e->count, 3u);
+}
+
+} // namespace dnnl
@@ -18,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl.hpp"
 
 #include <tuple>
 
@@ -29,10 +30,6 @@ static bool are_valid_flags(
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     if (engine_kind == dnnl_gpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
-#endif
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
-    if (engine_kind == dnnl_cpu && (stream_flags & dnnl_stream_out_of_order))
-        ok = false;
 #endif
     return ok;
 }
@@ -137,6 +134,54 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, CpuOutOfOrderExecution) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::out_of_order);
+
+    const memory::dim n = 1024;
+    const int nsteps = 16;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_linear, md, md, 1.f, 1.f);
+    auto add_one = eltwise_forward(pd);
+
+    // Chain the executions through two buffers so that every step depends on
+    // the previous one.
+    memory bufs[2] = {memory(md, eng), memory(md, eng)};
+    float *ptr = static_cast<float *>(bufs[0].get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        ptr[i] = (float)i;
+    for (int step = 0; step < nsteps; step++)
+        add_one.execute(s,
+                {{DNNL_ARG_SRC, bufs[step % 2]},
+                        {DNNL_ARG_DST, bufs[(step + 1) % 2]}});
+
+    // Mapping waits for the executions using the memory.
+    float *res = bufs[nsteps % 2].map_data<float>();
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(res[i], (float)(i + nsteps));
+    bufs[nsteps % 2].unmap_data(res);
+    s.wait();
+
+    // Memory objects released right after the submission stay alive until
+    // the execution completes.
+    memory out(md, eng);
+    {
+        memory in(md, eng);
+        float *in_ptr = static_cast<float *>(in.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            in_ptr[i] = 1.f;
+        add_one.execute(s, {{DNNL_ARG_SRC, in}, {DNNL_ARG_DST, out}});
+    }
+    s.wait();
+    const float *out_ptr = static_cast<const float *>(out.get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        ASSERT_EQ(out_ptr[i], 2.f);
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
@@ -116,6 +116,10 @@ TEST(APIOp, CreateAllOps) {
             op::kind::GroupNorm,
             op::kind::GenIndex,
             op::kind::GreaterEqual,
+            op::kind::RMSNorm,
+            op::kind::RotaryEmbedding,
+            op::kind::EmbeddingBag,
+            op::kind::TopK,
     };
     // clang-format on
 
@@ -390,3 +390,80 @@ TEST(APIPartition, F8MatmulPartition) {
         parts[0].compile({deq0_src, deq1_src}, {mm_dst}, eng);
     }
 }
+
+TEST(APIPartition, OutOfOrderCpuStream) {
+    SKIP_IF(api_test_engine_kind != dnnl_cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case for non-CPU engines and SYCL CPU runtime");
+
+    using namespace dnnl::graph;
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+
+    const std::vector<int64_t> src_dims {2, 14, 14, 32};
+    const std::vector<int64_t> wei_dims {3, 3, 32, 64};
+    const std::vector<int64_t> dst_dims {2, 14, 14, 64};
+
+    // User layouts differ from the ones preferred by the convolution, so the
+    // partition reorders the inputs into internal temporary buffers.
+    logical_tensor src {0, logical_tensor::data_type::f32, src_dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, wei_dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {2, logical_tensor::data_type::f32, dst_dims,
+            logical_tensor::layout_type::strided};
+
+    op conv(0, op::kind::Convolution, "conv");
+    conv.set_attr<std::vector<int64_t>>(op::attr::strides, {1, 1});
+    conv.set_attr<std::vector<int64_t>>(op::attr::pads_begin, {1, 1});
+    conv.set_attr<std::vector<int64_t>>(op::attr::pads_end, {1, 1});
+    conv.set_attr<std::vector<int64_t>>(op::attr::dilations, {1, 1});
+    conv.set_attr<std::string>(op::attr::data_format, "NXC");
+    conv.set_attr<std::string>(op::attr::weights_format, "XIO");
+    conv.set_attr<int64_t>(op::attr::groups, 1);
+    conv.add_inputs({src, wei});
+    conv.add_output(dst);
+
+    partition part {conv, dnnl::engine::kind::cpu};
+    auto cp = part.compile({src, wei}, {dst}, eng);
+
+    std::vector<float> src_data(product(src_dims));
+    std::vector<float> wei_data(product(wei_dims));
+    for (size_t i = 0; i < src_data.size(); i++)
+        src_data[i] = static_cast<float>(i % 13) - 6.f;
+    for (size_t i = 0; i < wei_data.size(); i++)
+        wei_data[i] = static_cast<float>(i % 7) / 7.f - 0.5f;
+
+    std::vector<float> ref_data(product(dst_dims));
+    dnnl::stream in_order_strm(eng);
+    cp.execute(in_order_strm, {tensor(src, eng, src_data.data()),
+                                      tensor(wei, eng, wei_data.data())},
+            {tensor(dst, eng, ref_data.data())});
+    in_order_strm.wait();
+
+    // The source is produced by a primitive submitted to the same stream
+    // right before the partition: the partition waits for it and completes
+    // before returning.
+    dnnl::stream strm(eng, dnnl::stream::flags::out_of_order);
+    dnnl::memory::desc md({product(src_dims)}, dnnl::memory::data_type::f32,
+            dnnl::memory::format_tag::a);
+    dnnl::memory user_src_mem(md, eng, src_data.data());
+    dnnl::memory src_mem(md, eng);
+    auto copy_pd = dnnl::eltwise_forward::primitive_desc(eng,
+            dnnl::prop_kind::forward_inference,
+            dnnl::algorithm::eltwise_linear, md, md, 1.f, 0.f);
+    dnnl::eltwise_forward copy(copy_pd);
+
+    for (int iter = 0; iter < 4; iter++) {
+        copy.execute(strm,
+                {{DNNL_ARG_SRC, user_src_mem}, {DNNL_ARG_DST, src_mem}});
+
+        std::vector<float> dst_data(product(dst_dims), 0.f);
+        cp.execute(strm,
+                {tensor(src, eng, src_mem.get_data_handle()),
+                        tensor(wei, eng, wei_data.data())},
+                {tensor(dst, eng, dst_data.data())});
+        for (size_t i = 0; i < dst_data.size(); i++)
+            ASSERT_EQ(dst_data[i], ref_data[i]) << "index " << i;
+    }
+    strm.wait();
+}
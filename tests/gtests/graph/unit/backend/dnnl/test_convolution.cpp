@@ -2778,6 +2778,107 @@ TEST(test_convolution_execute_subgraph_fp32, ConvDepthwise_CPU) {
     }
 }
 
+TEST(test_convolution_execute_subgraph_fp32, ConvBiasDepthwiseNxc_CPU) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // Odd spatial sizes make the output of the stride 2 depthwise conv round
+    // up.
+    const int64_t N = 2, IC = 8, C = 16, H = 5, W = 7;
+    std::vector<int64_t> conv_src_shape {N, H, W, IC};
+    std::vector<int64_t> conv_wei_shape {1, 1, IC, C};
+    std::vector<int64_t> conv_bias_shape {C};
+    std::vector<int64_t> conv_dst_shape {N, H, W, C};
+    std::vector<int64_t> dw_wei_shape {3, 3, 1, C};
+
+    for_(const std::string dw_type : {"k3s1p1", "k3s2p1"})
+    for (bool with_bias : {false, true}) {
+        const int64_t stride = dw_type == "k3s1p1" ? 1 : 2;
+        std::vector<int64_t> dw_dst_shape {
+                N, (H + stride - 1) / stride, (W + stride - 1) / stride, C};
+
+        graph::op_t conv {0, graph::op_kind::Convolution, "conv"};
+        utils::set_conv_common_attr(conv);
+        graph::op_t depthwise {1, graph::op_kind::Convolution, "depthwise"};
+        utils::set_conv_common_attr(depthwise, {stride, stride}, {1, 1},
+                {1, 1}, {1, 1}, "None", "NXC", "XIO", C);
+
+        graph::logical_tensor_t conv_src = utils::logical_tensor_init(
+                0, conv_src_shape, graph::data_type::f32);
+        graph::logical_tensor_t conv_wei = utils::logical_tensor_init(
+                1, conv_wei_shape, graph::data_type::f32);
+        graph::logical_tensor_t conv_bias = utils::logical_tensor_init(
+                2, conv_bias_shape, graph::data_type::f32);
+        graph::logical_tensor_t conv_dst = utils::logical_tensor_init(
+                3, conv_dst_shape, graph::data_type::f32);
+        graph::logical_tensor_t dw_wei = utils::logical_tensor_init(
+                4, dw_wei_shape, graph::data_type::f32);
+        graph::logical_tensor_t dw_dst = utils::logical_tensor_init(
+                5, dw_dst_shape, graph::data_type::f32);
+
+        conv.add_input(conv_src);
+        conv.add_input(conv_wei);
+        if (with_bias) conv.add_input(conv_bias);
+        conv.add_output(conv_dst);
+        depthwise.add_input(conv_dst);
+        depthwise.add_input(dw_wei);
+        depthwise.add_output(dw_dst);
+
+        graph::graph_t g(engine->kind());
+        g.add_op(&conv);
+        g.add_op(&depthwise);
+        g.finalize();
+
+        std::vector<test_tensor_t> inputs_ts;
+        for (const auto &lt : {conv_src, conv_wei, dw_wei, conv_bias}) {
+            if (lt.id == conv_bias.id && !with_bias) continue;
+            inputs_ts.emplace_back(lt, engine);
+            inputs_ts.back().fill<float>(0.f, 1.f);
+        }
+        std::vector<test_tensor_t> ref_outputs_ts {
+                test_tensor_t(dw_dst, engine)};
+        ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *engine, *strm),
+                graph::status::success);
+
+        graph::pass::pass_base_ptr apass
+                = get_pass("fp_conv_postops_depthwise_postops_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+
+        graph::partition_t p;
+        p.init(part);
+        graph::compiled_partition_t cp(p);
+
+        // The destination shape is inferred by the library.
+        graph::logical_tensor_t dw_dst_any = utils::logical_tensor_init(
+                dw_dst.id, graph::data_type::f32, graph::layout_type::strided);
+        std::vector<const graph::logical_tensor_t *> lt_ins {
+                &conv_src, &conv_wei, &dw_wei};
+        if (with_bias) lt_ins.push_back(&conv_bias);
+        std::vector<const graph::logical_tensor_t *> lt_outs {&dw_dst_any};
+        ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine),
+                graph::status::success);
+
+        graph::logical_tensor_t compiled_dst;
+        cp.query_logical_tensor(dw_dst.id, &compiled_dst);
+        ASSERT_EQ(graph::logical_tensor_wrapper_t(compiled_dst).vdims(),
+                dw_dst_shape);
+
+        std::vector<test_tensor_t> outputs_ts {
+                test_tensor_t(compiled_dst, engine)};
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+        ASSERT_TRUE(allclose<float>(outputs_ts[0], ref_outputs_ts[0],
+                /*rtol*/ 1e-5f, /*atol*/ 1e-5f));
+    }
+}
+
 TEST(test_convolution_execute_subgraph_int8, Conv1dConv2dConv3d) {
     using dims = graph::dnnl_impl::dims;
 
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+TEST(test_embedding_bag_execute, EmbeddingBagSumWithWeights) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "EmbeddingBag is not supported on gpu");
+
+    // 4 rows of 2 elements, 3 bags, the second bag is empty.
+    std::vector<float> table {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+    std::vector<int32_t> indices {0, 2, 1, 3, 3};
+    std::vector<int32_t> offsets {0, 2, 2, 5};
+    std::vector<float> weights {1.0, 0.5, 2.0, 1.0, 1.0};
+    std::vector<float> ref_dst {3.5, 5.0, 0.0, 0.0, 20.0, 24.0};
+    std::vector<float> dst(ref_dst.size(), 0.0);
+
+    graph::op_t eb_op(graph::op_kind::EmbeddingBag);
+    eb_op.set_attr<std::string>(graph::op_attr::mode, "sum");
+
+    graph::logical_tensor_t table_lt
+            = utils::logical_tensor_init(0, {4, 2}, graph::data_type::f32);
+    graph::logical_tensor_t indices_lt
+            = utils::logical_tensor_init(1, {5}, graph::data_type::s32);
+    graph::logical_tensor_t offsets_lt
+            = utils::logical_tensor_init(2, {4}, graph::data_type::s32);
+    graph::logical_tensor_t weights_lt
+            = utils::logical_tensor_init(3, {5}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(4, {3, 2}, graph::data_type::f32);
+
+    eb_op.add_input(table_lt);
+    eb_op.add_input(indices_lt);
+    eb_op.add_input(offsets_lt);
+    eb_op.add_input(weights_lt);
+    eb_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&eb_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("embedding_bag_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &table_lt, &indices_lt, &offsets_lt, &weights_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t table_ts(table_lt, eng, table);
+    test_tensor_t indices_ts(indices_lt, eng, indices);
+    test_tensor_t offsets_ts(offsets_lt, eng, offsets);
+    test_tensor_t weights_ts(weights_lt, eng, weights);
+    test_tensor_t dst_ts(dst_lt, eng, dst);
+
+    cp.execute(strm,
+            {table_ts.get(), indices_ts.get(), offsets_ts.get(),
+                    weights_ts.get()},
+            {dst_ts.get()});
+    strm->wait();
+
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_FLOAT_EQ(dst[i], ref_dst[i]);
+    }
+}
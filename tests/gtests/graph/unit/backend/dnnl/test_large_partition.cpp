@@ -338,6 +338,103 @@ TEST(test_large_partition_execute, F32Resnet50Stage2Block) {
                     /*atol*/ 1e-5f));
 }
 
+TEST(test_large_partition_execute, F32InvertedBottleneckBlock_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    // The decomposition kernel is enabled for OMP and THREADPOOL runtimes.
+    const bool check_kernel = DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL;
+
+    for (int64_t stride : {1, 2}) {
+        for (bool use_biasadd : {false, true}) {
+            // Half of the cases use constant weights, which are converted
+            // once and kept in the constant cache.
+            const bool constant_weights = use_biasadd;
+            utils::id_generator_t id_gen;
+            graph::graph_t g(eng->kind());
+            utils::construct_f32_inverted_bottleneck_block(
+                    &g, id_gen, stride, use_biasadd);
+            g.finalize();
+
+            graph::pass::pass_base_ptr apass
+                    = get_pass("fp_inverted_bottleneck_fusion");
+            apass->run(g);
+            ASSERT_EQ(g.get_num_partitions(), 1U);
+            auto part = g.get_partitions()[0];
+            ASSERT_EQ(part->get_ops().size(), g.get_ops().size());
+
+            // compile
+            graph::partition_t p;
+            p.init(part);
+
+            auto partition_inputs = p.get_inputs();
+            auto partition_outputs = p.get_outputs();
+            // src, weights and bias of every conv, the residual add reads
+            // src through another port
+            ASSERT_EQ(partition_inputs.size(), stride == 1 ? 8U : 7U);
+            ASSERT_EQ(partition_outputs.size(), 1U);
+
+            std::vector<const graph::logical_tensor_t *> inputs, outputs;
+            for (auto &lt : partition_inputs) {
+                // The block source is the first tensor of the graph.
+                if (constant_weights && lt.id != 0)
+                    lt.property = graph::property_type::constant;
+                inputs.emplace_back(&lt);
+            }
+            for (auto &lt : partition_outputs) {
+                // set output to be strided
+                lt = utils::logical_tensor_init(
+                        lt.id, lt.data_type, graph::layout_type::strided);
+                outputs.emplace_back(&lt);
+            }
+
+            graph::compiled_partition_t cp(p);
+            ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                    graph::status::success);
+            if (check_kernel) {
+                ASSERT_EQ(cp.get_pimpl()->str(),
+                        "inverted_bottleneck_decomp_kernel_t");
+            }
+
+            std::vector<test_tensor_t> inputs_ts, outputs_ts, ref_outputs_ts;
+            for (auto &lt : inputs) {
+                inputs_ts.emplace_back(*lt, eng);
+                inputs_ts.back().fill<float>(0.f, 1.f);
+            }
+
+            for (auto &lt : outputs) {
+                graph::logical_tensor_t compiled_output;
+                cp.query_logical_tensor(lt->id, &compiled_output);
+                ASSERT_TRUE(ltw(compiled_output).is_strided());
+                outputs_ts.emplace_back(compiled_output, eng);
+                ref_outputs_ts.emplace_back(compiled_output, eng);
+            }
+
+            ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+                    graph::status::success);
+            // The second execution reads the constant weights from the
+            // cache.
+            for (int iter = 0; iter < (constant_weights ? 2 : 1); iter++) {
+                outputs_ts[0].fill<float>(0.f);
+                ASSERT_EQ(cp.execute(strm,
+                                  test_tensor_t::to_graph_tensor(inputs_ts),
+                                  test_tensor_t::to_graph_tensor(outputs_ts)),
+                        graph::status::success);
+                strm->wait();
+
+                ASSERT_TRUE(allclose<float>(outputs_ts[0], ref_outputs_ts[0],
+                        /*rtol*/ 1e-4f, /*atol*/ 1e-4f));
+            }
+        }
+    }
+}
+
 TEST(test_large_partition_execute, ItexInt8Resnet50Stage2Block) {
     graph::engine_t *eng = get_engine();
     graph::stream_t *strm = get_stream();
@@ -0,0 +1,348 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+TEST(test_rope_execute, RotaryEmbeddingHalfSplit) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "RotaryEmbedding is not supported on gpu");
+
+    // batch = 1, heads = 1, seq_len = 2, head_size = rotary_dim = 4
+    std::vector<float> src {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+    std::vector<float> cos {1.0, 1.0, 0.0, 0.5};
+    std::vector<float> sin {0.0, 0.0, 1.0, 0.5};
+    std::vector<float> ref_dst {1.0, 2.0, 3.0, 4.0, -7.0, -1.0, 5.0, 7.0};
+    std::vector<float> dst(src.size(), 0.0);
+
+    graph::op_t rope_op(graph::op_kind::RotaryEmbedding);
+
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {1, 1, 2, 4}, graph::data_type::f32);
+    graph::logical_tensor_t cos_lt
+            = utils::logical_tensor_init(1, {2, 2}, graph::data_type::f32);
+    graph::logical_tensor_t sin_lt
+            = utils::logical_tensor_init(2, {2, 2}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            3, {1, 1, 2, 4}, graph::data_type::f32);
+
+    rope_op.add_input(src_lt);
+    rope_op.add_input(cos_lt);
+    rope_op.add_input(sin_lt);
+    rope_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&rope_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("rope_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &cos_lt, &sin_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t cos_ts(cos_lt, eng, cos);
+    test_tensor_t sin_ts(sin_lt, eng, sin);
+    test_tensor_t dst_ts(dst_lt, eng, dst);
+
+    cp.execute(strm, {src_ts.get(), cos_ts.get(), sin_ts.get()},
+            {dst_ts.get()});
+    strm->wait();
+
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_FLOAT_EQ(dst[i], ref_dst[i]);
+    }
+}
+
+TEST(test_rope_execute, RotaryEmbeddingInterleavedWithPositions) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "RotaryEmbedding is not supported on gpu");
+
+    // batch = 2, heads = 1, seq_len = 1, head_size = 6, rotary_dim = 4, the
+    // last two elements of every head are passed through.
+    std::vector<float> src {
+            1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0};
+    std::vector<float> cos {1.0, 1.0, 0.0, 0.0, 0.0, 0.5};
+    std::vector<float> sin {0.0, 0.0, 1.0, 1.0, 1.0, 0.5};
+    std::vector<int32_t> positions {2, 0};
+    std::vector<float> ref_dst {
+            -2.0, 1.0, -0.5, 3.5, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0};
+    std::vector<float> dst(src.size(), 0.0);
+
+    graph::op_t rope_op(graph::op_kind::RotaryEmbedding);
+    rope_op.set_attr<std::string>(graph::op_attr::mode, "interleaved");
+
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {2, 1, 1, 6}, graph::data_type::f32);
+    graph::logical_tensor_t cos_lt
+            = utils::logical_tensor_init(1, {3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t sin_lt
+            = utils::logical_tensor_init(2, {3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t pos_lt
+            = utils::logical_tensor_init(3, {2}, graph::data_type::s32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            4, {2, 1, 1, 6}, graph::data_type::f32);
+
+    rope_op.add_input(src_lt);
+    rope_op.add_input(cos_lt);
+    rope_op.add_input(sin_lt);
+    rope_op.add_input(pos_lt);
+    rope_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&rope_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("rope_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &cos_lt, &sin_lt, &pos_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t cos_ts(cos_lt, eng, cos);
+    test_tensor_t sin_ts(sin_lt, eng, sin);
+    test_tensor_t pos_ts(pos_lt, eng, positions);
+    test_tensor_t dst_ts(dst_lt, eng, dst);
+
+    cp.execute(strm,
+            {src_ts.get(), cos_ts.get(), sin_ts.get(), pos_ts.get()},
+            {dst_ts.get()});
+    strm->wait();
+
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_FLOAT_EQ(dst[i], ref_dst[i]);
+    }
+}
+
+TEST(test_rope_execute, RotaryEmbeddingBeforeSdpa) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "RotaryEmbedding is not supported on gpu");
+
+    const int64_t B = 1, H = 4, S = 8, D = 16;
+    const graph::dims qkv_dims {B, H, S, D};
+    const graph::dims score_dims {B, H, S, S};
+    const graph::dims table_dims {S, D / 2};
+    const auto f32 = graph::data_type::f32;
+
+    size_t id = 0;
+    auto query = utils::logical_tensor_init(id++, qkv_dims, f32);
+    auto key = utils::logical_tensor_init(id++, qkv_dims, f32);
+    auto value = utils::logical_tensor_init(id++, qkv_dims, f32);
+    auto cos = utils::logical_tensor_init(id++, table_dims, f32);
+    auto sin = utils::logical_tensor_init(id++, table_dims, f32);
+    auto scale = utils::logical_tensor_init(id++, {1}, f32);
+    auto query_rot = utils::logical_tensor_init(id++, qkv_dims, f32);
+    auto key_rot = utils::logical_tensor_init(id++, qkv_dims, f32);
+    auto score = utils::logical_tensor_init(id++, score_dims, f32);
+    auto scaled_score = utils::logical_tensor_init(id++, score_dims, f32);
+    auto probs = utils::logical_tensor_init(id++, score_dims, f32);
+    auto output = utils::logical_tensor_init(id++, qkv_dims, f32);
+
+    graph::op_t rope_q {id++, graph::op_kind::RotaryEmbedding, "rope_q"};
+    rope_q.add_input(query);
+    rope_q.add_input(cos);
+    rope_q.add_input(sin);
+    rope_q.add_output(query_rot);
+
+    graph::op_t rope_k {id++, graph::op_kind::RotaryEmbedding, "rope_k"};
+    rope_k.add_input(key);
+    rope_k.add_input(cos);
+    rope_k.add_input(sin);
+    rope_k.add_output(key_rot);
+
+    graph::op_t matmul_qk {id++, graph::op_kind::MatMul, "matmul_qk"};
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(query_rot);
+    matmul_qk.add_input(key_rot);
+    matmul_qk.add_output(score);
+
+    graph::op_t div {id++, graph::op_kind::Divide, "div"};
+    div.add_input(score);
+    div.add_input(scale);
+    div.add_output(scaled_score);
+
+    graph::op_t softmax {id++, graph::op_kind::SoftMax, "softmax"};
+    softmax.set_attr<int64_t>(graph::op_attr::axis, 3);
+    softmax.add_input(scaled_score);
+    softmax.add_output(probs);
+
+    graph::op_t matmul_v {id++, graph::op_kind::MatMul, "matmul_v"};
+    matmul_v.add_input(probs);
+    matmul_v.add_input(value);
+    matmul_v.add_output(output);
+
+    graph::graph_t g(eng->kind());
+    for (auto *op : {&rope_q, &rope_k, &matmul_qk, &div, &softmax, &matmul_v})
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    g.finalize();
+
+    auto &backend_ptr
+            = dnnl::impl::graph::dnnl_impl::dnnl_backend_t::get_singleton();
+    auto pm = dnnl::impl::graph::pass::pass_manager_t(
+            backend_ptr.get_pass_registry());
+    pm.run_passes(g, "", graph::partition_policy::fusion);
+
+    // Every RotaryEmbedding gets its own partition, the rest of the subgraph
+    // is an SDPA partition.
+    auto parts = g.get_partitions();
+    ASSERT_EQ(parts.size(), 3U);
+    size_t n_sdp = 0;
+    for (const auto &part : parts) {
+        if (part->get_kind() == graph::partition_kind_t::sdp) {
+            ASSERT_EQ(part->get_ops().size(), 4U);
+            n_sdp++;
+        } else {
+            ASSERT_EQ(part->get_ops().size(), 1U);
+            ASSERT_EQ(part->get_ops()[0]->get_kind(),
+                    graph::op_kind::RotaryEmbedding);
+        }
+    }
+    ASSERT_EQ(n_sdp, 1U);
+
+    std::unordered_map<size_t, std::vector<float>> data;
+    const size_t qkv_size = static_cast<size_t>(B * H * S * D);
+    for (size_t in_id : {query.id, key.id, value.id}) {
+        auto &v = data[in_id];
+        v.resize(qkv_size);
+        for (size_t i = 0; i < qkv_size; i++)
+            v[i] = std::sin(0.37f * i + 0.5f * in_id);
+    }
+    auto &cos_data = data[cos.id];
+    auto &sin_data = data[sin.id];
+    for (int64_t s = 0; s < S; s++)
+        for (int64_t i = 0; i < D / 2; i++) {
+            const float theta = s * std::pow(10000.f, -2.f * i / D);
+            cos_data.push_back(std::cos(theta));
+            sin_data.push_back(std::sin(theta));
+        }
+    data[scale.id] = {std::sqrt(static_cast<float>(D))};
+
+    // The RotaryEmbedding partitions produce the inputs of the SDPA one.
+    std::stable_partition(parts.begin(), parts.end(),
+            [](const std::shared_ptr<graph::partition_impl_t> &part) {
+                return part->get_kind() != graph::partition_kind_t::sdp;
+            });
+    for (const auto &part : parts) {
+        graph::partition_t p;
+        p.init(part);
+        auto partition_inputs = p.get_inputs();
+        auto partition_outputs = p.get_outputs();
+        std::vector<const graph::logical_tensor_t *> inputs, outputs;
+        for (auto &lt : partition_inputs)
+            inputs.emplace_back(&lt);
+        for (auto &lt : partition_outputs)
+            outputs.emplace_back(&lt);
+
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+        std::vector<test_tensor_t> inputs_ts, outputs_ts;
+        for (auto &lt : partition_inputs)
+            inputs_ts.emplace_back(lt, eng, data.at(lt.id));
+        for (auto &lt : partition_outputs)
+            outputs_ts.emplace_back(lt, eng);
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+        for (size_t i = 0; i < partition_outputs.size(); i++)
+            data[partition_outputs[i].id]
+                    = outputs_ts[i].as_vec_type<float>();
+    }
+
+    // Reference: half-split rotation of the query and the key followed by
+    // the attention.
+    const auto rotate = [&](const std::vector<float> &x) {
+        std::vector<float> y(x.size());
+        for (int64_t bh = 0; bh < B * H; bh++)
+            for (int64_t s = 0; s < S; s++) {
+                const float *xp = &x[(bh * S + s) * D];
+                float *yp = &y[(bh * S + s) * D];
+                for (int64_t i = 0; i < D / 2; i++) {
+                    const float c = cos_data[s * D / 2 + i];
+                    const float sn = sin_data[s * D / 2 + i];
+                    yp[i] = xp[i] * c - xp[i + D / 2] * sn;
+                    yp[i + D / 2] = xp[i + D / 2] * c + xp[i] * sn;
+                }
+            }
+        return y;
+    };
+    const auto q_rot = rotate(data[query.id]);
+    const auto k_rot = rotate(data[key.id]);
+    const auto &v = data[value.id];
+    const auto &out = data.at(output.id);
+    for (int64_t bh = 0; bh < B * H; bh++)
+        for (int64_t s = 0; s < S; s++) {
+            std::vector<float> p(S);
+            float max_p = -INFINITY, sum_p = 0.f;
+            for (int64_t t = 0; t < S; t++) {
+                float acc = 0.f;
+                for (int64_t i = 0; i < D; i++)
+                    acc += q_rot[(bh * S + s) * D + i]
+                            * k_rot[(bh * S + t) * D + i];
+                p[t] = acc / data[scale.id][0];
+                max_p = std::max(max_p, p[t]);
+            }
+            for (int64_t t = 0; t < S; t++) {
+                p[t] = std::exp(p[t] - max_p);
+                sum_p += p[t];
+            }
+            for (int64_t i = 0; i < D; i++) {
+                float ref = 0.f;
+                for (int64_t t = 0; t < S; t++)
+                    ref += p[t] / sum_p * v[(bh * S + t) * D + i];
+                ASSERT_NEAR(out[(bh * S + s) * D + i], ref, 1e-4f);
+            }
+        }
+}
@@ -552,6 +552,10 @@ TEST(test_sdp_decomp_execute, F32SdpCorr_CPU) {
     SKIP_IF(eng->kind() == graph::engine_kind::gpu,
             "Skip for GPU - not supported yet.");
 
+    // The CPU sdpa primitive requires Intel AVX2.
+    const bool has_cpu_sdpa
+            = (dnnl_get_effective_cpu_isa() & dnnl_cpu_isa_avx2)
+            == dnnl_cpu_isa_avx2;
     size_t ndims = 4;
     int batch_size = 56, seq_len = 384, num_head = 16, head_dim = 1024,
         size_per_head = head_dim / num_head;
@@ -648,6 +652,10 @@ TEST(test_sdp_decomp_execute, F32SdpCorr_CPU) {
             graph::compiled_partition_t cp2(p);
             ASSERT_EQ(p.compile(&cp2, inputs, outputs, eng),
                     graph::status::success);
+            // The fused sdpa primitive is preferred when it is available.
+            if (has_cpu_sdpa) {
+                ASSERT_EQ(cp2.get_pimpl()->str(), "sdp_primitive_kernel_t");
+            }
             std::vector<test_tensor_t> outputs2_ts;
             for (auto &lt : outputs) {
                 graph::logical_tensor_t compiled_output;
@@ -1595,3 +1603,98 @@ TEST(test_sdp_decomp_execute, MultithreaSdpDecompCorr_CPU) {
         t2.join();
     }
 }
+
+// A single query row attends to a long key/value sequence with few heads, as
+// in token by token generation. Like a long query sequence, such shapes have
+// too few heads to parallelize over, so they are not decomposed.
+TEST(test_sdp_decomp_execute, F32SdpDecodeCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // The decomposition kernel checks the number of heads for OMP only.
+    const bool check_kernel = DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP;
+    int batch_size = 1, num_head = 2, head_dim = 128, kv_seq_len = 2048;
+    std::vector<int> seq_len_vec = {1, 256};
+
+    for (int seq_len : seq_len_vec) {
+        graph::graph_t g(eng->kind());
+        utils::construct_dnnl_float_MHA(&g, dnnl::impl::data_type::f32,
+                batch_size, seq_len, num_head, head_dim, false, true,
+                kv_seq_len);
+        g.finalize();
+
+        graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+
+        // compile
+        graph::partition_t p;
+        p.init(part);
+
+        auto partition_inputs = p.get_inputs();
+        auto partition_outputs = p.get_outputs();
+        ASSERT_EQ(partition_inputs.size(), 5U);
+        ASSERT_EQ(partition_outputs.size(), 1U);
+
+        std::vector<const graph::logical_tensor_t *> inputs, outputs;
+        for (auto &lt : partition_inputs) {
+            inputs.emplace_back(&lt);
+        }
+        for (auto &lt : partition_outputs) {
+            // set output to be strided
+            lt = utils::logical_tensor_init(
+                    lt.id, lt.data_type, graph::layout_type::strided);
+            outputs.emplace_back(&lt);
+        }
+
+        std::vector<test_tensor_t> inputs_ts;
+        for (auto &lt : inputs) {
+            inputs_ts.emplace_back(*lt, eng);
+            inputs_ts.back().fill<float>();
+        }
+
+        // -------------------------case 1----------------------------------
+        custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE", "1", 1);
+        graph::compiled_partition_t cp1(p);
+        ASSERT_EQ(
+                p.compile(&cp1, inputs, outputs, eng), graph::status::success);
+        std::vector<test_tensor_t> outputs1_ts;
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp1.query_logical_tensor(lt->id, &compiled_output);
+            outputs1_ts.emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp1.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs1_ts)),
+                graph::status::success);
+        strm->wait();
+
+        // -------------------------case 2----------------------------------
+        custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE", "0", 1);
+        graph::compiled_partition_t cp2(p);
+        ASSERT_EQ(
+                p.compile(&cp2, inputs, outputs, eng), graph::status::success);
+        // The decomposition kernel requires batch_size * num_head > 2 * nthr
+        // whatever the query sequence length is.
+        if (check_kernel)
+            ASSERT_NE(cp2.get_pimpl()->str(), "sdp_decomp_kernel_t");
+        std::vector<test_tensor_t> outputs2_ts;
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp2.query_logical_tensor(lt->id, &compiled_output);
+            outputs2_ts.emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp2.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs2_ts)),
+                graph::status::success);
+        strm->wait();
+
+        ASSERT_TRUE(allclose<float>(outputs1_ts[0], outputs2_ts[0],
+                /*rtol*/ 0.01f,
+                /*atol*/ 1e-6f));
+    }
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+TEST(test_top_k_execute, TopKMaxLastAxis) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "TopK is not supported on gpu");
+
+    // Equal values are ordered by their positions.
+    std::vector<float> src {1.0, 5.0, 3.0, 5.0, -2.0, 0.0, -1.0, -1.0, 4.0,
+            2.0, 4.0, 7.0};
+    std::vector<float> ref_values {5.0, 5.0, 3.0, 7.0, 4.0, 4.0};
+    std::vector<int32_t> ref_indices {1, 3, 2, 5, 2, 4};
+    std::vector<float> values(ref_values.size(), 0.0);
+    std::vector<int32_t> indices(ref_indices.size(), 0);
+
+    graph::op_t top_k_op(graph::op_kind::TopK);
+    top_k_op.set_attr<int64_t>(graph::op_attr::k, 3);
+    top_k_op.set_attr<int64_t>(graph::op_attr::axis, -1);
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {2, 6}, graph::data_type::f32);
+    graph::logical_tensor_t values_lt
+            = utils::logical_tensor_init(1, {2, 3}, graph::data_type::f32);
+    graph::logical_tensor_t indices_lt
+            = utils::logical_tensor_init(2, {2, 3}, graph::data_type::s32);
+
+    top_k_op.add_input(src_lt);
+    top_k_op.add_output(values_lt);
+    top_k_op.add_output(indices_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&top_k_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("top_k_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {
+            &values_lt, &indices_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t values_ts(values_lt, eng, values);
+    test_tensor_t indices_ts(indices_lt, eng, indices);
+
+    cp.execute(strm, {src_ts.get()}, {values_ts.get(), indices_ts.get()});
+    strm->wait();
+
+    values = values_ts.as_vec_type<float>();
+    indices = indices_ts.as_vec_type<int32_t>();
+    for (size_t i = 0; i < ref_values.size(); ++i) {
+        ASSERT_FLOAT_EQ(values[i], ref_values[i]);
+        ASSERT_EQ(indices[i], ref_indices[i]);
+    }
+}
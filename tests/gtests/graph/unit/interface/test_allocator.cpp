@@ -64,3 +64,47 @@ TEST(test_interface_allocator, AllocatorEarlyDestroy) {
 #endif
     }
 }
+
+TEST(test_interface_allocator, TemporaryArena) {
+    using mem_attr_t = dnnl::impl::graph::allocator_t::mem_attr_t;
+    using mem_type_t = dnnl::impl::graph::allocator_t::mem_type_t;
+
+    dnnl::impl::graph::allocator_t alloc;
+    alignas(64) static char arena[1024];
+    ASSERT_EQ(dnnl_graph_allocator_set_temporary_arena(
+                      &alloc, arena, sizeof(arena)),
+            graph::status::success);
+
+    const mem_attr_t temp_attr {mem_type_t::temp, 64};
+    void *a = alloc.allocate(100, temp_attr);
+    void *b = alloc.allocate(100, temp_attr);
+    ASSERT_EQ(a, arena);
+    ASSERT_EQ(b, arena + 128);
+
+    // The arena cannot be replaced while its buffers are in use.
+    ASSERT_EQ(dnnl_graph_allocator_set_temporary_arena(&alloc, nullptr, 0),
+            graph::status::invalid_arguments);
+
+    // A released buffer is reused at the same offset.
+    alloc.deallocate(a);
+    void *c = alloc.allocate(64, temp_attr);
+    ASSERT_EQ(c, arena);
+
+    // Buffers which do not fit and non-temporary buffers bypass the arena.
+    void *d = alloc.allocate(2048, temp_attr);
+    void *e = alloc.allocate(64, mem_attr_t {mem_type_t::persistent, 64});
+    ASSERT_NE(d, nullptr);
+    ASSERT_NE(e, nullptr);
+    ASSERT_TRUE(d < arena || d >= arena + sizeof(arena));
+    ASSERT_TRUE(e < arena || e >= arena + sizeof(arena));
+
+    // Copies of the allocator, as kept by engines, share the arena.
+    dnnl::impl::graph::allocator_t alloc_copy = alloc;
+    void *f = alloc_copy.allocate(100, temp_attr);
+    ASSERT_EQ(f, arena + 256);
+
+    for (void *p : {b, c, d, e, f})
+        alloc.deallocate(p);
+    ASSERT_EQ(dnnl_graph_allocator_set_temporary_arena(&alloc, nullptr, 0),
+            graph::status::success);
+}
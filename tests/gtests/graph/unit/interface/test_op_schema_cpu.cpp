@@ -2631,6 +2631,35 @@ TEST(test_interface_op_schema, InferEluBackwardOutputShape) {
     verify_two_ins_identity_shape_infer(op_kind_);
 }
 
+TEST(test_interface_op_schema, EmbeddingBag) {
+    const op_kind_t op_kind_ = op_kind::EmbeddingBag;
+    const size_t expected_in_size = 4;
+    const size_t expected_out_size = 1;
+    const size_t expected_attr_size = 1;
+    const std::map<op_attr_t, bool> attrs_data = {{op_attr::mode, false}};
+
+    verify_op_schema(op_kind_, expected_in_size, expected_out_size,
+            expected_attr_size, attrs_data);
+}
+
+TEST(test_interface_op_schema, InferEmbeddingBagOutputShape) {
+    const op_schema_t *a_op_schema
+            = op_schema_registry_t::get_op_schema(op_kind::EmbeddingBag);
+    op_t a_op {0, op_kind::EmbeddingBag, "embedding_bag"};
+
+    auto lt_table = logical_tensor_init(0, {100, 16}, data_type::f32);
+    auto lt_indices = logical_tensor_init(1, {40}, data_type::s32);
+    auto lt_offsets = logical_tensor_init(2, {9}, data_type::s32);
+    auto lt_o = logical_tensor_init(3, data_type::f32, layout_type::strided);
+    std::vector<logical_tensor_t *> lt_in {&lt_table, &lt_indices, &lt_offsets};
+    std::vector<logical_tensor_t *> lt_out {&lt_o};
+    a_op_schema->shape_infer(&a_op, lt_in, lt_out);
+
+    // The number of bags is the number of offsets minus one.
+    const std::vector<int64_t> expected_out_shape = {8, 16};
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_o).vdims(), expected_out_shape);
+}
+
 TEST(test_interface_op_schema, End) {
     const op_schema_t *op_schema
             = op_schema_registry_t::get_op_schema(op_kind::End);
@@ -3366,6 +3395,41 @@ TEST(test_interface_op_schema, InferReluBackwardOutputShape) {
     verify_two_ins_identity_shape_infer(op_kind_);
 }
 
+TEST(test_interface_op_schema, RMSNorm) {
+    const op_kind_t op_kind_ = op_kind::RMSNorm;
+    const size_t expected_in_size = 2;
+    const size_t expected_out_size = 1;
+    const size_t expected_attr_size = 2;
+    const std::map<op_attr_t, bool> attrs_data
+            = {{op_attr::begin_norm_axis, false}, {op_attr::epsilon, false}};
+
+    verify_op_schema(op_kind_, expected_in_size, expected_out_size,
+            expected_attr_size, attrs_data);
+}
+
+TEST(test_interface_op_schema, InferRMSNormOutputShape) {
+    const op_kind_t op_kind_ = op_kind::RMSNorm;
+
+    verify_single_in_identity_shape_infer(op_kind_);
+}
+
+TEST(test_interface_op_schema, RotaryEmbedding) {
+    const op_kind_t op_kind_ = op_kind::RotaryEmbedding;
+    const size_t expected_in_size = 4;
+    const size_t expected_out_size = 1;
+    const size_t expected_attr_size = 1;
+    const std::map<op_attr_t, bool> attrs_data = {{op_attr::mode, false}};
+
+    verify_op_schema(op_kind_, expected_in_size, expected_out_size,
+            expected_attr_size, attrs_data);
+}
+
+TEST(test_interface_op_schema, InferRotaryEmbeddingOutputShape) {
+    const op_kind_t op_kind_ = op_kind::RotaryEmbedding;
+
+    verify_single_in_identity_shape_infer(op_kind_);
+}
+
 TEST(test_interface_op_schema, Round) {
     const op_kind_t op_kind_ = op_kind::Round;
     const size_t expected_in_size = 1;
@@ -3703,6 +3767,46 @@ TEST(test_interface_op_schema, InferTanhBackwardOutputShape) {
     verify_single_in_identity_shape_infer(op_kind_);
 }
 
+TEST(test_interface_op_schema, TopK) {
+    const op_kind_t op_kind_ = op_kind::TopK;
+    const size_t expected_in_size = 1;
+    const size_t expected_out_size = 2;
+    const size_t expected_attr_size = 3;
+    const std::map<op_attr_t, bool> attrs_data = {
+            {op_attr::k, true}, {op_attr::axis, false}, {op_attr::mode, false}};
+
+    verify_op_schema(op_kind_, expected_in_size, expected_out_size,
+            expected_attr_size, attrs_data);
+}
+
+TEST(test_interface_op_schema, InferTopKOutputShape) {
+    const op_schema_t *a_op_schema
+            = op_schema_registry_t::get_op_schema(op_kind::TopK);
+    op_t a_op {0, op_kind::TopK, "top_k"};
+    a_op.set_attr<int64_t>(op_attr::k, 4);
+    a_op.set_attr<int64_t>(op_attr::axis, -2);
+
+    auto lt_src = logical_tensor_init(0, {2, 100, 8}, data_type::f32);
+    auto lt_values
+            = logical_tensor_init(1, data_type::f32, layout_type::strided);
+    auto lt_indices
+            = logical_tensor_init(2, data_type::s32, layout_type::strided);
+    std::vector<logical_tensor_t *> lt_in {&lt_src};
+    std::vector<logical_tensor_t *> lt_out {&lt_values, &lt_indices};
+    a_op_schema->shape_infer(&a_op, lt_in, lt_out);
+
+    const std::vector<int64_t> expected_out_shape = {2, 4, 8};
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_values).vdims(), expected_out_shape);
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_indices).vdims(), expected_out_shape);
+
+    // k can't exceed the size of the axis.
+    a_op.set_attr<int64_t>(op_attr::k, 101);
+    auto lt_bad = logical_tensor_init(3, data_type::f32, layout_type::strided);
+    std::vector<logical_tensor_t *> lt_bad_out {&lt_bad, &lt_indices};
+    EXPECT_EQ(a_op_schema->shape_infer(&a_op, lt_in, lt_bad_out),
+            status::invalid_shape);
+}
+
 TEST(test_interface_op_schema, Wildcard) {
     const op_schema_t *op_schema
             = op_schema_registry_t::get_op_schema(op_kind::Wildcard);
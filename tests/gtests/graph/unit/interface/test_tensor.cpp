@@ -15,6 +15,7 @@
 *******************************************************************************/
 #include "oneapi/dnnl/dnnl_graph.h"
 
+#include "interface/allocator.hpp"
 #include "interface/c_types_map.hpp"
 #include "interface/tensor.hpp"
 
@@ -97,3 +98,39 @@ TEST(test_interface_tensor, DnnlGraphTensorGetEngine) {
     ASSERT_EQ_SAFE(dnnl_graph_tensor_destroy(tensor), graph::status::success,
             DESTROY_TENSOR(tensor));
 }
+
+TEST(test_interface_tensor, DnnlGraphTensorCreateWithTemporaryArena) {
+    // The temporary arena is used for host allocations only.
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    GTEST_SKIP();
+#endif
+    if (get_test_engine_kind() != graph::engine_kind::cpu) GTEST_SKIP();
+
+    graph::allocator_t alloc;
+    alignas(64) static char arena[1024];
+    ASSERT_EQ(dnnl_graph_allocator_set_temporary_arena(
+                      &alloc, arena, sizeof(arena)),
+            graph::status::success);
+    graph::engine_t *engine = nullptr;
+    ASSERT_EQ(dnnl_graph_make_engine_with_allocator(
+                      &engine, graph::engine_kind::cpu, 0, &alloc),
+            graph::status::success);
+
+    // Tensors allocated by the library are owned by the user and must not
+    // be placed into the arena reused by the temporaries of partitions.
+    graph::tensor_t *tensor = nullptr;
+    graph::logical_tensor_t lt = utils::logical_tensor_init(
+            0, {4, 8}, graph::data_type::f32, graph::layout_type::strided);
+    ASSERT_EQ_SAFE(dnnl_graph_tensor_create(
+                           &tensor, &lt, engine, DNNL_MEMORY_ALLOCATE),
+            graph::status::success, dnnl_engine_destroy(engine););
+    const char *data = static_cast<const char *>(tensor->get_data_handle());
+    EXPECT_NE(data, nullptr);
+    EXPECT_TRUE(data < arena || data >= arena + sizeof(arena));
+
+    // The arena stays unused and can be released.
+    DESTROY_TENSOR(tensor);
+    dnnl_engine_destroy(engine);
+    EXPECT_EQ(dnnl_graph_allocator_set_temporary_arena(&alloc, nullptr, 0),
+            graph::status::success);
+}
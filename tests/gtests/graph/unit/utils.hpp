@@ -885,24 +885,31 @@ inline void construct_f32_MHA(dnnl::impl::graph::graph_t *agraph,
     agraph->add_op(&transpose_output);
 }
 
+// `kv_seq_len` is the sequence length of keys and values, which is the same as
+// the one of queries when it is 0.
 inline void construct_dnnl_float_MHA(dnnl::impl::graph::graph_t *agraph,
         impl::data_type_t dtype = impl::data_type::f32, int batch_size = 1,
         int seq_len = 384, int num_head = 16, int head_dim = 1024,
-        bool transpose = false, bool attention_mask = true) {
+        bool transpose = false, bool attention_mask = true,
+        int kv_seq_len = 0) {
     using namespace dnnl::impl::graph;
     using namespace dnnl::graph::tests;
 
+    if (kv_seq_len == 0) kv_seq_len = seq_len;
     int size_per_head = head_dim / num_head;
     dims MIXED_LAYER_INPUT_SHAPE = {batch_size, seq_len, head_dim};
-    dims EXTENDED_ATTENTION_MASK_SHAPE = {batch_size, 1, 1, seq_len};
+    dims EXTENDED_ATTENTION_MASK_SHAPE = {batch_size, 1, 1, kv_seq_len};
     dims QKV_RESHAPED_SHAPE = {batch_size, seq_len, num_head, size_per_head};
     dims QKV_TRANSPOSED_SHAPE = {batch_size, num_head, seq_len, size_per_head};
+    dims KV_TRANSPOSED_SHAPE
+            = {batch_size, num_head, kv_seq_len, size_per_head};
     dims KEY_TRANSPOSED_SHAPE;
     if (!transpose)
-        KEY_TRANSPOSED_SHAPE = {batch_size, num_head, size_per_head, seq_len};
+        KEY_TRANSPOSED_SHAPE
+                = {batch_size, num_head, size_per_head, kv_seq_len};
     else
-        KEY_TRANSPOSED_SHAPE = {batch_size, num_head, seq_len, size_per_head};
-    dims MATMUL_QK_OUTPUT_SHAPE = {batch_size, num_head, seq_len, seq_len};
+        KEY_TRANSPOSED_SHAPE = KV_TRANSPOSED_SHAPE;
+    dims MATMUL_QK_OUTPUT_SHAPE = {batch_size, num_head, seq_len, kv_seq_len};
     dims MATMUL_V_OUTPUT_SHAPE = {batch_size, num_head, seq_len, size_per_head};
 
     dims CONST_SHAPE = {1};
@@ -936,7 +943,7 @@ inline void construct_dnnl_float_MHA(dnnl::impl::graph::graph_t *agraph,
             lt_id++, MATMUL_QK_OUTPUT_SHAPE, dtype);
 
     auto value_input = unit::utils::logical_tensor_init(
-            lt_id++, QKV_TRANSPOSED_SHAPE, dtype);
+            lt_id++, KV_TRANSPOSED_SHAPE, dtype);
 
     auto matmul_v_out = unit::utils::logical_tensor_init(
             lt_id++, MATMUL_V_OUTPUT_SHAPE, dtype);
@@ -2431,6 +2438,30 @@ inline void construct_f32_resnet50_stage2_block(
     }
 }
 
+// MobileNetV2 inverted bottleneck block: 1x1 expansion conv, 3x3 depthwise
+// conv and 1x1 projection conv with the residual connection for the stride 1.
+inline void construct_f32_inverted_bottleneck_block(
+        dnnl::impl::graph::graph_t *agraph, id_generator_t &id_gen,
+        int64_t stride = 1, bool use_biasadd = false) {
+    const bool with_residual = stride == 1;
+    int64_t ic = 16, c = 96, oc = with_residual ? ic : 24;
+    std::vector<int64_t> src_shape {2, 112, 112, ic};
+
+    auto src = utils::logical_tensor_init(
+            id_gen.get_id(), src_shape, impl::graph::data_type::f32);
+
+    auto expand = create_convolution(id_gen, *agraph, src, ic, 1, c, 1, {1, 1},
+            {1, 1}, {0, 0}, {0, 0}, "NXC", "XIO", true, false, 1e-6f, true,
+            use_biasadd);
+    auto depthwise = create_convolution(id_gen, *agraph, expand, c, 3, c, c,
+            {stride, stride}, {1, 1}, {1, 1}, {1, 1}, "NXC", "XIO", true,
+            false, 1e-6f, true, use_biasadd);
+    auto project = create_convolution(id_gen, *agraph, depthwise, c, 1, oc, 1,
+            {1, 1}, {1, 1}, {0, 0}, {0, 0}, "NXC", "XIO", true, false, 1e-6f,
+            /*no relu*/ false, use_biasadd);
+    if (with_residual) create_add(id_gen, *agraph, project, src);
+}
+
 inline void construct_itex_int8_resnet50_stage2_block(
         dnnl::impl::graph::graph_t *agraph, id_generator_t &id_gen,
         size_t three_conv_block_num = 2) {
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_EMBEDDING_BAG_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_EMBEDDING_BAG_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// Mirrors the argument indices from src/common/embedding_bag_types.hpp.
+#define DNNL_ARG_EMB_OFFSETS DNNL_ARG_SRC_1
+#define DNNL_ARG_EMB_SAMPLE_WEIGHTS DNNL_ARG_SRC_2
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for an embedding bag primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Pooling algorithm: #dnnl_reduction_sum,
+///     #dnnl_reduction_mean or #dnnl_reduction_max.
+/// @param indices_desc Indices memory descriptor, {nnz}.
+/// @param offsets_desc Bag offsets memory descriptor, {batch + 1}.
+/// @param table_desc Embedding table memory descriptor, {rows, dim}.
+/// @param sample_weights_desc Per-sample weights memory descriptor, {nnz}.
+///     Can be NULL or a zero memory descriptor.
+/// @param dst_desc Destination memory descriptor, {batch, dim}.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t table_desc,
+        const_dnnl_memory_desc_t sample_weights_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+namespace dnnl {
+namespace impl {
+
+/// Embedding bag internal primitive.
+struct embedding_bag : public dnnl::primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &table_desc,
+                const memory::desc &sample_weights_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = embedding_bag_primitive_desc_create(&pd,
+                    aengine.get(), dnnl::convert_to_c(aalgorithm),
+                    indices_desc.get(), offsets_desc.get(), table_desc.get(),
+                    sample_weights_desc.get(), dst_desc.get(), attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for an "
+                    "embedding bag primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag() = default;
+
+    /// Constructs an embedding bag primitive.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    embedding_bag(const primitive_desc &pd) : primitive(pd) {}
+};
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
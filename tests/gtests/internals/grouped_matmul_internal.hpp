@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_GROUPED_MATMUL_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_GROUPED_MATMUL_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// Mirrors the argument indices from src/common/grouped_matmul_types.hpp.
+#define DNNL_ARG_GROUP_OFFSETS DNNL_ARG_SRC_1
+#define DNNL_ARG_GROUP_WEIGHTS(g) (DNNL_ARG_MULTIPLE_SRC + (g))
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for a grouped matmul primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor, rows of all groups stacked.
+/// @param wei_desc Weights memory descriptor of a single group.
+/// @param dst_desc Destination memory descriptor, rows of all groups stacked.
+/// @param ngroups Number of groups.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API grouped_matmul_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t wei_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_dim_t ngroups,
+        const_dnnl_primitive_attr_t attr);
+
+namespace dnnl {
+namespace impl {
+
+/// Grouped matmul internal primitive.
+struct grouped_matmul : public dnnl::primitive {
+    /// Primitive descriptor for a grouped matmul primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc &dst_desc,
+                memory::dim ngroups,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = grouped_matmul_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), weights_desc.get(),
+                    dst_desc.get(), ngroups, attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a grouped "
+                    "matmul primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    grouped_matmul() = default;
+
+    /// Constructs a grouped matmul primitive.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    grouped_matmul(const primitive_desc &pd) : primitive(pd) {}
+};
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_ROPE_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_ROPE_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// Mirrors the argument indices from src/common/rope_types.hpp.
+#define DNNL_ARG_ROPE_COS DNNL_ARG_SRC_1
+#define DNNL_ARG_ROPE_SIN DNNL_ARG_SRC_2
+#define DNNL_ARG_ROPE_POSITIONS DNNL_ARG_SRC_3
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for a rotary positional embedding primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor, {batch, heads, seq_len, head}.
+/// @param cos_desc Cosine table memory descriptor, {positions, rotary / 2}.
+/// @param sin_desc Sine table memory descriptor, {positions, rotary / 2}.
+/// @param positions_desc Start positions memory descriptor, {batch}. Can be
+///     NULL or a zero memory descriptor, then sequences start at position 0.
+/// @param dst_desc Destination memory descriptor.
+/// @param interleaved Rotate adjacent pairs of elements if non-zero and
+///     elements from the two halves of the rotary dimension otherwise.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API rope_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t cos_desc,
+        const_dnnl_memory_desc_t sin_desc,
+        const_dnnl_memory_desc_t positions_desc,
+        const_dnnl_memory_desc_t dst_desc, int interleaved,
+        const_dnnl_primitive_attr_t attr);
+
+namespace dnnl {
+namespace impl {
+
+/// Rotary positional embedding internal primitive.
+struct rope : public dnnl::primitive {
+    /// Primitive descriptor for a rotary positional embedding primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &cos_desc, const memory::desc &sin_desc,
+                const memory::desc &positions_desc,
+                const memory::desc &dst_desc, bool interleaved,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = rope_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), cos_desc.get(),
+                    sin_desc.get(), positions_desc.get(), dst_desc.get(),
+                    interleaved, attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a rope "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    rope() = default;
+
+    /// Constructs a rotary positional embedding primitive.
+    /// @param pd Primitive descriptor for a rope primitive.
+    rope(const primitive_desc &pd) : primitive(pd) {}
+};
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <utility>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
@@ -160,4 +161,34 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+class test_parallel_dynamic_t
+    : public ::testing::TestWithParam<std::pair<ptrdiff_t, ptrdiff_t>> {};
+
+TEST_P(test_parallel_dynamic_t, Test) {
+    const ptrdiff_t work_amount = GetParam().first;
+    const ptrdiff_t grain = GetParam().second;
+    std::vector<int> visits((size_t)work_amount, 0);
+
+    impl::parallel_dynamic(0, work_amount, grain,
+            [&](int ithr, int nthr, ptrdiff_t start, ptrdiff_t end) {
+                ASSERT_LE(0, ithr);
+                ASSERT_LT(ithr, nthr);
+                ASSERT_LE(0, start);
+                ASSERT_LT(start, end);
+                ASSERT_LE(end, work_amount);
+                ASSERT_LE(end - start, std::max(grain, ptrdiff_t(1)));
+                // Chunks never overlap, so no synchronization is needed.
+                for (ptrdiff_t i = start; i < end; ++i)
+                    visits[i]++;
+            });
+
+    for (ptrdiff_t i = 0; i < work_amount; ++i)
+        ASSERT_EQ(visits[i], 1);
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_dynamic_t,
+        ::testing::Values(std::make_pair(0, 1), std::make_pair(1, 1),
+                std::make_pair(100, 0), std::make_pair(100, 1),
+                std::make_pair(1000, 7), std::make_pair(1000, 2000)));
+
 } // namespace dnnl
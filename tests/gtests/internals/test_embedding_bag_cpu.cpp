@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "embedding_bag_internal.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+static bool one_of_dt(mdt dt, std::initializer_list<mdt> dts) {
+    return std::find(dts.begin(), dts.end(), dt) != dts.end();
+}
+
+struct embedding_bag_cpu_params_t {
+    memory::dim batch, dim, rows, max_bag;
+    algorithm alg;
+    mdt table_dt, dst_dt;
+    bool with_sample_weights;
+    // Quantization mask of the table: -1 for none, 0 for common, 1 per row.
+    int scales_mask, zp_mask;
+};
+
+class embedding_bag_cpu_test_t
+    : public ::testing::TestWithParam<embedding_bag_cpu_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        p = GetParam();
+        strm = stream(eng);
+    }
+
+    bool is_int_table() const {
+        return one_of_dt(p.table_dt, {mdt::s8, mdt::u8, mdt::s4, mdt::u4});
+    }
+
+    // Fills the table with random values and returns them as floats.
+    std::vector<float> fill_table(memory &table_mem) {
+        const auto rows = p.rows, dim = p.dim;
+        std::vector<float> values(rows * dim);
+        if (!is_int_table()) {
+            std::uniform_real_distribution<float> dist(-1.f, 1.f);
+            memory f32_mem({{rows, dim}, mdt::f32, tag::ab}, eng);
+            auto ptr = static_cast<float *>(f32_mem.get_data_handle());
+            for (memory::dim i = 0; i < rows * dim; i++)
+                ptr[i] = dist(gen);
+            reorder(f32_mem, table_mem).execute(strm, f32_mem, table_mem);
+            // The reference uses the table rounded to the tested data type.
+            reorder(table_mem, f32_mem).execute(strm, table_mem, f32_mem);
+            strm.wait();
+            std::copy(ptr, ptr + rows * dim, values.begin());
+            return values;
+        }
+
+        const bool is_signed = one_of_dt(p.table_dt, {mdt::s8, mdt::s4});
+        const bool is_int4 = one_of_dt(p.table_dt, {mdt::s4, mdt::u4});
+        const int lo = is_signed ? (is_int4 ? -8 : -128) : 0;
+        const int hi = is_signed ? (is_int4 ? 7 : 127) : (is_int4 ? 15 : 255);
+        std::uniform_int_distribution<int> dist(lo, hi);
+        auto ptr = static_cast<uint8_t *>(table_mem.get_data_handle());
+        for (memory::dim i = 0; i < rows * dim; i++) {
+            const int v = dist(gen);
+            values[i] = (float)v;
+            if (!is_int4) {
+                ptr[i] = (uint8_t)v;
+            } else {
+                // The first element of a pair is in the low nibble.
+                const uint8_t nibble = (uint8_t)(v & 0xF);
+                if (i % 2 == 0)
+                    ptr[i / 2] = nibble;
+                else
+                    ptr[i / 2] |= (uint8_t)(nibble << 4);
+            }
+        }
+        return values;
+    }
+
+    std::vector<float> read_memory(memory &mem) {
+        memory::desc f32_md(mem.get_desc().get_dims(), mdt::f32, tag::ab);
+        memory f32_mem(f32_md, eng);
+        reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+        strm.wait();
+        const float *ptr
+                = static_cast<const float *>(f32_mem.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + f32_md.get_size() / sizeof(float));
+    }
+
+    // Returns bag offsets with an empty bag in the middle of the batch.
+    std::vector<int32_t> make_offsets() {
+        std::uniform_int_distribution<int32_t> dist(1, (int32_t)p.max_bag);
+        std::vector<int32_t> offsets(p.batch + 1, 0);
+        for (memory::dim b = 0; b < p.batch; b++) {
+            const bool empty = p.batch > 2 && b == p.batch / 2;
+            offsets[b + 1] = offsets[b] + (empty ? 0 : dist(gen));
+        }
+        return offsets;
+    }
+
+    template <typename T>
+    memory make_1d_memory(const std::vector<T> &data, mdt dt) {
+        memory mem({{(memory::dim)data.size()}, dt, tag::a}, eng);
+        std::copy(data.begin(), data.end(),
+                static_cast<T *>(mem.get_data_handle()));
+        return mem;
+    }
+
+    embedding_bag_cpu_params_t p;
+    engine eng;
+    stream strm;
+    std::mt19937 gen {2025};
+};
+
+TEST_P(embedding_bag_cpu_test_t, TestsEmbeddingBag) {
+    const auto MB = p.batch, D = p.dim, R = p.rows;
+
+    const auto offsets = make_offsets();
+    const auto nnz = (memory::dim)offsets.back();
+    std::uniform_int_distribution<int32_t> idx_dist(0, (int32_t)R - 1);
+    std::vector<int32_t> indices(nnz);
+    for (auto &e : indices)
+        e = idx_dist(gen);
+    std::uniform_real_distribution<float> w_dist(0.f, 2.f);
+    std::vector<float> sample_weights(nnz, 1.f);
+    if (p.with_sample_weights)
+        for (auto &e : sample_weights)
+            e = w_dist(gen);
+
+    memory table_mem({{R, D}, p.table_dt, tag::ab}, eng);
+    const auto table = fill_table(table_mem);
+
+    primitive_attr attr;
+    std::vector<float> scales(p.scales_mask == 1 ? R : 1, 1.f);
+    std::vector<int32_t> zero_points(p.zp_mask == 1 ? R : 1, 0);
+    std::uniform_real_distribution<float> sc_dist(0.01f, 0.1f);
+    std::uniform_int_distribution<int32_t> zp_dist(0, 7);
+    if (p.scales_mask >= 0) {
+        attr.set_scales_mask(DNNL_ARG_WEIGHTS, p.scales_mask);
+        for (auto &e : scales)
+            e = sc_dist(gen);
+    }
+    if (p.zp_mask >= 0) {
+        attr.set_zero_points_mask(DNNL_ARG_WEIGHTS, p.zp_mask);
+        for (auto &e : zero_points)
+            e = zp_dist(gen);
+    }
+
+    auto indices_mem = make_1d_memory(indices, mdt::s32);
+    auto offsets_mem = make_1d_memory(offsets, mdt::s32);
+    memory sw_mem;
+    if (p.with_sample_weights)
+        sw_mem = make_1d_memory(sample_weights, mdt::f32);
+    memory dst_mem({{MB, D}, p.dst_dt, tag::ab}, eng);
+
+    impl::embedding_bag::primitive_desc pd;
+    try {
+        pd = impl::embedding_bag::primitive_desc(eng, p.alg,
+                indices_mem.get_desc(), offsets_mem.get_desc(),
+                table_mem.get_desc(),
+                p.with_sample_weights ? sw_mem.get_desc() : memory::desc(),
+                dst_mem.get_desc(), attr);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, indices_mem},
+            {DNNL_ARG_EMB_OFFSETS, offsets_mem},
+            {DNNL_ARG_WEIGHTS, table_mem}, {DNNL_ARG_DST, dst_mem}};
+    if (p.with_sample_weights) args[DNNL_ARG_EMB_SAMPLE_WEIGHTS] = sw_mem;
+    if (p.scales_mask >= 0)
+        args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS]
+                = make_1d_memory(scales, mdt::f32);
+    if (p.zp_mask >= 0)
+        args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS]
+                = make_1d_memory(zero_points, mdt::s32);
+    impl::embedding_bag(pd).execute(strm, args);
+    strm.wait();
+
+    const float tol = p.dst_dt == mdt::f32 ? 1e-5f : 1e-2f;
+    const auto dst = read_memory(dst_mem);
+    for (memory::dim b = 0; b < MB; b++)
+        for (memory::dim d = 0; d < D; d++) {
+            const int32_t beg = offsets[b], end = offsets[b + 1];
+            const bool is_max = p.alg == algorithm::reduction_max;
+            float ref = is_max ? -FLT_MAX : 0.f;
+            for (int32_t i = beg; i < end; i++) {
+                const auto r = indices[i];
+                const float sc = scales[p.scales_mask == 1 ? r : 0];
+                const float zp = (float)zero_points[p.zp_mask == 1 ? r : 0];
+                const float v = (table[r * D + d] - zp) * sc;
+                ref = is_max ? std::max(ref, v) : ref + sample_weights[i] * v;
+            }
+            if (beg == end)
+                ref = 0.f;
+            else if (p.alg == algorithm::reduction_mean)
+                ref /= (float)(end - beg);
+            const float abs_tol = tol * std::max(1.f, std::fabs(ref));
+            ASSERT_NEAR(dst[b * D + d], ref, abs_tol)
+                    << "b=" << b << " d=" << d;
+        }
+}
+
+TEST_P(embedding_bag_cpu_test_t, TestsBadIndices) {
+    const auto MB = p.batch, D = p.dim, R = p.rows;
+
+    const auto offsets = make_offsets();
+    const auto nnz = (memory::dim)offsets.back();
+    // The last index references a row past the end of the table.
+    std::vector<int32_t> indices(nnz, 0);
+    indices.back() = (int32_t)R;
+
+    auto indices_mem = make_1d_memory(indices, mdt::s32);
+    auto offsets_mem = make_1d_memory(offsets, mdt::s32);
+    memory table_mem({{R, D}, p.table_dt, tag::ab}, eng);
+    memory dst_mem({{MB, D}, p.dst_dt, tag::ab}, eng);
+
+    impl::embedding_bag::primitive_desc pd;
+    try {
+        pd = impl::embedding_bag::primitive_desc(eng, p.alg,
+                indices_mem.get_desc(), offsets_mem.get_desc(),
+                table_mem.get_desc(), memory::desc(), dst_mem.get_desc());
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, indices_mem},
+            {DNNL_ARG_EMB_OFFSETS, offsets_mem},
+            {DNNL_ARG_WEIGHTS, table_mem}, {DNNL_ARG_DST, dst_mem}};
+    EXPECT_THROW(impl::embedding_bag(pd).execute(strm, args), error);
+}
+
+// clang-format off
+#define SUM algorithm::reduction_sum
+#define MEAN algorithm::reduction_mean
+#define MAX algorithm::reduction_max
+INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagCpu, embedding_bag_cpu_test_t,
+        ::testing::Values(
+            //                         MB,  D,   R, bag, alg,  table,     dst,       sw,    sc, zp
+            embedding_bag_cpu_params_t{ 1, 16,  10,  1, SUM,  mdt::f32,  mdt::f32,  false, -1, -1},
+            embedding_bag_cpu_params_t{ 8, 64, 100,  5, SUM,  mdt::f32,  mdt::f32,  false, -1, -1},
+            embedding_bag_cpu_params_t{ 8, 64, 100,  5, SUM,  mdt::f32,  mdt::f32,  true,  -1, -1},
+            embedding_bag_cpu_params_t{ 7, 37, 100,  9, MEAN, mdt::f32,  mdt::f32,  false, -1, -1},
+            embedding_bag_cpu_params_t{ 7, 37, 100,  9, MAX,  mdt::f32,  mdt::f32,  false, -1, -1},
+            embedding_bag_cpu_params_t{ 5, 600, 50,  4, SUM,  mdt::f32,  mdt::f32,  true,  -1, -1},
+            embedding_bag_cpu_params_t{16, 128, 64, 20, SUM,  mdt::bf16, mdt::f32,  true,  -1, -1},
+            embedding_bag_cpu_params_t{16, 128, 64, 20, MEAN, mdt::bf16, mdt::bf16, false, -1, -1},
+            embedding_bag_cpu_params_t{ 6, 40,  64,  7, MAX,  mdt::f16,  mdt::f16,  false, -1, -1},
+            embedding_bag_cpu_params_t{ 9, 64,  80, 12, SUM,  mdt::s8,   mdt::f32,  false,  1, -1},
+            embedding_bag_cpu_params_t{ 9, 64,  80, 12, SUM,  mdt::u8,   mdt::f32,  true,   1,  1},
+            embedding_bag_cpu_params_t{ 9, 50,  80, 12, MEAN, mdt::u8,   mdt::f32,  false,  0,  0},
+            embedding_bag_cpu_params_t{ 9, 64,  80, 12, MAX,  mdt::s8,   mdt::bf16, false,  1, -1},
+            embedding_bag_cpu_params_t{ 9, 64,  80, 12, SUM,  mdt::s4,   mdt::f32,  true,   1, -1},
+            embedding_bag_cpu_params_t{ 9, 64,  80, 12, SUM,  mdt::u4,   mdt::f32,  false,  1,  1},
+            embedding_bag_cpu_params_t{ 4, 256, 40,  6, MEAN, mdt::u4,   mdt::f32,  false,  0,  1},
+            embedding_bag_cpu_params_t{ 4, 24,  40,  6, MAX,  mdt::s4,   mdt::f32,  false,  1, -1}
+        ));
+#undef SUM
+#undef MEAN
+#undef MAX
+// clang-format on
+
+} // namespace dnnl
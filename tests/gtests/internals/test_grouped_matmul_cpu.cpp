@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "grouped_matmul_internal.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct grouped_matmul_cpu_params_t {
+    std::vector<memory::dim> group_sizes;
+    memory::dim K, N;
+    mdt dt;
+    bool wei_transposed;
+};
+
+class grouped_matmul_cpu_test_t
+    : public ::testing::TestWithParam<grouped_matmul_cpu_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        p = GetParam();
+        strm = stream(eng);
+    }
+
+    // Creates a memory of type `dt` filled with values from `data`, which
+    // are given in the row-major order of `dims`.
+    memory make_memory(const memory::dims &dims, mdt dt, tag t,
+            const std::vector<float> &data) {
+        memory::desc f32_md(dims, mdt::f32, tag::ab);
+        memory f32_mem(f32_md, eng);
+        std::copy(data.begin(), data.end(),
+                static_cast<float *>(f32_mem.get_data_handle()));
+        memory mem(memory::desc(dims, dt, t), eng);
+        reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+        strm.wait();
+        return mem;
+    }
+
+    std::vector<float> read_memory(memory &mem) {
+        memory::desc f32_md(mem.get_desc().get_dims(), mdt::f32, tag::ab);
+        memory f32_mem(f32_md, eng);
+        reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+        strm.wait();
+        const float *ptr
+                = static_cast<const float *>(f32_mem.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + f32_md.get_size() / sizeof(float));
+    }
+
+    // Values are small integers, so they are exact in all the tested data
+    // types and the results do not depend on the order of accumulation.
+    std::vector<float> random_data(size_t n) {
+        std::uniform_int_distribution<int> dist(-2, 2);
+        std::vector<float> v(n);
+        for (auto &e : v)
+            e = (float)dist(gen);
+        return v;
+    }
+
+    grouped_matmul_cpu_params_t p;
+    engine eng;
+    stream strm;
+    std::mt19937 gen {2025};
+};
+
+TEST_P(grouped_matmul_cpu_test_t, TestsGroupedMatmul) {
+    const auto G = (memory::dim)p.group_sizes.size();
+    const auto K = p.K, N = p.N;
+
+    std::vector<int32_t> offsets(G + 1, 0);
+    for (memory::dim g = 0; g < G; g++)
+        offsets[g + 1] = offsets[g] + (int32_t)p.group_sizes[g];
+    const memory::dim M = offsets[G];
+
+    const auto src_data = random_data(M * K);
+    auto src_mem = make_memory({M, K}, p.dt, tag::ab, src_data);
+    std::vector<std::vector<float>> wei_data(G);
+    std::vector<memory> wei_mems(G);
+    for (memory::dim g = 0; g < G; g++) {
+        wei_data[g] = random_data(K * N);
+        wei_mems[g] = make_memory({K, N}, p.dt,
+                p.wei_transposed ? tag::ba : tag::ab, wei_data[g]);
+    }
+    memory off_mem({{G + 1}, mdt::s32, tag::a}, eng);
+    std::copy(offsets.begin(), offsets.end(),
+            static_cast<int32_t *>(off_mem.get_data_handle()));
+    memory dst_mem({{M, N}, p.dt, tag::ab}, eng);
+
+    impl::grouped_matmul::primitive_desc pd;
+    try {
+        pd = impl::grouped_matmul::primitive_desc(eng, src_mem.get_desc(),
+                wei_mems[0].get_desc(), dst_mem.get_desc(), G);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_mem},
+            {DNNL_ARG_GROUP_OFFSETS, off_mem}, {DNNL_ARG_DST, dst_mem}};
+    for (memory::dim g = 0; g < G; g++)
+        args[DNNL_ARG_GROUP_WEIGHTS(g)] = wei_mems[g];
+    impl::grouped_matmul(pd).execute(strm, args);
+    strm.wait();
+
+    const auto dst = read_memory(dst_mem);
+    for (memory::dim g = 0; g < G; g++)
+        for (memory::dim m = offsets[g]; m < offsets[g + 1]; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += src_data[m * K + k] * wei_data[g][k * N + n];
+                ASSERT_EQ(dst[m * N + n], ref)
+                        << "g=" << g << " m=" << m << " n=" << n;
+            }
+}
+
+TEST_P(grouped_matmul_cpu_test_t, TestsBadOffsets) {
+    const auto G = (memory::dim)p.group_sizes.size();
+    const auto K = p.K, N = p.N;
+    const memory::dim M = 8;
+
+    memory src_mem({{M, K}, p.dt, tag::ab}, eng);
+    memory wei_mem({{K, N}, p.dt, tag::ab}, eng);
+    memory dst_mem({{M, N}, p.dt, tag::ab}, eng);
+    memory off_mem({{G + 1}, mdt::s32, tag::a}, eng);
+
+    impl::grouped_matmul::primitive_desc pd;
+    try {
+        pd = impl::grouped_matmul::primitive_desc(eng, src_mem.get_desc(),
+                wei_mem.get_desc(), dst_mem.get_desc(), G);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    // The last group ends past the rows of the source.
+    auto offsets = static_cast<int32_t *>(off_mem.get_data_handle());
+    for (memory::dim g = 0; g <= G; g++)
+        offsets[g] = (int32_t)(g * (M + 1) / G);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_mem},
+            {DNNL_ARG_GROUP_OFFSETS, off_mem}, {DNNL_ARG_DST, dst_mem}};
+    for (memory::dim g = 0; g < G; g++)
+        args[DNNL_ARG_GROUP_WEIGHTS(g)] = wei_mem;
+    EXPECT_THROW(impl::grouped_matmul(pd).execute(strm, args), error);
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(TestGroupedMatmulCpu, grouped_matmul_cpu_test_t,
+        ::testing::Values(
+            //                           group sizes,        K,   N,  dt,        wei_t
+            grouped_matmul_cpu_params_t{{5},                 16,  24, mdt::f32,  false},
+            grouped_matmul_cpu_params_t{{1, 0, 33, 7, 64},   32,  64, mdt::f32,  false},
+            grouped_matmul_cpu_params_t{{300, 3, 0, 129},    48, 130, mdt::f32,  false},
+            grouped_matmul_cpu_params_t{{17, 2, 65},         40,  70, mdt::f32,  true},
+            grouped_matmul_cpu_params_t{{0, 31, 9},          64,  96, mdt::bf16, false},
+            grouped_matmul_cpu_params_t{{12, 1, 40},         24,  65, mdt::f16,  true},
+            grouped_matmul_cpu_params_t{{7, 20},             33,  48, mdt::bf16, true},
+            grouped_matmul_cpu_params_t{{9, 0, 70},          17,  32, mdt::f16,  false}
+        ));
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdlib>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/dnnl_thread.hpp"
+#include "src/cpu/platform.hpp"
+
+// Note: the control is read once per binary run, so it is set at the
+// initialization of the binary and stays enabled for all the tests.
+
+namespace dnnl {
+
+namespace platform = impl::cpu::platform;
+
+namespace {
+
+size_t page_size() {
+    return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+const bool first_touch_env_set
+        = ::setenv("ONEDNN_CPU_NUMA_FIRST_TOUCH", "1", 1) == 0;
+
+// The pages are touched from several threads only: a single thread would put
+// them on its own node anyway.
+bool has_several_threads() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    if (omp_get_max_threads() < 4) omp_set_num_threads(4);
+#endif
+    return dnnl_get_max_threads() > 1;
+}
+
+// Returns the residency of the pages of a page-aligned buffer.
+std::vector<bool> resident_pages(const void *ptr, size_t size) {
+    const size_t npages = size / page_size();
+    std::vector<unsigned char> vec(npages);
+    std::vector<bool> res(npages, false);
+    if (mincore(const_cast<void *>(ptr), npages * page_size(), vec.data()))
+        return res;
+    for (size_t i = 0; i < npages; i++)
+        res[i] = vec[i] & 1;
+    return res;
+}
+
+// An anonymous mapping gets physical pages at the first access only.
+struct mapping_t {
+    mapping_t(size_t size) : size_(size) {
+        ptr_ = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr_ == MAP_FAILED) ptr_ = nullptr;
+    }
+    ~mapping_t() {
+        if (ptr_) munmap(ptr_, size_);
+    }
+    char *get() const { return (char *)ptr_; }
+
+    void *ptr_;
+    size_t size_;
+};
+
+} // namespace
+
+TEST(numa_first_touch_test, TestEnabled) {
+    ASSERT_TRUE(first_touch_env_set);
+    ASSERT_TRUE(platform::is_numa_first_touch_enabled());
+}
+
+TEST(numa_first_touch_test, TestTouchesAllPages) {
+    SKIP_IF(!has_several_threads(), "First touch requires several threads");
+
+    const size_t npages = 64, size = npages * page_size();
+    mapping_t m(size);
+    ASSERT_NE(m.get(), nullptr);
+    for (bool r : resident_pages(m.get(), size))
+        ASSERT_FALSE(r);
+
+    platform::numa_first_touch(m.get(), size);
+    for (bool r : resident_pages(m.get(), size))
+        EXPECT_TRUE(r);
+}
+
+TEST(numa_first_touch_test, TestUnalignedBuffer) {
+    SKIP_IF(!has_several_threads(), "First touch requires several threads");
+
+    // The partial first page is left to the thread touching the buffer
+    // header, while the partial last page is touched.
+    const size_t npages = 64, size = npages * page_size();
+    const size_t offset = 100;
+    mapping_t m(size);
+    ASSERT_NE(m.get(), nullptr);
+
+    platform::numa_first_touch(m.get() + offset, size - 2 * offset);
+    const auto res = resident_pages(m.get(), size);
+    EXPECT_FALSE(res[0]);
+    for (size_t i = 1; i < npages; i++)
+        EXPECT_TRUE(res[i]);
+}
+
+TEST(numa_first_touch_test, TestEmptyBuffer) {
+    platform::numa_first_touch(nullptr, 0);
+    platform::numa_first_touch(nullptr, 16 * page_size());
+}
+
+// Memory allocated by the library is touched at creation, and the data
+// written afterwards is not affected.
+TEST(numa_first_touch_test, TestMemoryObjects) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "NUMA first touch is supported on CPU only");
+    SKIP_IF(!has_several_threads(), "First touch requires several threads");
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    // The buffers are larger than the maximum threshold of allocations with
+    // a fresh mapping in glibc (32 MB).
+    const memory::dim C = 48, H = 512, W = 512;
+    memory::desc plain_md({1, C, H, W}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    memory::desc blocked_md({1, C, H, W}, memory::data_type::f32,
+            memory::format_tag::nChw16c);
+    memory plain(plain_md, eng), blocked(blocked_md, eng),
+            result(plain_md, eng);
+
+    // Skip the first page, which may be shared with the allocator header.
+    const size_t size = blocked_md.get_size();
+    char *base = (char *)blocked.get_data_handle();
+    char *first_page = (char *)(((size_t)base + page_size() - 1)
+            & ~(page_size() - 1));
+    const size_t npages = (base + size - first_page) / page_size();
+    for (bool r : resident_pages(first_page, npages * page_size()))
+        ASSERT_TRUE(r);
+
+    const size_t nelems = (size_t)(C * H * W);
+    float *plain_ptr = (float *)plain.get_data_handle();
+    for (size_t i = 0; i < nelems; i++)
+        plain_ptr[i] = (float)(i % 1013);
+
+    reorder(plain, blocked).execute(strm, plain, blocked);
+    reorder(blocked, result).execute(strm, blocked, result);
+    strm.wait();
+
+    const float *result_ptr = (const float *)result.get_data_handle();
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(result_ptr[i], plain_ptr[i]);
+}
+
+} // namespace dnnl
@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdlib>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "src/cpu/packed_weights_cache.hpp"
+
+// Note: the cache capacity is read once per binary run, so it is set at the
+// initialization of the binary and the cache is shared by all the tests.
+//
+// Weights modified through the buffer passed at the memory object creation
+// are not tracked by the cache, which lets the tests tell a cache hit from a
+// miss: a hit computes the result with the weights packed before the
+// modification.
+
+namespace dnnl {
+
+namespace {
+
+const bool capacity_env_set = []() {
+#ifdef _WIN32
+    return _putenv_s("ONEDNN_CPU_PACKED_WEIGHTS_CACHE_CAPACITY", "64") == 0;
+#else
+    return ::setenv("ONEDNN_CPU_PACKED_WEIGHTS_CACHE_CAPACITY", "64", 1) == 0;
+#endif
+}();
+
+size_t cache_size() {
+    return impl::cpu::packed_weights_cache().size();
+}
+
+const memory::dim M = 16, K = 64, N = 64;
+
+void fill(float *ptr, float value) {
+    for (memory::dim i = 0; i < K * N; i++)
+        ptr[i] = value;
+}
+
+class packed_weights_cache_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "The packed weights cache is supported on CPU only");
+        ASSERT_TRUE(capacity_env_set);
+        ASSERT_TRUE(impl::cpu::packed_weights_cache().is_enabled());
+
+        eng_ = engine(engine::kind::cpu, 0);
+        strm_ = stream(eng_);
+
+        // Transposed weights are packed by the implementations using the
+        // cache.
+        src_md_ = memory::desc(
+                {M, K}, memory::data_type::f32, memory::format_tag::ab);
+        wei_md_ = memory::desc(
+                {K, N}, memory::data_type::f32, memory::format_tag::ba);
+        dst_md_ = memory::desc(
+                {M, N}, memory::data_type::f32, memory::format_tag::ab);
+        src_ = memory(src_md_, eng_);
+        float *src_ptr = (float *)src_.get_data_handle();
+        for (memory::dim i = 0; i < M * K; i++)
+            src_ptr[i] = (float)(i % 7 - 3);
+
+        auto pd = matmul::primitive_desc(eng_, src_md_, wei_md_, dst_md_);
+        matmul_ = matmul(pd);
+        other_matmul_ = matmul(
+                matmul::primitive_desc(eng_, src_md_, wei_md_, dst_md_));
+
+        buf_.assign(K * N, 1.f);
+        wei_ = memory(wei_md_, eng_, buf_.data());
+        const size_t size = cache_size();
+        check(matmul_, wei_, 1.f);
+        SKIP_IF(cache_size() == size, "The implementation doesn't cache weights");
+    }
+
+    // Returns the single value expected in the destination row `m` for
+    // weights filled with `value`.
+    float expected(memory::dim m, float value) const {
+        const float *src_ptr = (const float *)src_.get_data_handle();
+        float sum = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            sum += src_ptr[m * K + k] * value;
+        return sum;
+    }
+
+    // Executes `p` and checks that the result corresponds to the weights
+    // filled with `value`.
+    void check(const matmul &p, const memory &wei, float value) {
+        memory dst(dst_md_, eng_);
+        p.execute(strm_,
+                {{DNNL_ARG_SRC, src_}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm_.wait();
+        const float *dst_ptr = (const float *)dst.get_data_handle();
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++)
+                ASSERT_EQ(dst_ptr[m * N + n], expected(m, value));
+    }
+
+    engine eng_;
+    stream strm_;
+    memory::desc src_md_, wei_md_, dst_md_;
+    memory src_;
+    matmul matmul_, other_matmul_;
+
+    // Weights filled with ones and packed into the cache by `matmul_`.
+    std::vector<float> buf_;
+    memory wei_;
+};
+
+} // namespace
+
+TEST_F(packed_weights_cache_test_t, TestHit) {
+    const size_t size = cache_size();
+    fill(buf_.data(), 2.f);
+    check(matmul_, wei_, 1.f);
+
+    // Another primitive with the same configuration shares the entry.
+    check(other_matmul_, wei_, 1.f);
+    EXPECT_EQ(cache_size(), size);
+}
+
+TEST_F(packed_weights_cache_test_t, TestMissNewMemory) {
+    // Entries are not matched by the data address.
+    fill(buf_.data(), 2.f);
+    check(matmul_, memory(wei_md_, eng_, buf_.data()), 2.f);
+}
+
+TEST_F(packed_weights_cache_test_t, TestDropOnDestruction) {
+    // The entries of a destroyed memory object are dropped, so the address of
+    // its buffer can be reused by other weights.
+    const size_t size = cache_size();
+    {
+        memory wei(wei_md_, eng_);
+        fill((float *)wei.get_data_handle(), 3.f);
+        check(matmul_, wei, 3.f);
+        ASSERT_GT(cache_size(), size);
+    }
+    EXPECT_EQ(cache_size(), size);
+
+    wei_ = memory();
+    EXPECT_LT(cache_size(), size);
+}
+
+TEST_F(packed_weights_cache_test_t, TestMissAfterGetDataHandle) {
+    fill((float *)wei_.get_data_handle(), 2.f);
+    check(matmul_, wei_, 2.f);
+
+    // The weights are packed again and cached for the next executions.
+    fill(buf_.data(), 3.f);
+    check(matmul_, wei_, 2.f);
+}
+
+TEST_F(packed_weights_cache_test_t, TestMissAfterSetDataHandle) {
+    fill(buf_.data(), 2.f);
+    wei_.set_data_handle(buf_.data());
+    check(matmul_, wei_, 2.f);
+}
+
+TEST_F(packed_weights_cache_test_t, TestMissAfterUnmap) {
+    float *mapped_ptr = wei_.map_data<float>();
+    fill(mapped_ptr, 2.f);
+    wei_.unmap_data(mapped_ptr);
+    check(matmul_, wei_, 2.f);
+}
+
+TEST_F(packed_weights_cache_test_t, TestMissAfterPrimitiveOutput) {
+    memory plain(memory::desc({K, N}, memory::data_type::f32,
+                         memory::format_tag::ab),
+            eng_);
+    fill((float *)plain.get_data_handle(), 2.f);
+    reorder(plain, wei_).execute(strm_, plain, wei_);
+    strm_.wait();
+    check(matmul_, wei_, 2.f);
+}
+
+TEST_F(packed_weights_cache_test_t, TestNoMissOnOtherOutputs) {
+    // Writes to other memory objects, including the destination of the
+    // matmul itself, don't invalidate the packed weights.
+    fill(buf_.data(), 2.f);
+    memory other(wei_md_, eng_);
+    reorder(wei_, other).execute(strm_, wei_, other);
+    strm_.wait();
+    check(matmul_, wei_, 1.f);
+}
+
+} // namespace dnnl
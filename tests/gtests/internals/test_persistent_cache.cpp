@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/persistent_cache.hpp"
+
+// Note: the cache directory is read once per binary run, so all the tests
+// share it. They run in the order of definition and the last one removes it.
+
+namespace dnnl {
+
+namespace pc = impl::persistent_cache;
+
+namespace {
+
+const std::string &cache_dir() {
+    static const std::string dir = []() {
+        // Upper case letters check that the path is used as is.
+        char path[] = "/tmp/dnnl_Persistent_Cache_XXXXXX";
+        if (!mkdtemp(path)) return std::string();
+        ::setenv("ONEDNN_PERSISTENT_CACHE_DIR", path, 1);
+        return std::string(path);
+    }();
+    return dir;
+}
+
+std::vector<std::string> cache_entries() {
+    std::vector<std::string> entries;
+    DIR *d = opendir(cache_dir().c_str());
+    if (!d) return entries;
+    while (const dirent *e = readdir(d)) {
+        const std::string name = e->d_name;
+        const std::string ext = ".blob";
+        if (name.size() > ext.size()
+                && name.compare(name.size() - ext.size(), ext.size(), ext)
+                        == 0)
+            entries.push_back(cache_dir() + "/" + name);
+    }
+    closedir(d);
+    return entries;
+}
+
+// Entries are written on a background thread, so wait for the entry to
+// appear.
+bool wait_and_load(const std::vector<uint8_t> &id, std::vector<uint8_t> &blob) {
+    for (int i = 0; i < 1000; i++) {
+        if (pc::load(id, blob)) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+void write_file(const std::string &path, const std::vector<char> &content) {
+    FILE *f = fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fwrite(content.data(), 1, content.size(), f), content.size());
+    ASSERT_EQ(fclose(f), 0);
+}
+
+std::vector<char> read_file(const std::string &path) {
+    std::vector<char> content;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return content;
+    char buf[256];
+    size_t n = 0;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        content.insert(content.end(), buf, buf + n);
+    fclose(f);
+    return content;
+}
+
+const std::vector<uint8_t> id_a {1, 2, 3, 4, 5};
+const std::vector<uint8_t> id_b {5, 4, 3, 2, 1};
+
+} // namespace
+
+TEST(persistent_cache_test, TestStoreLoad) {
+    ASSERT_FALSE(cache_dir().empty());
+    ASSERT_EQ(pc::get_dir(), cache_dir());
+    ASSERT_TRUE(pc::is_enabled());
+
+    std::vector<uint8_t> blob;
+    EXPECT_FALSE(pc::load(id_a, blob));
+    EXPECT_TRUE(blob.empty());
+
+    const std::vector<uint8_t> blob_a {10, 20, 30, 40};
+    pc::store(id_a, std::vector<uint8_t>(blob_a));
+    ASSERT_TRUE(wait_and_load(id_a, blob));
+    EXPECT_EQ(blob, blob_a);
+    EXPECT_EQ(cache_entries().size(), 1u);
+
+    // Another ID misses the entry.
+    EXPECT_FALSE(pc::load(id_b, blob));
+
+    // Empty IDs and blobs are not stored.
+    pc::store(id_b, std::vector<uint8_t>());
+    pc::store(std::vector<uint8_t>(), std::vector<uint8_t>(blob_a));
+
+    // A new blob for the same ID replaces the entry.
+    const std::vector<uint8_t> blob_b {7, 7, 7};
+    pc::store(id_a, std::vector<uint8_t>(blob_b));
+    for (int i = 0; i < 1000 && blob != blob_b; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        pc::load(id_a, blob);
+    }
+    EXPECT_EQ(blob, blob_b);
+    EXPECT_FALSE(pc::load(id_b, blob));
+}
+
+TEST(persistent_cache_test, TestCorruptedEntry) {
+    const std::vector<uint8_t> blob_a(100, 42);
+    pc::store(id_a, std::vector<uint8_t>(blob_a));
+
+    std::vector<uint8_t> blob;
+    for (int i = 0; i < 1000 && blob != blob_a; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        pc::load(id_a, blob);
+    }
+    ASSERT_EQ(blob, blob_a);
+
+    const auto entries = cache_entries();
+    ASSERT_EQ(entries.size(), 1u);
+    const std::vector<char> content = read_file(entries[0]);
+    ASSERT_FALSE(content.empty());
+
+    // Truncated entry.
+    write_file(entries[0],
+            std::vector<char>(content.begin(),
+                    content.begin() + content.size() / 2));
+    EXPECT_FALSE(pc::load(id_a, blob));
+    EXPECT_TRUE(blob.empty());
+
+    // Entry with an extra byte.
+    std::vector<char> longer = content;
+    longer.push_back(0);
+    write_file(entries[0], longer);
+    EXPECT_FALSE(pc::load(id_a, blob));
+
+    // Entry with a wrong magic.
+    std::vector<char> bad_magic = content;
+    bad_magic[0] = 'X';
+    write_file(entries[0], bad_magic);
+    EXPECT_FALSE(pc::load(id_a, blob));
+
+    // Empty entry.
+    write_file(entries[0], std::vector<char>());
+    EXPECT_FALSE(pc::load(id_a, blob));
+
+    // A valid entry is written back.
+    pc::store(id_a, std::vector<uint8_t>(blob_a));
+    ASSERT_TRUE(wait_and_load(id_a, blob));
+    EXPECT_EQ(blob, blob_a);
+}
+
+TEST(persistent_cache_test, TestMissingDirectory) {
+    for (const auto &e : cache_entries())
+        ASSERT_EQ(std::remove(e.c_str()), 0);
+    ASSERT_EQ(rmdir(cache_dir().c_str()), 0);
+
+    std::vector<uint8_t> blob;
+    EXPECT_FALSE(pc::load(id_a, blob));
+
+    // The write fails with a warning and doesn't create the directory.
+    pc::store(id_a, std::vector<uint8_t>(10, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(pc::load(id_a, blob));
+    EXPECT_EQ(opendir(cache_dir().c_str()), nullptr);
+}
+
+} // namespace dnnl
@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "rope_internal.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct rope_cpu_params_t {
+    memory::dim B, H, S, D, R, P;
+    mdt dt;
+    bool interleaved;
+    bool with_positions;
+    bool in_place;
+};
+
+class rope_cpu_test_t : public ::testing::TestWithParam<rope_cpu_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        p = GetParam();
+        strm = stream(eng);
+    }
+
+    memory make_memory(const memory::dims &dims, mdt dt,
+            const std::vector<float> &data) {
+        memory::desc f32_md(dims, mdt::f32, tag::abcd);
+        memory f32_mem(f32_md, eng);
+        std::copy(data.begin(), data.end(),
+                static_cast<float *>(f32_mem.get_data_handle()));
+        memory mem(memory::desc(dims, dt, tag::abcd), eng);
+        reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+        strm.wait();
+        return mem;
+    }
+
+    std::vector<float> read_memory(memory &mem) {
+        memory::desc f32_md(mem.get_desc().get_dims(), mdt::f32, tag::abcd);
+        memory f32_mem(f32_md, eng);
+        reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+        strm.wait();
+        const float *ptr
+                = static_cast<const float *>(f32_mem.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + f32_md.get_size() / sizeof(float));
+    }
+
+    rope_cpu_params_t p;
+    engine eng;
+    stream strm;
+    std::mt19937 gen {2025};
+};
+
+TEST_P(rope_cpu_test_t, TestsRope) {
+    const auto B = p.B, H = p.H, S = p.S, D = p.D, R = p.R, P = p.P;
+    const auto R2 = R / 2;
+
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> src_data(B * H * S * D);
+    for (auto &e : src_data)
+        e = dist(gen);
+    auto src_mem = make_memory({B, H, S, D}, p.dt, src_data);
+    // The reference uses the source rounded to the tested data type.
+    src_data = read_memory(src_mem);
+
+    memory::desc tab_md({P, R2}, mdt::f32, tag::ab);
+    memory cos_mem(tab_md, eng), sin_mem(tab_md, eng);
+    auto cos_ptr = static_cast<float *>(cos_mem.get_data_handle());
+    auto sin_ptr = static_cast<float *>(sin_mem.get_data_handle());
+    for (memory::dim pos = 0; pos < P; pos++)
+        for (memory::dim i = 0; i < R2; i++) {
+            const float theta = std::pow(10000.f, -2.f * i / R);
+            cos_ptr[pos * R2 + i] = std::cos(pos * theta);
+            sin_ptr[pos * R2 + i] = std::sin(pos * theta);
+        }
+
+    std::vector<int32_t> positions(B, 0);
+    memory::desc pos_md;
+    memory pos_mem;
+    if (p.with_positions) {
+        std::uniform_int_distribution<int32_t> pos_dist(0, (int32_t)(P - S));
+        for (auto &e : positions)
+            e = pos_dist(gen);
+        pos_md = memory::desc({B}, mdt::s32, tag::a);
+        pos_mem = memory(pos_md, eng);
+        std::copy(positions.begin(), positions.end(),
+                static_cast<int32_t *>(pos_mem.get_data_handle()));
+    }
+
+    auto dst_mem = p.in_place ? src_mem : memory(src_mem.get_desc(), eng);
+
+    impl::rope::primitive_desc pd;
+    try {
+        pd = impl::rope::primitive_desc(eng, src_mem.get_desc(),
+                cos_mem.get_desc(), sin_mem.get_desc(), pos_md,
+                dst_mem.get_desc(), p.interleaved);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_mem},
+            {DNNL_ARG_ROPE_COS, cos_mem}, {DNNL_ARG_ROPE_SIN, sin_mem},
+            {DNNL_ARG_DST, dst_mem}};
+    if (p.with_positions) args[DNNL_ARG_ROPE_POSITIONS] = pos_mem;
+    impl::rope(pd).execute(strm, args);
+    strm.wait();
+
+    const float tol = p.dt == mdt::f32 ? 1e-6f : 1e-2f;
+    const auto dst = read_memory(dst_mem);
+    for (memory::dim b = 0; b < B; b++)
+        for (memory::dim h = 0; h < H; h++)
+            for (memory::dim s = 0; s < S; s++) {
+                const auto off = ((b * H + h) * S + s) * D;
+                const auto pos = positions[b] + s;
+                for (memory::dim d = 0; d < D; d++) {
+                    float ref = src_data[off + d];
+                    if (d < R) {
+                        const bool first = p.interleaved ? d % 2 == 0 : d < R2;
+                        const auto i = p.interleaved ? d / 2 : d % R2;
+                        const auto pair = p.interleaved
+                                ? (first ? d + 1 : d - 1)
+                                : (first ? d + R2 : d - R2);
+                        const float c = cos_ptr[pos * R2 + i];
+                        const float sn = sin_ptr[pos * R2 + i];
+                        const float x = src_data[off + d];
+                        const float y = src_data[off + pair];
+                        ref = first ? x * c - y * sn : x * c + y * sn;
+                    }
+                    ASSERT_NEAR(dst[off + d], ref, tol)
+                            << "b=" << b << " h=" << h << " s=" << s
+                            << " d=" << d;
+                }
+            }
+}
+
+TEST_P(rope_cpu_test_t, TestsBadPositions) {
+    SKIP_IF(!p.with_positions, "The test requires positions");
+    const auto B = p.B, H = p.H, S = p.S, D = p.D, R = p.R, P = p.P;
+
+    memory src_mem({{B, H, S, D}, p.dt, tag::abcd}, eng);
+    memory::desc tab_md({P, R / 2}, mdt::f32, tag::ab);
+    memory cos_mem(tab_md, eng), sin_mem(tab_md, eng);
+    memory pos_mem({{B}, mdt::s32, tag::a}, eng);
+    memory dst_mem(src_mem.get_desc(), eng);
+
+    impl::rope::primitive_desc pd;
+    try {
+        pd = impl::rope::primitive_desc(eng, src_mem.get_desc(),
+                cos_mem.get_desc(), sin_mem.get_desc(), pos_mem.get_desc(),
+                dst_mem.get_desc(), p.interleaved);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    // The last sequence runs past the end of the tables.
+    auto positions = static_cast<int32_t *>(pos_mem.get_data_handle());
+    for (memory::dim b = 0; b < B; b++)
+        positions[b] = (int32_t)(P - S + (b == B - 1));
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_mem},
+            {DNNL_ARG_ROPE_COS, cos_mem}, {DNNL_ARG_ROPE_SIN, sin_mem},
+            {DNNL_ARG_ROPE_POSITIONS, pos_mem}, {DNNL_ARG_DST, dst_mem}};
+    EXPECT_THROW(impl::rope(pd).execute(strm, args), error);
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(TestRopeCpu, rope_cpu_test_t,
+        ::testing::Values(
+            //                B, H,  S,   D,   R,   P,  dt,        inter, pos,   in_place
+            rope_cpu_params_t{1, 1,  1,  16,  16,  16, mdt::f32,  false, false, false},
+            rope_cpu_params_t{2, 4,  7,  64,  64,  32, mdt::f32,  false, false, false},
+            rope_cpu_params_t{2, 4,  7,  64,  64,  32, mdt::f32,  true,  false, false},
+            rope_cpu_params_t{3, 2, 13, 128,  64,  64, mdt::f32,  false, true,  false},
+            rope_cpu_params_t{3, 2, 13, 128,  64,  64, mdt::f32,  true,  true,  true},
+            rope_cpu_params_t{2, 3,  5,  80,  42,  16, mdt::f32,  false, false, true},
+            rope_cpu_params_t{2, 3,  5,  80,  42,  16, mdt::f32,  true,  true,  false},
+            rope_cpu_params_t{4, 8,  1, 128, 128, 256, mdt::f32,  false, true,  false},
+            rope_cpu_params_t{2, 4, 17, 128, 128,  32, mdt::bf16, false, false, false},
+            rope_cpu_params_t{2, 4, 17, 128, 128,  32, mdt::bf16, true,  true,  true},
+            rope_cpu_params_t{2, 2,  9,  96,  96,  16, mdt::f16,  false, true,  false},
+            rope_cpu_params_t{2, 2,  9,  96,  32,  16, mdt::f16,  true,  false, true}
+        ));
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,221 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "sdpa_internal.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+enum class cpu_mask_t { none, buffer, causal_tl, causal_br };
+
+struct sdpa_cpu_params_t {
+    memory::dim mb, heads, kv_heads, queries, keys, head_size;
+    mdt dt;
+    bool key_transposed;
+    cpu_mask_t mask;
+};
+
+class sdpa_cpu_test_t : public ::testing::TestWithParam<sdpa_cpu_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        p = GetParam();
+        strm = stream(eng);
+    }
+
+    // Creates a memory of type `dt` filled with values from `data`.
+    memory make_memory(const memory::dims &dims, mdt dt, tag t,
+            const std::vector<float> &data) {
+        memory::desc f32_md(dims, mdt::f32, t);
+        memory f32_mem(f32_md, eng);
+        std::copy(data.begin(), data.end(),
+                static_cast<float *>(f32_mem.get_data_handle()));
+        memory mem(memory::desc(dims, dt, t), eng);
+        reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+        strm.wait();
+        return mem;
+    }
+
+    std::vector<float> read_memory(memory &mem) {
+        memory::desc f32_md(mem.get_desc().get_dims(), mdt::f32,
+                mem.get_desc().get_strides());
+        memory f32_mem(f32_md, eng);
+        reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+        strm.wait();
+        const float *ptr
+                = static_cast<const float *>(f32_mem.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + f32_md.get_size() / sizeof(float));
+    }
+
+    // Rounds values through the tested data type so that the reference sees
+    // exactly the same inputs as the primitive.
+    std::vector<float> random_data(size_t n, mdt dt) {
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        std::vector<float> v(n);
+        for (auto &e : v)
+            e = dist(gen);
+        memory::desc md({(memory::dim)n}, mdt::f32, tag::a);
+        memory f32_mem(md, eng, v.data());
+        memory dt_mem({{(memory::dim)n}, dt, tag::a}, eng);
+        reorder(f32_mem, dt_mem).execute(strm, f32_mem, dt_mem);
+        reorder(dt_mem, f32_mem).execute(strm, dt_mem, f32_mem);
+        strm.wait();
+        return v;
+    }
+
+    sdpa_cpu_params_t p;
+    engine eng;
+    stream strm;
+    std::mt19937 gen {2025};
+};
+
+TEST_P(sdpa_cpu_test_t, TestsSdpa) {
+    const auto mb = p.mb, H = p.heads, Hkv = p.kv_heads, Q = p.queries,
+               K = p.keys, D = p.head_size;
+
+    const auto q_data = random_data(mb * H * Q * D, p.dt);
+    const auto k_data = random_data(mb * Hkv * D * K, p.dt);
+    const auto v_data = random_data(mb * Hkv * K * D, p.dt);
+    std::vector<float> msk_data(Q * K);
+    for (auto &e : msk_data)
+        e = (gen() % 4 == 0) ? -INFINITY : 0.f;
+
+    // Keys are logically {mb, Hkv, D, K}; the transposed layout stores them
+    // as {mb, Hkv, K, D} physically.
+    auto q_mem = make_memory({mb, H, Q, D}, p.dt, tag::abcd, q_data);
+    std::vector<float> k_phys(k_data.size());
+    for (memory::dim n = 0; n < mb * Hkv; n++)
+        for (memory::dim d = 0; d < D; d++)
+            for (memory::dim k = 0; k < K; k++) {
+                const auto lidx = (n * D + d) * K + k;
+                const auto pidx = p.key_transposed ? (n * K + k) * D + d : lidx;
+                k_phys[pidx] = k_data[lidx];
+            }
+    auto k_mem = make_memory({mb, Hkv, D, K}, p.dt,
+            p.key_transposed ? tag::abdc : tag::abcd, k_phys);
+    auto v_mem = make_memory({mb, Hkv, K, D}, p.dt, tag::abcd, v_data);
+    auto msk_mem = make_memory({1, 1, Q, K}, mdt::f32, tag::abcd, msk_data);
+    const float scale_val = std::sqrt((float)D);
+    auto scale_mem = make_memory({1}, mdt::f32, tag::a, {scale_val});
+    memory dst_mem({{mb, H, Q, D}, p.dt, tag::abcd}, eng);
+
+    int mask_type = 0;
+    switch (p.mask) {
+        case cpu_mask_t::none: mask_type = 0; break;
+        case cpu_mask_t::buffer: mask_type = 1; break;
+        case cpu_mask_t::causal_tl: mask_type = 2; break;
+        case cpu_mask_t::causal_br: mask_type = 3; break;
+    }
+    const bool with_buffer_mask = p.mask == cpu_mask_t::buffer;
+    memory::desc msk_md = msk_mem.get_desc();
+
+    impl::sdpa::primitive_desc pd;
+    try {
+        pd = impl::sdpa::primitive_desc(eng, q_mem.get_desc(),
+                k_mem.get_desc(), v_mem.get_desc(),
+                with_buffer_mask ? &msk_md : nullptr, mdt::f32,
+                dst_mem.get_desc(), /* invert_scale = */ true, Hkv, mask_type);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, q_mem},
+            {DNNL_ARG_KEYS, k_mem}, {DNNL_ARG_VALUES, v_mem},
+            {DNNL_ARG_SCALE, scale_mem}, {DNNL_ARG_DST, dst_mem}};
+    if (with_buffer_mask) args[DNNL_ARG_ATTN_MASK] = msk_mem;
+    impl::sdpa(pd).execute(strm, args);
+    strm.wait();
+
+    const auto dst = read_memory(dst_mem);
+    const float tol = p.dt == mdt::f32 ? 1e-5f : 2e-2f;
+    std::vector<double> s(K);
+    for (memory::dim n = 0; n < mb; n++)
+        for (memory::dim h = 0; h < H; h++) {
+            const auto hk = h / (H / Hkv);
+            for (memory::dim i = 0; i < Q; i++) {
+                double mx = -INFINITY;
+                for (memory::dim j = 0; j < K; j++) {
+                    double acc = 0;
+                    for (memory::dim d = 0; d < D; d++)
+                        acc += (double)q_data[((n * H + h) * Q + i) * D + d]
+                                * k_data[((n * Hkv + hk) * D + d) * K + j];
+                    acc /= scale_val;
+                    if (with_buffer_mask) acc += msk_data[i * K + j];
+                    const auto shift = p.mask == cpu_mask_t::causal_br
+                            ? K - Q
+                            : memory::dim(0);
+                    if ((p.mask == cpu_mask_t::causal_tl
+                                || p.mask == cpu_mask_t::causal_br)
+                            && j > i + shift)
+                        acc = -INFINITY;
+                    s[j] = acc;
+                    mx = std::max(mx, acc);
+                }
+                double sum = 0;
+                for (memory::dim j = 0; j < K; j++) {
+                    s[j] = mx == -INFINITY ? 0. : std::exp(s[j] - mx);
+                    sum += s[j];
+                }
+                for (memory::dim d = 0; d < D; d++) {
+                    double acc = 0;
+                    for (memory::dim j = 0; j < K; j++)
+                        acc += s[j] * v_data[((n * Hkv + hk) * K + j) * D + d];
+                    const double ref = sum > 0 ? acc / sum : 0.;
+                    const float got = dst[((n * H + h) * Q + i) * D + d];
+                    ASSERT_NEAR(got, ref, tol * std::max(1., std::fabs(ref)))
+                            << "mb=" << n << " h=" << h << " q=" << i
+                            << " d=" << d;
+                }
+            }
+        }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpu, sdpa_cpu_test_t,
+        ::testing::Values(
+            //                  mb, H, Hkv,  Q,   K,  D,  dt,      key_t,  mask
+            sdpa_cpu_params_t{   1, 2,   2, 17,  33, 16, mdt::f32,  false, cpu_mask_t::none},
+            sdpa_cpu_params_t{   2, 4,   2, 70, 150, 32, mdt::f32,  true,  cpu_mask_t::buffer},
+            sdpa_cpu_params_t{   1, 2,   1, 65, 200, 64, mdt::f32,  false, cpu_mask_t::causal_tl},
+            sdpa_cpu_params_t{   1, 2,   2,  1, 300, 64, mdt::f32,  true,  cpu_mask_t::causal_br},
+            sdpa_cpu_params_t{   1, 3,   3, 40, 140, 32, mdt::f32,  false, cpu_mask_t::causal_br},
+            sdpa_cpu_params_t{   1, 2,   2, 33,  65, 32, mdt::bf16, true,  cpu_mask_t::buffer},
+            sdpa_cpu_params_t{   1, 4,   2, 64, 129, 64, mdt::f16,  false, cpu_mask_t::causal_tl},
+            sdpa_cpu_params_t{   2, 2,   1, 20,  70, 40, mdt::f16,  true,  cpu_mask_t::none}
+        ));
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "top_k_internal.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+
+struct top_k_cpu_params_t {
+    memory::dims dims;
+    int axis;
+    memory::dim k;
+    algorithm alg;
+    mdt src_dt, dst_dt;
+};
+
+class top_k_cpu_test_t : public ::testing::TestWithParam<top_k_cpu_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        p = GetParam();
+        strm = stream(eng);
+    }
+
+    memory::dims dst_dims() const {
+        auto dims = p.dims;
+        dims[p.axis] = p.k;
+        return dims;
+    }
+
+    // Fills the source with halves of small integers: they are exact in all
+    // the tested data types and produce plenty of ties.
+    std::vector<float> fill_src(memory &src_mem) {
+        const auto nelems = product(p.dims);
+        std::uniform_int_distribution<int> dist(-100, 100);
+        memory f32_mem(
+                {p.dims, mdt::f32, src_mem.get_desc().get_strides()}, eng);
+        auto ptr = static_cast<float *>(f32_mem.get_data_handle());
+        for (memory::dim i = 0; i < nelems; i++)
+            ptr[i] = 0.5f * (float)dist(gen);
+        reorder(f32_mem, src_mem).execute(strm, f32_mem, src_mem);
+        strm.wait();
+        return std::vector<float>(ptr, ptr + nelems);
+    }
+
+    std::vector<float> read_memory(memory &mem) {
+        const auto &md = mem.get_desc();
+        memory f32_mem({md.get_dims(), mdt::f32, md.get_strides()}, eng);
+        reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+        strm.wait();
+        const float *ptr
+                = static_cast<const float *>(f32_mem.get_data_handle());
+        return std::vector<float>(ptr, ptr + product(md.get_dims()));
+    }
+
+    static memory::dim product(const memory::dims &dims) {
+        return std::accumulate(dims.begin(), dims.end(), (memory::dim)1,
+                std::multiplies<memory::dim>());
+    }
+
+    top_k_cpu_params_t p;
+    engine eng;
+    stream strm;
+    std::mt19937 gen {2025};
+};
+
+TEST_P(top_k_cpu_test_t, TestsTopK) {
+    const auto tag = memory::format_tag::any;
+    memory::desc src_md(p.dims, p.src_dt, tag);
+    memory::desc dst_md(dst_dims(), p.dst_dt, tag);
+    memory::desc idx_md(dst_dims(), mdt::s32, tag);
+
+    impl::top_k::primitive_desc pd;
+    try {
+        pd = impl::top_k::primitive_desc(
+                eng, p.alg, src_md, dst_md, idx_md, p.axis, p.k);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    memory src_mem(pd.src_desc(), eng);
+    memory dst_mem(pd.dst_desc(0), eng);
+    memory idx_mem(pd.dst_desc(1), eng);
+    const auto src = fill_src(src_mem);
+
+    impl::top_k(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, dst_mem},
+                    {DNNL_ARG_TOP_K_INDICES, idx_mem}});
+    strm.wait();
+
+    const auto dst = read_memory(dst_mem);
+    const auto *idx = static_cast<const int32_t *>(idx_mem.get_data_handle());
+
+    memory::dim outer = 1, inner = 1;
+    for (int d = 0; d < p.axis; d++)
+        outer *= p.dims[d];
+    for (int d = p.axis + 1; d < (int)p.dims.size(); d++)
+        inner *= p.dims[d];
+    const auto N = p.dims[p.axis], K = p.k;
+    const bool largest = p.alg == algorithm::reduction_max;
+
+    std::vector<memory::dim> order(N);
+    for (memory::dim o = 0; o < outer; o++)
+        for (memory::dim i = 0; i < inner; i++) {
+            auto val = [&](memory::dim n) {
+                return src[(o * N + n) * inner + i];
+            };
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                    [&](memory::dim a, memory::dim b) {
+                        return largest ? val(a) > val(b) : val(a) < val(b);
+                    });
+            for (memory::dim j = 0; j < K; j++) {
+                const auto off = (o * K + j) * inner + i;
+                ASSERT_EQ(idx[off], order[j])
+                        << "o=" << o << " i=" << i << " j=" << j;
+                ASSERT_EQ(dst[off], val(order[j]))
+                        << "o=" << o << " i=" << i << " j=" << j;
+            }
+        }
+}
+
+TEST_P(top_k_cpu_test_t, TestsBadK) {
+    const auto tag = memory::format_tag::any;
+    auto dims = dst_dims();
+    dims[p.axis] = p.dims[p.axis] + 1;
+    memory::desc src_md(p.dims, p.src_dt, tag);
+    memory::desc dst_md(dims, p.dst_dt, tag);
+    memory::desc idx_md(dims, mdt::s32, tag);
+
+    EXPECT_THROW(impl::top_k::primitive_desc(eng, p.alg, src_md, dst_md,
+                         idx_md, p.axis, p.dims[p.axis] + 1),
+            error);
+}
+
+// clang-format off
+#define MAX algorithm::reduction_max
+#define MIN algorithm::reduction_min
+INSTANTIATE_TEST_SUITE_P(TestTopKCpu, top_k_cpu_test_t,
+        ::testing::Values(
+            //                 dims,             axis,   k, alg, src,       dst
+            top_k_cpu_params_t{{4, 1000},           1,   5, MAX, mdt::f32,  mdt::f32},
+            top_k_cpu_params_t{{4, 1000},           1,   5, MIN, mdt::f32,  mdt::f32},
+            top_k_cpu_params_t{{3, 200},            1,   1, MAX, mdt::f32,  mdt::f32},
+            top_k_cpu_params_t{{3, 200},            1,   1, MIN, mdt::f32,  mdt::f32},
+            top_k_cpu_params_t{{2, 151936},         1,  50, MAX, mdt::f32,  mdt::f32},
+            top_k_cpu_params_t{{1, 151936},         1,   1, MAX, mdt::bf16, mdt::bf16},
+            top_k_cpu_params_t{{1, 32000},          1, 300, MAX, mdt::f16,  mdt::f32},
+            top_k_cpu_params_t{{8, 300},            1, 300, MIN, mdt::bf16, mdt::f32},
+            top_k_cpu_params_t{{2, 3, 257},         2,  17, MAX, mdt::f32,  mdt::f16},
+            top_k_cpu_params_t{{2, 5, 7},           1,   3, MAX, mdt::f32,  mdt::f32},
+            top_k_cpu_params_t{{64, 6},             0,   4, MIN, mdt::f32,  mdt::f32},
+            top_k_cpu_params_t{{77},                0,  10, MAX, mdt::f16,  mdt::f16}
+        ));
+#undef MAX
+#undef MIN
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_TOP_K_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_TOP_K_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// Mirrors the argument index from src/common/top_k_types.hpp.
+#define DNNL_ARG_TOP_K_INDICES DNNL_ARG_DST_1
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for a top-k primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Selection algorithm: #dnnl_reduction_max for the largest
+///     values or #dnnl_reduction_min for the smallest ones.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor for the selected values,
+///     the source dimensions with @p k at the @p axis.
+/// @param indices_desc Destination memory descriptor for the positions of
+///     the selected values, s32 with the dimensions of @p dst_desc.
+/// @param axis Axis to select the values along.
+/// @param k Number of values to select.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API top_k_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int axis, dnnl_dim_t k,
+        const_dnnl_primitive_attr_t attr);
+
+namespace dnnl {
+namespace impl {
+
+/// Top-k internal primitive.
+struct top_k : public dnnl::primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                const memory::desc &indices_desc, int axis, memory::dim k,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = top_k_primitive_desc_create(&pd,
+                    aengine.get(), dnnl::convert_to_c(aalgorithm),
+                    src_desc.get(), dst_desc.get(), indices_desc.get(), axis,
+                    k, attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a top-k "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    top_k() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    top_k(const primitive_desc &pd) : primitive(pd) {}
+};
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
@@ -71,9 +71,6 @@ dnnl_status_t dnnl_gemm_bf16bf16f32(char transa, char transb, dnnl_dim_t M,
         float *C, dnnl_dim_t ldc);
 }
 
-// Declare packed GEMM interfaces for testing
-#include "src/cpu/gemm/gemm_pack.hpp"
-
 namespace dnnl {
 
 #if defined(DNNL_WTIH_SYCL)
@@ -83,6 +80,27 @@ bool is_memory_kind_buffer(const test_memory &mem) {
 }
 #endif
 
+// Packs matrix A or B with the packed GEMM API and makes `mat` point to the
+// packed buffer.
+template <typename data_t, typename get_size_f, typename pack_f>
+dnnl_status_t pack_matrix(const test_params_t &p, char identifier,
+        get_size_f get_size, pack_f pack, const data_t *&mat, char &trans,
+        std::vector<uint8_t> &buf) {
+    size_t size = 0;
+    auto status = get_size(identifier, p.transA, p.transB, p.M, p.N, p.K,
+            p.lda, p.ldb, &size);
+    if (status != dnnl_success) return status;
+
+    buf.resize(size);
+    status = pack(identifier, p.transA, p.transB, p.M, p.N, p.K, p.lda, p.ldb,
+            mat, buf.data());
+    if (status != dnnl_success) return status;
+
+    mat = reinterpret_cast<const data_t *>(buf.data());
+    trans = 'P';
+    return dnnl_success;
+}
+
 /* Test implementation description.
  * The testing steps looks as follows:
  * 0.  Prepare mapper_m and mapper_n <- details in test_gemm_data_preparation.hpp
@@ -116,69 +134,25 @@ struct dnnl_gemm_t<float, float, float> {
     static dnnl_status_t call_packed(const test_params_t &p,
             const test_memory &a_mem, const test_memory &b_mem,
             const test_memory &c_mem) {
-        /* Alas, the internal API still uses Fortran notation.
-         * So in addition to the changes for pack API, we also need to take
-         * care of conversions and layouts */
-
-        using namespace dnnl::impl::cpu;
-
         assert(p.alpha == 1.f);
 
-        /* Prepare for Fortran style, hence A <-> B */
-        char trans_a = p.transB, trans_b = p.transA;
-
-        int64_t m = p.N, n = p.M, k = p.K;
-        int64_t lda = p.ldb, ldb = p.lda, ldc = p.ldc;
-
-        std::vector<float> a_pack_buf, b_pack_buf;
-        float *A = map_memory<float>(b_mem), *a_eff = A;
-        float *B = map_memory<float>(a_mem), *b_eff = B;
+        const float *A = map_memory<float>(a_mem);
+        const float *B = map_memory<float>(b_mem);
         float *C = map_memory<float>(c_mem);
-
-        bool pack_a = p.pack_params.pack_b;
-        bool pack_b = p.pack_params.pack_a;
+        char trans_a = p.transA, trans_b = p.transB;
+        std::vector<uint8_t> a_pack_buf, b_pack_buf;
 
         dnnl_status_t status = dnnl_success;
-
-        if (pack_a) {
-            size_t a_sz;
-            status = sgemm_pack_get_size("A", &trans_a, &trans_b, &m, &n, &k,
-                    &lda, &ldb, &a_sz, &pack_a);
-            if (status != dnnl_success) return status;
-
-            if (pack_a) {
-                a_pack_buf.resize(a_sz / sizeof(float));
-                a_eff = a_pack_buf.data();
-
-                status = sgemm_pack("A", &trans_a, &trans_b, &m, &n, &k, &lda,
-                        &ldb, A, a_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_b) {
-            size_t b_sz;
-            status = sgemm_pack_get_size("B", &trans_a, &trans_b, &m, &n, &k,
-                    &lda, &ldb, &b_sz, &pack_b);
-            if (status != dnnl_success) return status;
-
-            if (pack_b) {
-                b_pack_buf.resize(b_sz / sizeof(float));
-                b_eff = b_pack_buf.data();
-
-                status = sgemm_pack("B", &trans_a, &trans_b, &m, &n, &k, &lda,
-                        &ldb, B, b_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_a) trans_a = 'P';
-        if (pack_b) trans_b = 'P';
-
-        status = sgemm_compute(&trans_a, &trans_b, &m, &n, &k, a_eff, &lda,
-                b_eff, &ldb, &p.beta, C, &ldc);
-
-        return status;
+        if (p.pack_params.pack_a)
+            status = pack_matrix(p, 'A', dnnl_sgemm_pack_get_size,
+                    dnnl_sgemm_pack, A, trans_a, a_pack_buf);
+        if (status == dnnl_success && p.pack_params.pack_b)
+            status = pack_matrix(p, 'B', dnnl_sgemm_pack_get_size,
+                    dnnl_sgemm_pack, B, trans_b, b_pack_buf);
+        if (status != dnnl_success) return status;
+
+        return dnnl_sgemm_compute(trans_a, trans_b, p.M, p.N, p.K, A, p.lda, B,
+                p.ldb, p.beta, C, p.ldc);
     }
 
     static dnnl_status_t call(const test_params_t &p, const test_memory &a_mem,
@@ -211,84 +185,29 @@ struct dnnl_gemm_t<int8_t, int8_t, int32_t> {
     static dnnl_status_t call_packed(const test_params_t &p,
             const test_memory &a_mem, const test_memory &b_mem,
             const test_memory &c_mem, const test_memory &oc_mem) {
-        /* Alas, the internal API still uses Fortran notation.
-         * So in addition to the changes for pack API, we also need to take
-         * care of conversions and layouts */
-
-        using namespace dnnl::impl::cpu;
-
         assert(p.alpha == 1.f);
         assert(p.igemm_params.oa() == 0);
         assert(p.igemm_params.ob() == 0);
 
-        /* Prepare for Fortran style, hence A <-> B */
-        char trans_a = p.transB, trans_b = p.transA;
-
-        int64_t m = p.N, n = p.M, k = p.K;
-        int64_t lda = p.ldb, ldb = p.lda, ldc = p.ldc;
-
-        int8_t *A = map_memory<int8_t>(b_mem), *a_eff = A;
-        int8_t *B = map_memory<int8_t>(a_mem), *b_eff = B;
-
+        const int8_t *A = map_memory<int8_t>(a_mem);
+        const int8_t *B = map_memory<int8_t>(b_mem);
         auto C = map_memory<int32_t>(c_mem);
         auto oc = map_memory<int32_t>(oc_mem);
-
-        char offset_c = '\0';
-        switch (p.igemm_params.offsetc) {
-            case 'R': offset_c = 'C'; break;
-            case 'r': offset_c = 'c'; break;
-            case 'C': offset_c = 'R'; break;
-            case 'c': offset_c = 'r'; break;
-            default: offset_c = p.igemm_params.offsetc;
-        }
-
-        std::vector<int8_t> a_pack_buf;
-        std::vector<int8_t> b_pack_buf;
-        bool pack_a = p.pack_params.pack_b;
-        bool pack_b = p.pack_params.pack_a;
+        char trans_a = p.transA, trans_b = p.transB;
+        std::vector<uint8_t> a_pack_buf, b_pack_buf;
 
         dnnl_status_t status = dnnl_success;
-
-        if (pack_a) {
-            size_t a_sz;
-            status = gemm_s8s8s32_pack_get_size(
-                    "A", &trans_a, &trans_b, &m, &n, &k, &lda, &ldb, &a_sz);
-            if (status != dnnl_success) return status;
-
-            if (pack_a) {
-                a_pack_buf.resize(a_sz);
-                a_eff = a_pack_buf.data();
-
-                status = gemm_s8s8s32_pack("A", &trans_a, &trans_b, &m, &n, &k,
-                        &lda, &ldb, A, a_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_b) {
-            size_t b_sz;
-
-            status = gemm_s8s8s32_pack_get_size(
-                    "B", &trans_a, &trans_b, &m, &n, &k, &lda, &ldb, &b_sz);
-            if (status != dnnl_success) return status;
-
-            if (pack_b) {
-                b_pack_buf.resize(b_sz);
-                b_eff = b_pack_buf.data();
-
-                status = gemm_s8s8s32_pack("B", &trans_a, &trans_b, &m, &n, &k,
-                        &lda, &ldb, B, b_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_a) trans_a = 'P';
-        if (pack_b) trans_b = 'P';
-
-        status = gemm_s8s8s32_compute(&trans_a, &trans_b, &offset_c, &m, &n, &k,
-                a_eff, &lda, b_eff, &ldb, &p.beta, C, &ldc, oc);
-
-        return status;
+        if (p.pack_params.pack_a)
+            status = pack_matrix(p, 'A', dnnl_gemm_s8s8s32_pack_get_size,
+                    dnnl_gemm_s8s8s32_pack, A, trans_a, a_pack_buf);
+        if (status == dnnl_success && p.pack_params.pack_b)
+            status = pack_matrix(p, 'B', dnnl_gemm_s8s8s32_pack_get_size,
+                    dnnl_gemm_s8s8s32_pack, B, trans_b, b_pack_buf);
+        if (status != dnnl_success) return status;
+
+        return dnnl_gemm_s8s8s32_compute(trans_a, trans_b,
+                p.igemm_params.offsetc, p.M, p.N, p.K, A, p.lda, B, p.ldb,
+                p.beta, C, p.ldc, oc);
     }
 
     static dnnl_status_t call(const test_params_t &p, const test_memory &a_mem,
@@ -345,84 +264,29 @@ struct dnnl_gemm_t<uint8_t, int8_t, int32_t> {
     static dnnl_status_t call_packed(const test_params_t &p,
             const test_memory &a_mem, const test_memory &b_mem,
             const test_memory &c_mem, const test_memory &oc_mem) {
-        /* Alas, the internal API still uses Fortran notation.
-         * So in addition to the changes for pack API, we also need to take
-         * care of conversions and layouts */
-
-        using namespace dnnl::impl::cpu;
-
         assert(p.alpha == 1.f);
         assert(p.igemm_params.oa() == 0);
         assert(p.igemm_params.ob() == 0);
 
-        /* Prepare for Fortran style, hence A <-> B */
-        char trans_a = p.transB, trans_b = p.transA;
-
-        int64_t m = p.N, n = p.M, k = p.K;
-        int64_t lda = p.ldb, ldb = p.lda, ldc = p.ldc;
-
-        int8_t *A = map_memory<int8_t>(b_mem), *a_eff = A;
-        uint8_t *B = map_memory<uint8_t>(a_mem), *b_eff = B;
-
+        const uint8_t *A = map_memory<uint8_t>(a_mem);
+        const int8_t *B = map_memory<int8_t>(b_mem);
         auto C = map_memory<int32_t>(c_mem);
         auto oc = map_memory<int32_t>(oc_mem);
-
-        char offset_c = '\0';
-        switch (p.igemm_params.offsetc) {
-            case 'R': offset_c = 'C'; break;
-            case 'r': offset_c = 'c'; break;
-            case 'C': offset_c = 'R'; break;
-            case 'c': offset_c = 'r'; break;
-            default: offset_c = p.igemm_params.offsetc;
-        }
-
-        std::vector<int8_t> a_pack_buf;
-        std::vector<uint8_t> b_pack_buf;
-        bool pack_a = p.pack_params.pack_b;
-        bool pack_b = p.pack_params.pack_a;
+        char trans_a = p.transA, trans_b = p.transB;
+        std::vector<uint8_t> a_pack_buf, b_pack_buf;
 
         dnnl_status_t status = dnnl_success;
-
-        if (pack_a) {
-            size_t a_sz;
-            status = gemm_s8u8s32_pack_get_size(
-                    "A", &trans_a, &trans_b, &m, &n, &k, &lda, &ldb, &a_sz);
-            if (status != dnnl_success) return status;
-
-            if (pack_a) {
-                a_pack_buf.resize(a_sz);
-                a_eff = a_pack_buf.data();
-
-                status = gemm_s8u8s32_pack("A", &trans_a, &trans_b, &m, &n, &k,
-                        &lda, &ldb, A, a_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_b) {
-            size_t b_sz;
-
-            status = gemm_s8u8s32_pack_get_size(
-                    "B", &trans_a, &trans_b, &m, &n, &k, &lda, &ldb, &b_sz);
-            if (status != dnnl_success) return status;
-
-            if (pack_b) {
-                b_pack_buf.resize(b_sz);
-                b_eff = b_pack_buf.data();
-
-                status = gemm_s8u8s32_pack("B", &trans_a, &trans_b, &m, &n, &k,
-                        &lda, &ldb, B, b_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_a) trans_a = 'P';
-        if (pack_b) trans_b = 'P';
-
-        status = gemm_s8u8s32_compute(&trans_a, &trans_b, &offset_c, &m, &n, &k,
-                a_eff, &lda, b_eff, &ldb, &p.beta, C, &ldc, oc);
-
-        return status;
+        if (p.pack_params.pack_a)
+            status = pack_matrix(p, 'A', dnnl_gemm_u8s8s32_pack_get_size,
+                    dnnl_gemm_u8s8s32_pack, A, trans_a, a_pack_buf);
+        if (status == dnnl_success && p.pack_params.pack_b)
+            status = pack_matrix(p, 'B', dnnl_gemm_u8s8s32_pack_get_size,
+                    dnnl_gemm_u8s8s32_pack, B, trans_b, b_pack_buf);
+        if (status != dnnl_success) return status;
+
+        return dnnl_gemm_u8s8s32_compute(trans_a, trans_b,
+                p.igemm_params.offsetc, p.M, p.N, p.K, A, p.lda, B, p.ldb,
+                p.beta, C, p.ldc, oc);
     }
 
     static dnnl_status_t call(const test_params_t &p, const test_memory &a_mem,
@@ -470,69 +334,25 @@ struct dnnl_gemm_t<bfloat16_t, bfloat16_t, float> {
     static dnnl_status_t call_packed(const test_params_t &p,
             const test_memory &a_mem, const test_memory &b_mem,
             const test_memory &c_mem) {
-        /* Alas, the internal API still uses Fortran notation.
-         * So in addition to the changes for pack API, we also need to take
-         * care of conversions and layouts */
-
-        using namespace dnnl::impl::cpu;
-
         assert(p.alpha == 1.f);
 
-        /* Prepare for Fortran style, hence A <-> B */
-        char trans_a = p.transB, trans_b = p.transA;
-
-        int64_t m = p.N, n = p.M, k = p.K;
-        int64_t lda = p.ldb, ldb = p.lda, ldc = p.ldc;
-
-        std::vector<bfloat16_t> a_pack_buf, b_pack_buf;
-        bfloat16_t *A = map_memory<bfloat16_t>(b_mem), *a_eff = A;
-        bfloat16_t *B = map_memory<bfloat16_t>(a_mem), *b_eff = B;
+        const bfloat16_t *A = map_memory<bfloat16_t>(a_mem);
+        const bfloat16_t *B = map_memory<bfloat16_t>(b_mem);
         float *C = map_memory<float>(c_mem);
-
-        bool pack_a = p.pack_params.pack_b;
-        bool pack_b = p.pack_params.pack_a;
+        char trans_a = p.transA, trans_b = p.transB;
+        std::vector<uint8_t> a_pack_buf, b_pack_buf;
 
         dnnl_status_t status = dnnl_success;
-
-        if (pack_a) {
-            size_t a_sz;
-            status = gemm_bf16bf16f32_pack_get_size("A", &trans_a, &trans_b, &m,
-                    &n, &k, &lda, &ldb, &a_sz, &pack_a);
-            if (status != dnnl_success) return status;
-
-            if (pack_a) {
-                a_pack_buf.resize(a_sz / sizeof(*a_eff));
-                a_eff = a_pack_buf.data();
-
-                status = gemm_bf16bf16f32_pack("A", &trans_a, &trans_b, &m, &n,
-                        &k, &lda, &ldb, A, a_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_b) {
-            size_t b_sz;
-            status = gemm_bf16bf16f32_pack_get_size("B", &trans_a, &trans_b, &m,
-                    &n, &k, &lda, &ldb, &b_sz, &pack_b);
-            if (status != dnnl_success) return status;
-
-            if (pack_b) {
-                b_pack_buf.resize(b_sz / sizeof(*b_eff));
-                b_eff = b_pack_buf.data();
-
-                status = gemm_bf16bf16f32_pack("B", &trans_a, &trans_b, &m, &n,
-                        &k, &lda, &ldb, B, b_eff);
-                if (status != dnnl_success) return status;
-            }
-        }
-
-        if (pack_a) trans_a = 'P';
-        if (pack_b) trans_b = 'P';
-
-        status = gemm_bf16bf16f32_compute(&trans_a, &trans_b, &m, &n, &k, a_eff,
-                &lda, b_eff, &ldb, &p.beta, C, &ldc);
-
-        return status;
+        if (p.pack_params.pack_a)
+            status = pack_matrix(p, 'A', dnnl_gemm_bf16bf16f32_pack_get_size,
+                    dnnl_gemm_bf16bf16f32_pack, A, trans_a, a_pack_buf);
+        if (status == dnnl_success && p.pack_params.pack_b)
+            status = pack_matrix(p, 'B', dnnl_gemm_bf16bf16f32_pack_get_size,
+                    dnnl_gemm_bf16bf16f32_pack, B, trans_b, b_pack_buf);
+        if (status != dnnl_success) return status;
+
+        return dnnl_gemm_bf16bf16f32_compute(trans_a, trans_b, p.M, p.N, p.K, A,
+                p.lda, B, p.ldb, p.beta, C, p.ldc);
     }
 
     static dnnl_status_t call(const test_params_t &p, const test_memory &a_mem,
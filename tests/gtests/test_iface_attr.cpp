@@ -127,6 +127,31 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestWeightsPaging) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(0, attr.get_weights_paging());
+
+    attr.set_weights_paging(16);
+    ASSERT_EQ(16, attr.get_weights_paging());
+
+    EXPECT_ANY_THROW(attr.set_weights_paging(0));
+    EXPECT_ANY_THROW(attr.set_weights_paging(-1));
+    ASSERT_EQ(16, attr.get_weights_paging());
+}
+
+TEST_F(attr_test_t, TestSrcDynamicQuantization) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(memory::data_type::undef, attr.get_src_dynamic_quantization());
+
+    attr.set_src_dynamic_quantization(memory::data_type::s8);
+    ASSERT_EQ(memory::data_type::s8, attr.get_src_dynamic_quantization());
+
+    EXPECT_ANY_THROW(attr.set_src_dynamic_quantization(memory::data_type::f32));
+    ASSERT_EQ(memory::data_type::s8, attr.get_src_dynamic_quantization());
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2022 Intel Corporation
+* Copyright 2019-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <unordered_map>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -34,6 +36,42 @@ protected:
     void check_status(const F &f, dnnl_status_t status) {
         catch_expected_failures(f, status != dnnl_success, status, false);
     }
+
+    // Returns false if there is no implementation for the descriptor.
+    template <typename pd_t, typename F>
+    static bool try_create_pd(pd_t &pd, const F &f) {
+        try {
+            pd = f();
+        } catch (const error &e) {
+            if (e.status == dnnl_unimplemented) return false;
+            throw;
+        }
+        return true;
+    }
+
+    // Executes the primitive created for a runtime minibatch and the one
+    // created for the actual minibatch and compares their destinations.
+    template <typename prim_t>
+    void check_runtime_mb_execution(
+            const typename prim_t::primitive_desc &rt_pd,
+            const typename prim_t::primitive_desc &pd,
+            const std::unordered_map<int, memory> &args) {
+        stream strm(eng);
+        const auto dst_md = pd.dst_desc();
+        auto rt_dst = test::make_memory(dst_md, eng);
+        auto dst = test::make_memory(dst_md, eng);
+
+        auto rt_args = args;
+        rt_args.insert({DNNL_ARG_DST, rt_dst});
+        auto static_args = args;
+        static_args.insert({DNNL_ARG_DST, dst});
+
+        prim_t(rt_pd).execute(strm, rt_args);
+        prim_t(pd).execute(strm, static_args);
+        strm.wait();
+
+        compare_data<float>(dst, rt_dst, 1e-5f);
+    }
 };
 #define CHECK_STATUs(status, ...) check_status([&]() { __VA_ARGS__; }, status)
 #define CHECK_STATUS(status, ...) CHECK_STATUs(status, __VA_ARGS__)
@@ -191,8 +229,11 @@ TEST_F(runtime_dim_test_t, TestLNorm) {
     memory::desc md {{DNNL_RUNTIME_DIM_VAL, 16, 16}, data_type::f32, tag::abc};
     memory::desc stat_md {{DNNL_RUNTIME_DIM_VAL, 16}, data_type::f32, tag::ab};
     normalization_flags flags {};
+    // Only the outermost dimension may be defined at execution time.
+    memory::desc rt_c_md {
+            {2, 16, DNNL_RUNTIME_DIM_VAL}, data_type::f32, tag::abc};
     CHECK_UNIMPL(layer_normalization_forward::primitive_desc(
-            eng, prop_kind::forward, md, md, stat_md, 0.1f, flags));
+            eng, prop_kind::forward, rt_c_md, rt_c_md, 0.1f, flags));
 
     layer_normalization_forward::primitive_desc fwd_hint;
     {
@@ -329,8 +370,14 @@ TEST_F(runtime_dim_test_t, TestShuffle) {
 
 TEST_F(runtime_dim_test_t, TestSoftmax) {
     memory::desc md {{DNNL_RUNTIME_DIM_VAL, 16}, data_type::f32, tag::ab};
+    // Only the outermost dimension may be defined at execution time, and it
+    // may not be the softmax axis.
     CHECK_UNIMPL(softmax_forward::primitive_desc(
-            eng, prop_kind::forward, algorithm::softmax_accurate, md, md, 1));
+            eng, prop_kind::forward, algorithm::softmax_accurate, md, md, 0));
+    memory::desc rt_c_md {
+            {2, 16, DNNL_RUNTIME_DIM_VAL}, data_type::f32, tag::abc};
+    CHECK_UNIMPL(softmax_forward::primitive_desc(eng, prop_kind::forward,
+            algorithm::softmax_accurate, rt_c_md, rt_c_md, 1));
 
     softmax_forward::primitive_desc fwd_hint;
     {
@@ -344,6 +391,103 @@ TEST_F(runtime_dim_test_t, TestSoftmax) {
             eng, algorithm::softmax_accurate, md, md, md, 1, fwd_hint));
 }
 
+CPU_TEST_F(runtime_dim_test_t, TestConvRuntimeMb) {
+    const memory::dim rt = DNNL_RUNTIME_DIM_VAL;
+    auto src_md = [](memory::dim mb) {
+        return memory::desc({mb, 16, 7, 7}, data_type::f32, tag::acdb);
+    };
+    auto dst_md = [](memory::dim mb) {
+        return memory::desc({mb, 32, 7, 7}, data_type::f32, tag::acdb);
+    };
+    memory::desc wei_md {{32, 16, 3, 3}, data_type::f32, tag::any};
+    auto create_pd = [&](memory::dim mb) {
+        return convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md(mb), wei_md, dst_md(mb), {1, 1}, {1, 1}, {1, 1});
+    };
+
+    convolution_forward::primitive_desc rt_pd;
+    SKIP_IF(!try_create_pd(rt_pd, [&]() { return create_pd(rt); }),
+            "Runtime minibatch is not supported.");
+    ASSERT_EQ(rt_pd.src_desc(), src_md(rt));
+
+    // Weights layouts of the primitives may differ.
+    stream strm(eng);
+    memory::desc user_wei_md {{32, 16, 3, 3}, data_type::f32, tag::abcd};
+    auto user_wei = test::make_memory(user_wei_md, eng);
+    fill_data<float>(user_wei_md.get_size() / sizeof(float), user_wei);
+    auto rt_wei = test::make_memory(rt_pd.weights_desc(), eng);
+    reorder(user_wei, rt_wei).execute(strm, user_wei, rt_wei);
+
+    for (memory::dim mb : {1, 5}) {
+        auto pd = create_pd(mb);
+        auto src = test::make_memory(src_md(mb), eng);
+        fill_data<float>(src_md(mb).get_size() / sizeof(float), src);
+        auto wei = test::make_memory(pd.weights_desc(), eng);
+        reorder(user_wei, wei).execute(strm, user_wei, wei);
+
+        auto rt_dst = test::make_memory(dst_md(mb), eng);
+        auto dst = test::make_memory(dst_md(mb), eng);
+        convolution_forward(rt_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, rt_wei},
+                        {DNNL_ARG_DST, rt_dst}});
+        convolution_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+        compare_data<float>(dst, rt_dst, 1e-5f);
+    }
+}
+
+CPU_TEST_F(runtime_dim_test_t, TestLNormRuntimeMb) {
+    const memory::dim rt = DNNL_RUNTIME_DIM_VAL;
+    auto md = [](memory::dim mb) {
+        return memory::desc({mb, 4, 32}, data_type::f32, tag::abc);
+    };
+    auto create_pd = [&](memory::dim mb) {
+        return layer_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_inference, md(mb), md(mb), 0.1f,
+                normalization_flags::none);
+    };
+
+    layer_normalization_forward::primitive_desc rt_pd;
+    SKIP_IF(!try_create_pd(rt_pd, [&]() { return create_pd(rt); }),
+            "Runtime minibatch is not supported.");
+
+    // The second minibatch exceeds the block of rows processed at once.
+    for (memory::dim mb : {1, 100}) {
+        auto src = test::make_memory(md(mb), eng);
+        fill_data<float>(md(mb).get_size() / sizeof(float), src);
+        check_runtime_mb_execution<layer_normalization_forward>(
+                rt_pd, create_pd(mb), {{DNNL_ARG_SRC, src}});
+    }
+}
+
+CPU_TEST_F(runtime_dim_test_t, TestSoftmaxRuntimeMb) {
+    const memory::dim rt = DNNL_RUNTIME_DIM_VAL;
+    auto md = [](memory::dim mb) {
+        return memory::desc({mb, 16, 8}, data_type::f32, tag::abc);
+    };
+    for (int axis : {1, 2}) {
+        auto create_pd = [&](memory::dim mb) {
+            return softmax_forward::primitive_desc(eng,
+                    prop_kind::forward_inference, algorithm::softmax_accurate,
+                    md(mb), md(mb), axis);
+        };
+
+        softmax_forward::primitive_desc rt_pd;
+        SKIP_IF(!try_create_pd(rt_pd, [&]() { return create_pd(rt); }),
+                "Runtime minibatch is not supported.");
+
+        for (memory::dim mb : {1, 7}) {
+            auto src = test::make_memory(md(mb), eng);
+            fill_data<float>(md(mb).get_size() / sizeof(float), src);
+            check_runtime_mb_execution<softmax_forward>(
+                    rt_pd, create_pd(mb), {{DNNL_ARG_SRC, src}});
+        }
+    }
+}
+
 TEST_F(runtime_dim_test_t, TestSum) {
     memory::desc md {
             {DNNL_RUNTIME_DIM_VAL, 16, 3, 3}, data_type::f32, tag::abcd};
@@ -19,6 +19,8 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace dnnl {
@@ -669,6 +671,251 @@ INSTANTIATE_TEST_SUITE_P(
 INSTANTIATE_TEST_SUITE_P(
         Generic_u8s8u8, iface, cases_x8(data_type::u8, data_type::u8));
 
+// The pages of dense weights are shuffled in a pool: the result with the paged
+// weights must match the one with the dense weights. Page sizes are multiples
+// of the brgemm blocks, so the optimized implementation must handle them.
+class paged_weights_test_t
+    : public ::testing::TestWithParam<
+              std::tuple<memory::format_tag, memory::dim>> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(paged_weights_test_t, TestsMatMulPagedWeights) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Weights paging is supported on CPU only");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim B = 2, M = 3, K = 96, N = 64;
+    const auto wei_tag = std::get<0>(GetParam());
+    const memory::dim page_size = std::get<1>(GetParam());
+    // `abc` weights are paged along K and `acb` weights along N.
+    const bool paged_by_k = wei_tag == tag::abc;
+    const memory::dim n_pages = (paged_by_k ? K : N) / page_size;
+    const memory::dim pool_pages = B * n_pages;
+
+    memory::desc src_md({B, M, K}, data_type::f32, tag::abc);
+    memory::desc wei_md({B, K, N}, data_type::f32, wei_tag);
+    memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+    memory::desc pool_md(paged_by_k
+                    ? memory::dims {pool_pages * page_size, N}
+                    : memory::dims {K, pool_pages * page_size},
+            data_type::f32, paged_by_k ? tag::ab : tag::ba);
+    memory::desc page_table_md({B, n_pages}, data_type::s32, tag::ab);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto pool = test::make_memory(pool_md, eng);
+    auto page_table = test::make_memory(page_table_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto dst_paged = test::make_memory(dst_md, eng);
+
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < B * M * K; i++)
+            src_ptr[i] = static_cast<float>(i % 7 - 3);
+
+        // Pages are stored in the pool in the reverse order.
+        auto wei_ptr = map_memory<float>(wei);
+        auto pool_ptr = map_memory<float>(pool);
+        auto page_table_ptr = map_memory<int32_t>(page_table);
+        for_(memory::dim b = 0; b < B; b++)
+        for_(memory::dim k = 0; k < K; k++)
+        for (memory::dim n = 0; n < N; n++) {
+            const float w = static_cast<float>((b * K * N + k * N + n) % 5 - 2);
+            const memory::dim row = paged_by_k ? k : n;
+            const memory::dim page = b * n_pages + row / page_size;
+            const memory::dim pool_page = pool_pages - 1 - page;
+            const memory::dim pool_row
+                    = pool_page * page_size + row % page_size;
+            page_table_ptr[page] = static_cast<int32_t>(pool_page);
+            if (paged_by_k) {
+                wei_ptr[(b * K + k) * N + n] = w;
+                pool_ptr[pool_row * N + n] = w;
+            } else {
+                wei_ptr[(b * N + n) * K + k] = w;
+                pool_ptr[pool_row * K + k] = w;
+            }
+        }
+    }
+
+    auto matmul_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    matmul(matmul_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+
+    primitive_attr attr;
+    attr.set_weights_paging(page_size);
+    auto paged_pd
+            = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    ASSERT_EQ(paged_pd.query_md(query::exec_arg_md,
+                      DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE),
+            page_table_md);
+    // Paging must not make brgemm matmul fall back to the reference one.
+    const std::string impl_name = matmul_pd.impl_info_str();
+    if (impl_name.find("brg") != std::string::npos)
+        ASSERT_EQ(paged_pd.impl_info_str(), impl_name);
+    matmul paged_matmul(paged_pd);
+    paged_matmul.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, pool},
+                    {DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE, page_table},
+                    {DNNL_ARG_DST, dst_paged}});
+    strm.wait();
+
+    {
+        // Inputs are small integers, so the results are exact.
+        auto dst_ptr = map_memory<float>(dst);
+        auto dst_paged_ptr = map_memory<float>(dst_paged);
+        for (memory::dim i = 0; i < B * M * N; i++)
+            ASSERT_EQ(dst_ptr[i], dst_paged_ptr[i]);
+    }
+
+    // A page outside of the pool is rejected.
+    {
+        auto page_table_ptr = map_memory<int32_t>(page_table);
+        page_table_ptr[0] = static_cast<int32_t>(pool_pages);
+    }
+    EXPECT_ANY_THROW(paged_matmul.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, pool},
+                    {DNNL_ARG_ATTR_WEIGHTS_PAGE_TABLE, page_table},
+                    {DNNL_ARG_DST, dst_paged}}));
+}
+
+INSTANTIATE_TEST_SUITE_P(PagedWeights, paged_weights_test_t,
+        ::testing::Combine(::testing::Values(tag::abc, tag::acb),
+                ::testing::Values(16, 32)));
+
+// The source is quantized to s8 with a scale per row at execution time. The
+// result is compared against the same computations done in the test.
+struct src_dyn_quant_params_t {
+    memory::dim B, M, K;
+    bool with_bias;
+    bool with_relu;
+};
+
+class src_dyn_quant_test_t
+    : public ::testing::TestWithParam<src_dyn_quant_params_t> {
+protected:
+    // The attribute is rejected on processors with Intel AMX.
+    static bool is_amx() {
+        const auto isa = static_cast<unsigned>(get_effective_cpu_isa());
+        const auto amx = static_cast<unsigned>(cpu_isa::avx512_core_amx);
+        return (isa & amx) == amx;
+    }
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(src_dyn_quant_test_t, TestsMatMulSrcDynQuant) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Dynamic quantization of source is supported on CPU only");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const auto p = GetParam();
+    const memory::dim B = p.B, M = p.M, K = p.K, N = 40;
+
+    // Weights, their scales and bias are shared between the batches.
+    memory::desc src_md({B, M, K}, data_type::f32, tag::abc);
+    memory::desc wei_md({1, K, N}, data_type::s8, tag::abc);
+    memory::desc bia_md({1, 1, N}, data_type::f32, tag::abc);
+    memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+    memory::desc wei_scales_md({N}, data_type::f32, tag::a);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto bia = test::make_memory(bia_md, eng);
+    auto wei_scales = test::make_memory(wei_scales_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+
+    std::vector<float> src_vals(B * M * K), bia_vals(N), wei_scales_vals(N);
+    std::vector<int8_t> wei_vals(K * N);
+    for_(memory::dim b = 0; b < B; b++)
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim k = 0; k < K; k++) {
+        // The second row is zero to check the handling of a zero scale.
+        const memory::dim i = (b * M + m) * K + k;
+        src_vals[i] = m == 1
+                ? 0.f
+                : static_cast<float>(i % 23 - 11) * 0.37f * (m + b + 1);
+    }
+    for (memory::dim i = 0; i < K * N; i++)
+        wei_vals[i] = static_cast<int8_t>(i % 13 - 6);
+    for (memory::dim n = 0; n < N; n++) {
+        bia_vals[n] = static_cast<float>(n % 7 - 3) * 0.5f;
+        wei_scales_vals[n] = 0.5f + 0.25f * (n % 3);
+    }
+
+    {
+        auto src_ptr = map_memory<float>(src);
+        auto wei_ptr = map_memory<int8_t>(wei);
+        auto bia_ptr = map_memory<float>(bia);
+        auto wei_scales_ptr = map_memory<float>(wei_scales);
+        for (memory::dim i = 0; i < B * M * K; i++)
+            src_ptr[i] = src_vals[i];
+        for (memory::dim i = 0; i < K * N; i++)
+            wei_ptr[i] = wei_vals[i];
+        for (memory::dim n = 0; n < N; n++) {
+            bia_ptr[n] = bia_vals[n];
+            wei_scales_ptr[n] = wei_scales_vals[n];
+        }
+    }
+
+    primitive_attr attr;
+    attr.set_src_dynamic_quantization(data_type::s8);
+    attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1 << 2);
+    if (p.with_relu) {
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        attr.set_post_ops(ops);
+    }
+    if (is_amx()) {
+        EXPECT_ANY_THROW(
+                matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr));
+        return;
+    }
+    auto pd = p.with_bias
+            ? matmul::primitive_desc(
+                    eng, src_md, wei_md, bia_md, dst_md, attr)
+            : matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, wei_scales},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    for_(memory::dim b = 0; b < B; b++)
+    for (memory::dim m = 0; m < M; m++) {
+        const float *src_row = &src_vals[(b * M + m) * K];
+        float abs_max = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            abs_max = std::max(abs_max, std::fabs(src_row[k]));
+        float scale = abs_max / 127.f, inv_scale = 127.f / abs_max;
+        if (abs_max == 0.f) scale = inv_scale = 1.f;
+
+        for (memory::dim n = 0; n < N; n++) {
+            int32_t acc = 0;
+            for (memory::dim k = 0; k < K; k++) {
+                const float q = std::nearbyint(std::min(
+                        127.f, std::max(-128.f, src_row[k] * inv_scale)));
+                acc += static_cast<int32_t>(q) * wei_vals[k * N + n];
+            }
+            float expected = acc * scale * wei_scales_vals[n];
+            if (p.with_bias) expected += bia_vals[n];
+            if (p.with_relu) expected = std::max(expected, 0.f);
+            ASSERT_NEAR(expected, dst_ptr[(b * M + m) * N + n],
+                    1e-5f * std::max(1.f, std::fabs(expected)));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SrcDynQuant, src_dyn_quant_test_t,
+        ::testing::Values(src_dyn_quant_params_t {1, 5, 70, false, false},
+                src_dyn_quant_params_t {1, 1, 256, false, false},
+                src_dyn_quant_params_t {1, 33, 17, false, false},
+                src_dyn_quant_params_t {1, 5, 70, true, false},
+                src_dyn_quant_params_t {1, 33, 17, false, true},
+                src_dyn_quant_params_t {3, 5, 70, false, false},
+                src_dyn_quant_params_t {2, 17, 64, true, true}));
+
 INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
         ::testing::Values(
                 // {{src0, src1, dst same_dim}, { binary post-op dim }},